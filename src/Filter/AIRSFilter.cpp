@@ -1,5 +1,6 @@
 #include <vtkDataObjectAlgorithm.h>
 #include "AIRSFilter.h"
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include <vtkThreshold.h>
@@ -31,26 +32,24 @@ QList<Data::Type> AIRSFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>());
 }
 
-bool AIRSFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-                               vtkPointData* pointData) {
-	vtkSmartPointer<vtkDoubleArray> timeArray = vtkDoubleArray::SafeDownCast(
-	            pointData->GetAbstractArray("time"));
-	vtkSmartPointer<vtkFloatArray> soArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("SO2"));
-	vtkSmartPointer<vtkFloatArray> ashArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("ash"));
+void AIRSFilter::evaluatePoints(vtkPointSet* inputData,
+                                std::vector<unsigned char>& selection) {
+	const double* times = getValues<vtkDoubleArray>(inputData, "time");
+	const float* soIndices = getValues<vtkFloatArray>(inputData, "SO2");
+	const float* ashIndices = getValues<vtkFloatArray>(inputData, "ash");
 
-	if (!timeArray || !soArray || !ashArray) {
-		return false;
+	if (!times || !soIndices || !ashIndices) {
+		return;
 	}
 
-	double time = timeArray->GetTuple1(pointIndex);
-	float soIndex = soArray->GetTuple1(pointIndex);
-	float ashIndex = ashArray->GetTuple1(pointIndex);
-
-	return (this->lowerTimeLimit <= time && time <= this->upperTimeLimit)
-	       && (this->lowerSOLimit <= soIndex && soIndex <= this->upperSOLimit) &&
-	       (this->lowerAshLimit <= ashIndex && ashIndex <= this->upperAshLimit);
+	RangeSelection rangeSelection;
+	rangeSelection.addRange(times, this->lowerTimeLimit, this->upperTimeLimit,
+	                        this->getBlockSummaries(inputData, "time"));
+	rangeSelection.addRange(soIndices, this->lowerSOLimit, this->upperSOLimit,
+	                        this->getBlockSummaries(inputData, "SO2"));
+	rangeSelection.addRange(ashIndices, this->lowerAshLimit, this->upperAshLimit,
+	                        this->getBlockSummaries(inputData, "ash"));
+	rangeSelection.select(selection.data(), selection.size());
 }
 
 void AIRSFilter::SetInputConnection(vtkAlgorithmOutput* input) {
@@ -62,7 +62,7 @@ private:
 	AIRSFilter(const AIRSFilter&); //Not implemented
 	void operator=(const AIRSFilter&); //Not implemented
 	QList<Data::Type> getCompatibleDataTypes() override;
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData) override;
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection) override;
 
 	/**
 	 * the upper Limit for the Time
@@ -1,11 +1,16 @@
 #include <Filter/AbstractSelectionFilter.hpp>
 
+#include <Utils/Misc/Threads.hpp>
+
 #include <vtkPolyData.h>
 #include <vtkDataObject.h>
+#include <vtkFieldData.h>
 #include <vtkAlgorithm.h>
 #include <vtkCellArray.h>
 #include <vtkExecutive.h>
 #include <vtkInformationExecutivePortVectorKey.h>
+#include <vtkIdTypeArray.h>
+#include <vtkStringArray.h>
 
 AbstractSelectionFilter::AbstractSelectionFilter() { }
 
@@ -16,6 +21,120 @@ void AbstractSelectionFilter::fail(QString message) {
 	                   message).toStdString());
 }
 
+const BlockSummaries* AbstractSelectionFilter::getBlockSummaries(vtkPointSet* inputData,
+        const char* name) {
+	vtkDataArray* array = inputData->GetPointData()->GetArray(name);
+	size_t count = inputData->GetNumberOfPoints();
+
+	if (!array || array->GetNumberOfComponents() != 1
+	        || (size_t) array->GetNumberOfTuples() < count) {
+		this->blockSummaries.erase(name);
+		return nullptr;
+	}
+
+	// Arrays are never modified at the same time, so a new array at the same address is told apart
+	// by its modification time
+	CachedSummaries& cached = this->blockSummaries[name];
+	if (cached.array == array && cached.modifiedTime == array->GetMTime()
+	        && cached.summaries.getValueCount() == count) {
+		return &cached.summaries;
+	}
+
+	cached.array = array;
+	cached.modifiedTime = array->GetMTime();
+	switch (array->GetDataType()) {
+	case VTK_FLOAT:
+		cached.summaries.summarize(static_cast<const float*>(array->GetVoidPointer(0)), count);
+		break;
+	case VTK_DOUBLE:
+		cached.summaries.summarize(static_cast<const double*>(array->GetVoidPointer(0)), count);
+		break;
+	case VTK_UNSIGNED_INT:
+		cached.summaries.summarize(static_cast<const unsigned int*>(array->GetVoidPointer(0)),
+		                           count);
+		break;
+	case VTK_UNSIGNED_CHAR:
+		cached.summaries.summarize(static_cast<const unsigned char*>(array->GetVoidPointer(0)),
+		                           count);
+		break;
+	default:
+		this->blockSummaries.erase(name);
+		return nullptr;
+	}
+
+	return &cached.summaries;
+}
+
+/**
+ * The smallest amount of input points worth another thread
+ */
+static const int MINIMUM_POINTS_PER_THREAD = 65536;
+
+/**
+ * Copy the tuples of a range of selected points from one array into another.
+ * @param input The values of the input array
+ * @param output The values of the output array, holding one tuple for each selected point
+ * @param numberOfComponents The amount of components of both arrays
+ * @param selectedPoints The input indices of the selected points
+ * @param begin The output index of the first selected point to copy
+ * @param end The output index after the last selected point to copy
+ */
+template<typename ValueType>
+static void gatherTuples(const ValueType* input, ValueType* output, int numberOfComponents,
+                         const std::vector<vtkIdType>& selectedPoints, vtkIdType begin,
+                         vtkIdType end) {
+	for (vtkIdType i = begin; i < end; i++) {
+		const ValueType* inputTuple = input + selectedPoints[i] * numberOfComponents;
+		ValueType* outputTuple = output + i * numberOfComponents;
+		for (int c = 0; c < numberOfComponents; c++) {
+			outputTuple[c] = inputTuple[c];
+		}
+	}
+}
+
+/**
+ * Check whether an array stores its values contiguously, so that disjoint ranges of its tuples
+ * can be written by different threads at once.
+ * @param array The array
+ * @return True for string arrays and arrays of plain numeric values, false e.g. for bit arrays
+ */
+static bool canBeGatheredInParallel(vtkAbstractArray* array) {
+	switch (array->GetDataType()) {
+		vtkTemplateMacro(return true);
+	default:
+		return vtkStringArray::SafeDownCast(array) != nullptr;
+	}
+}
+
+/**
+ * Copy the tuples of a range of selected points from one array into another of the same type,
+ * which has to be possible in parallel.
+ * @param input The input array
+ * @param output The output array, already holding one tuple for each selected point
+ * @param selectedPoints The input indices of the selected points
+ * @param begin The output index of the first selected point to copy
+ * @param end The output index after the last selected point to copy
+ */
+static void gatherArray(vtkAbstractArray* input, vtkAbstractArray* output,
+                        const std::vector<vtkIdType>& selectedPoints, vtkIdType begin,
+                        vtkIdType end) {
+	vtkStringArray* inputStrings = vtkStringArray::SafeDownCast(input);
+	vtkStringArray* outputStrings = vtkStringArray::SafeDownCast(output);
+
+	if (inputStrings && outputStrings) {
+		// Assign the strings in place, since setting them notifies the array each time
+		gatherTuples(inputStrings->GetPointer(0), outputStrings->GetPointer(0),
+		             input->GetNumberOfComponents(), selectedPoints, begin, end);
+		return;
+	}
+
+	switch (input->GetDataType()) {
+		vtkTemplateMacro(gatherTuples(static_cast<const VTK_TT*>(input->GetVoidPointer(0)),
+		                              static_cast<VTK_TT*>(output->GetVoidPointer(0)),
+		                              input->GetNumberOfComponents(), selectedPoints, begin, end));
+	}
+}
+
 int AbstractSelectionFilter::RequestData(vtkInformation* info,
         vtkInformationVector** inputVector,
         vtkInformationVector* outputVector) {
@@ -28,75 +147,118 @@ int AbstractSelectionFilter::RequestData(vtkInformation* info,
 	vtkPolyData* output = vtkPolyData::SafeDownCast(outputInformation->Get(
 	                          vtkDataObject::DATA_OBJECT()));
 
-	// Create a list of the indices of all points that should be kept by evaluating each one
-	QList<int> selectedPoints;
-
-	for (int i = 0; i < inputData->GetNumberOfPoints(); i++) {
-		double coordinates[3];
-		inputData->GetPoint(i, coordinates);
-		if (this->evaluatePoint(i, Coordinate(coordinates[0], coordinates[1]), inputData->GetPointData())) {
-			selectedPoints.append(i);
+	// Let the concrete filter decide which points should be kept
+	vtkIdType amountOfPoints = inputData->GetNumberOfPoints();
+	std::vector<unsigned char> selection(amountOfPoints, 0);
+	this->evaluatePoints(inputData, selection);
+
+	// Each thread counts the selected points of a contiguous range of the input, which tells it
+	// where the range's points start in the output, so that the output keeps the input's order
+	int amountOfThreads = Threads::getAmountOfThreads(amountOfPoints, MINIMUM_POINTS_PER_THREAD);
+	std::vector<vtkIdType> outputBegins(amountOfThreads + 1, 0);
+	Threads::run(amountOfThreads, [&](int thread) {
+		vtkIdType begin = amountOfPoints * thread / amountOfThreads;
+		vtkIdType end = amountOfPoints * (thread + 1) / amountOfThreads;
+		vtkIdType count = 0;
+		for (vtkIdType i = begin; i < end; i++) {
+			count += selection[i] != 0;
 		}
+		outputBegins[thread + 1] = count;
+	});
+	for (int thread = 0; thread < amountOfThreads; thread++) {
+		outputBegins[thread + 1] += outputBegins[thread];
 	}
+	vtkIdType amountOfSelectedPoints = outputBegins[amountOfThreads];
 
-	// Create the content of the output poly data object
+	// Create the content of the output poly data object, keeping the input's coordinate type
 	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-	vtkSmartPointer<vtkCellArray> vertices = vtkSmartPointer<vtkCellArray>::New();
-	vertices->Allocate(vertices->EstimateSize(1, selectedPoints.size()));
-	vertices->InsertNextCell(selectedPoints.size());
-
-	// Create all arrays from the input data
-	QList<vtkSmartPointer<vtkAbstractArray>> inputArrays;
-	QList<vtkSmartPointer<vtkAbstractArray>> outputArrays;
+	if (inputData->GetPoints()) {
+		points->SetDataType(inputData->GetPoints()->GetDataType());
+		points->SetNumberOfPoints(amountOfSelectedPoints);
+	}
 
+	// All points form a single poly vertex cell, stored as its size followed by the point indices
+	vtkSmartPointer<vtkIdTypeArray> cellIndices = vtkSmartPointer<vtkIdTypeArray>::New();
+	cellIndices->SetNumberOfValues(amountOfSelectedPoints + 1);
+	vtkIdType* cellIndex = cellIndices->GetPointer(0);
+	cellIndex[0] = amountOfSelectedPoints;
+
+	// Create all arrays from the input data with one tuple for each selected point
+	std::vector<vtkAbstractArray*> inputArrays;
+	std::vector<vtkSmartPointer<vtkAbstractArray>> outputArrays;
+	if (inputData->GetPoints()) {
+		inputArrays.push_back(inputData->GetPoints()->GetData());
+		outputArrays.push_back(points->GetData());
+	}
+	size_t firstPointDataArray = outputArrays.size();
 	for (int i = 0; i < inputData->GetPointData()->GetNumberOfArrays(); i++) {
-		vtkSmartPointer<vtkAbstractArray> inputArray = inputData->GetPointData()->GetAbstractArray(i);
+		vtkAbstractArray* inputArray = inputData->GetPointData()->GetAbstractArray(i);
 
 		if (!inputArray) {
 			this->fail("An input array could not be read.");
 			return 0;
 		}
 
-		vtkSmartPointer<vtkAbstractArray> outputArray = vtkAbstractArray::CreateArray(
-		            inputArray->GetDataType());
+		vtkSmartPointer<vtkAbstractArray> outputArray = vtkSmartPointer<vtkAbstractArray>::Take(
+		            vtkAbstractArray::CreateArray(inputArray->GetDataType()));
 
 		outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
-		outputArray->SetNumberOfTuples(selectedPoints.size());
+		outputArray->SetNumberOfTuples(amountOfSelectedPoints);
 		outputArray->SetName(inputArray->GetName());
 
-		inputArrays.append(inputArray);
-		outputArrays.append(outputArray);
+		inputArrays.push_back(inputArray);
+		outputArrays.push_back(outputArray);
 	}
 
-	// Fill the output poly data object with the coordinates of all selected points
-	QList<int>::iterator i;
-	int tupleNumber = 0;
-	for (i = selectedPoints.begin(); i != selectedPoints.end(); ++i) {
-		double coordinates[3];
-		inputData->GetPoint(*i, coordinates);
-		vertices->InsertCellPoint(points->InsertNextPoint(coordinates[0], coordinates[1], coordinates[2]));
+	// Each thread collects the indices of its range's selected points and copies their tuples
+	// into its part of the output arrays
+	std::vector<vtkIdType> selectedPoints(amountOfSelectedPoints);
+	Threads::run(amountOfThreads, [&](int thread) {
+		vtkIdType begin = amountOfPoints * thread / amountOfThreads;
+		vtkIdType end = amountOfPoints * (thread + 1) / amountOfThreads;
+		vtkIdType outputIndex = outputBegins[thread];
+		for (vtkIdType i = begin; i < end; i++) {
+			if (selection[i]) {
+				selectedPoints[outputIndex] = i;
+				cellIndex[outputIndex + 1] = outputIndex;
+				outputIndex++;
+			}
+		}
 
-		// Copy over all scalars
-		for (int j = 0; j < inputArrays.size(); j++) {
-			outputArrays.at(j)->SetTuple(tupleNumber, *i, inputArrays.at(j));
+		for (size_t a = 0; a < inputArrays.size(); a++) {
+			if (canBeGatheredInParallel(inputArrays[a])) {
+				gatherArray(inputArrays[a], outputArrays[a], selectedPoints, outputBegins[thread],
+				            outputBegins[thread + 1]);
+			}
 		}
+	});
 
-		tupleNumber++;
+	// Arrays without plain values, such as bit arrays, are copied tuple by tuple
+	for (size_t a = 0; a < inputArrays.size(); a++) {
+		if (!canBeGatheredInParallel(inputArrays[a])) {
+			for (vtkIdType i = 0; i < amountOfSelectedPoints; i++) {
+				outputArrays[a]->SetTuple(i, selectedPoints[i], inputArrays[a]);
+			}
+		}
 	}
 
-	// Assign the created point set to the output object
+	vtkSmartPointer<vtkCellArray> vertices = vtkSmartPointer<vtkCellArray>::New();
+	vertices->SetCells(1, cellIndices);
+
+	// Assign the created point set and arrays to the output object
 	output->SetPoints(points);
 	output->SetVerts(vertices);
-
-	// Add the output arrays to the data set
-	QList<vtkSmartPointer<vtkAbstractArray>>::iterator j;
-	for (j = outputArrays.begin(); j != outputArrays.end(); ++j) {
-		output->GetPointData()->AddArray(*j);
+	for (size_t a = firstPointDataArray; a < outputArrays.size(); a++) {
+		output->GetPointData()->AddArray(outputArrays[a]);
 	}
 
+	// Keep arrays describing the whole data set, such as dictionaries of interned strings
+	output->GetFieldData()->PassData(inputData->GetFieldData());
+
 	return 1;
 }
 
+
 int AbstractSelectionFilter::RequestInformation(vtkInformation* request,
         vtkInformationVector** inputVector,
         vtkInformationVector* outputVector) {
@@ -2,6 +2,7 @@
 #define KRONOS_ABSTRACT_SELECTION_FILTER_HPP
 
 #include <vtkPoints.h>
+#include <vtkPointSet.h>
 #include <vtkSmartPointer.h>
 #include <vtkDataObjectAlgorithm.h>
 #include <vtkInformation.h>
@@ -11,8 +12,13 @@
 #include <qstring.h>
 #include <qlist.h>
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include <Reader/DataReader/Data.hpp>
 #include <Globe/Coordinate.hpp>
+#include <Filter/AbstractSelectionFilter/BlockSummaries.hpp>
 
 /**
  * Abstract super class for filters that work on a Kronos point data set and extract some of those points.
@@ -40,13 +46,14 @@ public:
 	virtual QList<Data::Type> getCompatibleDataTypes() = 0;
 
 	/**
-	 * Decide whether a data point should be kept in the selection.
-	 * @param pointIndex The index of the point to be checked
-	 * @param coordinate The coordinate of the point
-	 * @param pointData All scalar point data
-	 * @return True if the point should be kept, false otherwise
+	 * Decide for all points of a data set at once which of them should be kept in the selection.
+	 * Filters look up the arrays they need once and test their values directly, e.g. by using
+	 * `getValues`.
+	 * @param inputData The data set whose points are evaluated
+	 * @param selection Holds a zero for each point of the data set, to be set to one for each
+	 * point that should be kept
 	 */
-	virtual bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData) = 0;
+	virtual void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection) = 0;
 
 	/**
 	 * Display an error message and remember that this filter does not hold valid data.
@@ -54,9 +61,63 @@ public:
 	 */
 	void fail(QString message);
 
+protected:
+	/**
+	 * Look up a point data array of a certain type and get its values.
+	 * @param inputData The data set holding the array
+	 * @param name The name of the array
+	 * @return The array's values, or a null pointer if the data set has no array of that type and
+	 * name with a single value for each point
+	 */
+	template<typename ArrayType>
+	static const typename ArrayType::ValueType* getValues(vtkPointSet* inputData, const char* name);
+
+	/**
+	 * Get the minimum and maximum values of each block of a point data array. They are computed
+	 * once and cached until the input holds a different or modified array, so that moving a
+	 * threshold only compares the limits with them.
+	 * @param inputData The data set holding the array
+	 * @param name The name of the array
+	 * @return The summaries of the array's blocks, or a null pointer if the data set has no array
+	 * of that name with a single value for each point, or none of a type that can be summarized
+	 */
+	const BlockSummaries* getBlockSummaries(vtkPointSet* inputData, const char* name);
+
 private:
 	AbstractSelectionFilter(const AbstractSelectionFilter&);  // Not implemented.
 	void operator=(const AbstractSelectionFilter&);  // Not implemented.
+
+	/**
+	 * The summaries of an array along with what identifies the array they were computed from.
+	 */
+	struct CachedSummaries {
+		vtkAbstractArray* array;
+
+		/**
+		 * The array's modification time when it was summarized
+		 */
+		unsigned long modifiedTime;
+
+		BlockSummaries summaries;
+	};
+
+	/**
+	 * The cached block summaries of each array by its name.
+	 */
+	std::map<std::string, CachedSummaries> blockSummaries;
 };
 
+template<typename ArrayType>
+const typename ArrayType::ValueType* AbstractSelectionFilter::getValues(vtkPointSet* inputData,
+        const char* name) {
+	ArrayType* array = ArrayType::SafeDownCast(inputData->GetPointData()->GetAbstractArray(name));
+
+	if (!array || array->GetNumberOfComponents() != 1
+	        || array->GetNumberOfTuples() < inputData->GetNumberOfPoints()) {
+		return nullptr;
+	}
+
+	return array->GetPointer(0);
+}
+
 #endif
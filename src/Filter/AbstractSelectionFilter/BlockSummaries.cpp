@@ -0,0 +1,70 @@
+#include <Filter/AbstractSelectionFilter/BlockSummaries.hpp>
+
+#include <algorithm>
+#include <limits>
+
+const size_t BlockSummaries::BLOCK_SIZE;
+
+BlockSummaries::BlockSummaries() : valueCount(0) { }
+BlockSummaries::~BlockSummaries() { }
+
+void BlockSummaries::summarize(const float* values, size_t count) {
+	this->summarizeValues(values, count);
+}
+
+void BlockSummaries::summarize(const double* values, size_t count) {
+	this->summarizeValues(values, count);
+}
+
+void BlockSummaries::summarize(const unsigned int* values, size_t count) {
+	this->summarizeValues(values, count);
+}
+
+void BlockSummaries::summarize(const unsigned char* values, size_t count) {
+	this->summarizeValues(values, count);
+}
+
+template<typename ValueType>
+void BlockSummaries::summarizeValues(const ValueType* values, size_t count) {
+	size_t blockCount = (count + BlockSummaries::BLOCK_SIZE - 1) / BlockSummaries::BLOCK_SIZE;
+	this->valueCount = count;
+	this->minima.assign(blockCount, std::numeric_limits<double>::infinity());
+	this->maxima.assign(blockCount, -std::numeric_limits<double>::infinity());
+	this->containsNaN.assign(blockCount, 0);
+
+	for (size_t block = 0; block < blockCount; block++) {
+		size_t first = block * BlockSummaries::BLOCK_SIZE;
+		size_t last = std::min(first + BlockSummaries::BLOCK_SIZE, count);
+
+		double minimum = this->minima[block];
+		double maximum = this->maxima[block];
+		bool nan = false;
+		for (size_t i = first; i < last; i++) {
+			double value = values[i];
+			// NaN values fail every comparison, so they only need to be detected
+			nan |= value != value;
+			minimum = value < minimum ? value : minimum;
+			maximum = value > maximum ? value : maximum;
+		}
+
+		this->minima[block] = minimum;
+		this->maxima[block] = maximum;
+		this->containsNaN[block] = nan;
+	}
+}
+
+size_t BlockSummaries::getValueCount() const {
+	return this->valueCount;
+}
+
+BlockSummaries::Coverage BlockSummaries::getCoverage(size_t block, double lowerLimit,
+        double upperLimit) const {
+	if (this->maxima[block] < lowerLimit || this->minima[block] > upperLimit) {
+		return BlockSummaries::OUTSIDE;
+	}
+	if (!this->containsNaN[block] && lowerLimit <= this->minima[block]
+	        && this->maxima[block] <= upperLimit) {
+		return BlockSummaries::INSIDE;
+	}
+	return BlockSummaries::OVERLAPPING;
+}
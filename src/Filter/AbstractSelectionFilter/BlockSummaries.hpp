@@ -0,0 +1,100 @@
+#ifndef KRONOS_BLOCK_SUMMARIES_HPP
+#define KRONOS_BLOCK_SUMMARIES_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Summarizes a column of values by the minimum and maximum of each block of `BLOCK_SIZE` values,
+ * matching the blocks of a `RangeSelection`. Comparing an interval with these bounds tells whether
+ * a block lies entirely within or outside of it without looking at its values, which skips most
+ * blocks of sorted or spatially coherent data.
+ */
+class BlockSummaries {
+
+public:
+	/**
+	 * How the values of a block relate to an interval.
+	 */
+	enum Coverage {
+		/**
+		 * No value of the block lies within the interval.
+		 */
+		OUTSIDE,
+		/**
+		 * All values of the block lie within the interval.
+		 */
+		INSIDE,
+		/**
+		 * The values of the block need to be tested one by one.
+		 */
+		OVERLAPPING
+	};
+
+	/**
+	 * The amount of values summarized by each block.
+	 */
+	static const size_t BLOCK_SIZE = 4096;
+
+	/**
+	 * Create new, empty BlockSummaries.
+	 */
+	BlockSummaries();
+	~BlockSummaries();
+
+	/**
+	 * Summarize the blocks of a column, replacing any previous summaries.
+	 * @param values The values of the column
+	 * @param count The amount of values
+	 */
+	void summarize(const float* values, size_t count);
+	void summarize(const double* values, size_t count);
+	void summarize(const unsigned int* values, size_t count);
+	void summarize(const unsigned char* values, size_t count);
+
+	/**
+	 * Get the amount of values that have been summarized.
+	 * @return The amount of values in the column
+	 */
+	size_t getValueCount() const;
+
+	/**
+	 * Compare the values of a block with a closed interval.
+	 * @param block The index of the block
+	 * @param lowerLimit The lower limit of the interval
+	 * @param upperLimit The upper limit of the interval
+	 * @return How the values of the block relate to the interval
+	 */
+	Coverage getCoverage(size_t block, double lowerLimit, double upperLimit) const;
+
+private:
+	/**
+	 * Summarize the blocks of a column of any type.
+	 * @param values The values of the column
+	 * @param count The amount of values
+	 */
+	template<typename ValueType>
+	void summarizeValues(const ValueType* values, size_t count);
+
+	/**
+	 * The amount of values that have been summarized.
+	 */
+	size_t valueCount;
+
+	/**
+	 * The smallest value of each block, ignoring NaN values.
+	 */
+	std::vector<double> minima;
+
+	/**
+	 * The largest value of each block, ignoring NaN values.
+	 */
+	std::vector<double> maxima;
+
+	/**
+	 * Whether each block contains any NaN values, which never lie within an interval.
+	 */
+	std::vector<unsigned char> containsNaN;
+};
+
+#endif
@@ -0,0 +1,200 @@
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+// The build targets the baseline instruction set, so GCC additionally compiles the passes for
+// AVX2 and picks the variant matching the processor when the plugin is loaded. Compilers without
+// support for target_clones, which GCC introduced in version 6, get the baseline passes only
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6 && defined(__x86_64__) \
+	&& defined(__linux__)
+#define KRONOS_VECTORIZED_PASS __attribute__((target_clones("avx2", "default")))
+#else
+#define KRONOS_VECTORIZED_PASS
+#endif
+
+/**
+ * Clear the selection of all points whose values lie outside of a closed interval. The loop body
+ * is free of branches and the arrays are declared not to overlap, so that it is vectorized without
+ * any runtime checks. The points are split into a part whose length is a multiple of any vector
+ * width and a scalar remainder, which lets the cheap vectorization of -O2 handle the first part.
+ * @param values The values of the points
+ * @param lowerLimit The lower limit of the interval
+ * @param upperLimit The upper limit of the interval
+ * @param selection The selection of the points
+ * @param count The amount of points
+ */
+template<typename ValueType>
+static inline void restrictToRange(const ValueType* __restrict values, ValueType lowerLimit,
+                                   ValueType upperLimit, unsigned char* __restrict selection,
+                                   size_t count) {
+	size_t vectorizedCount = count & ~(size_t) 63;
+	for (size_t i = 0; i < vectorizedCount; i++) {
+		selection[i] &= (unsigned char) ((values[i] >= lowerLimit) & (values[i] <= upperLimit));
+	}
+	for (size_t i = vectorizedCount; i < count; i++) {
+		selection[i] &= (unsigned char) ((values[i] >= lowerLimit) & (values[i] <= upperLimit));
+	}
+}
+
+KRONOS_VECTORIZED_PASS
+static void restrictFloats(const float* values, float lowerLimit, float upperLimit,
+                           unsigned char* selection, size_t count) {
+	restrictToRange(values, lowerLimit, upperLimit, selection, count);
+}
+
+KRONOS_VECTORIZED_PASS
+static void restrictDoubles(const double* values, double lowerLimit, double upperLimit,
+                            unsigned char* selection, size_t count) {
+	restrictToRange(values, lowerLimit, upperLimit, selection, count);
+}
+
+KRONOS_VECTORIZED_PASS
+static void restrictUnsignedInts(const unsigned int* values, unsigned int lowerLimit,
+                                 unsigned int upperLimit, unsigned char* selection, size_t count) {
+	restrictToRange(values, lowerLimit, upperLimit, selection, count);
+}
+
+KRONOS_VECTORIZED_PASS
+static void restrictUnsignedChars(const unsigned char* values, unsigned char lowerLimit,
+                                  unsigned char upperLimit, unsigned char* selection,
+                                  size_t count) {
+	restrictToRange(values, lowerLimit, upperLimit, selection, count);
+}
+
+/**
+ * Find the smallest float that is not below a limit.
+ * @param limit The limit
+ * @return The smallest float greater than or equal to the limit
+ */
+static float toFloatAtLeast(double limit) {
+	if (limit > FLT_MAX) {
+		return std::numeric_limits<float>::infinity();
+	}
+	if (limit < -FLT_MAX) {
+		return std::isinf(limit) ? -std::numeric_limits<float>::infinity() : -FLT_MAX;
+	}
+
+	float rounded = (float) limit;
+	if (rounded < limit) {
+		rounded = std::nextafter(rounded, std::numeric_limits<float>::infinity());
+	}
+	return rounded;
+}
+
+/**
+ * Find the largest float that is not above a limit.
+ * @param limit The limit
+ * @return The largest float less than or equal to the limit
+ */
+static float toFloatAtMost(double limit) {
+	return -toFloatAtLeast(-limit);
+}
+
+/**
+ * Narrow the limits of an interval to the smallest and largest integers of a type within it.
+ * @param lowerLimit The lower limit, which is replaced by the smallest integer
+ * @param upperLimit The upper limit, which is replaced by the largest integer
+ */
+template<typename IntegerType>
+static void toIntegerLimits(double& lowerLimit, double& upperLimit) {
+	lowerLimit = std::max(std::ceil(lowerLimit), (double) std::numeric_limits<IntegerType>::min());
+	upperLimit = std::min(std::floor(upperLimit), (double) std::numeric_limits<IntegerType>::max());
+}
+
+const size_t RangeSelection::BLOCK_SIZE;
+
+RangeSelection::RangeSelection() { }
+RangeSelection::~RangeSelection() { }
+
+void RangeSelection::addRange(const float* values, double lowerLimit, double upperLimit,
+                              const BlockSummaries* summaries) {
+	Range range = { RangeSelection::FLOAT, values, toFloatAtLeast(lowerLimit),
+	                toFloatAtMost(upperLimit), false, summaries
+	              };
+	range.empty = std::isnan(lowerLimit) || std::isnan(upperLimit)
+	              || range.lowerLimit > range.upperLimit;
+	this->ranges.push_back(range);
+}
+
+void RangeSelection::addRange(const double* values, double lowerLimit, double upperLimit,
+                              const BlockSummaries* summaries) {
+	Range range = { RangeSelection::DOUBLE, values, lowerLimit, upperLimit, false,
+	                summaries
+	              };
+	range.empty = !(range.lowerLimit <= range.upperLimit);
+	this->ranges.push_back(range);
+}
+
+void RangeSelection::addRange(const unsigned int* values, double lowerLimit, double upperLimit,
+                              const BlockSummaries* summaries) {
+	Range range = { RangeSelection::UNSIGNED_INT, values, lowerLimit, upperLimit, false,
+	                summaries
+	              };
+	toIntegerLimits<unsigned int>(range.lowerLimit, range.upperLimit);
+	range.empty = !(range.lowerLimit <= range.upperLimit);
+	this->ranges.push_back(range);
+}
+
+void RangeSelection::addRange(const unsigned char* values, double lowerLimit, double upperLimit,
+                              const BlockSummaries* summaries) {
+	Range range = { RangeSelection::UNSIGNED_CHAR, values, lowerLimit, upperLimit, false,
+	                summaries
+	              };
+	toIntegerLimits<unsigned char>(range.lowerLimit, range.upperLimit);
+	range.empty = !(range.lowerLimit <= range.upperLimit);
+	this->ranges.push_back(range);
+}
+
+void RangeSelection::select(unsigned char* selection, size_t count) const {
+	for (size_t block = 0; block * RangeSelection::BLOCK_SIZE < count; block++) {
+		size_t first = block * RangeSelection::BLOCK_SIZE;
+		size_t blockSize = std::min(RangeSelection::BLOCK_SIZE, count - first);
+		unsigned char* blockSelection = selection + first;
+		std::fill(blockSelection, blockSelection + blockSize, 1);
+
+		for (size_t r = 0; r < this->ranges.size(); r++) {
+			const Range& range = this->ranges[r];
+			BlockSummaries::Coverage coverage = BlockSummaries::OVERLAPPING;
+			if (range.empty) {
+				coverage = BlockSummaries::OUTSIDE;
+			} else if (range.summaries && range.summaries->getValueCount() == count) {
+				coverage = range.summaries->getCoverage(block, range.lowerLimit, range.upperLimit);
+			}
+
+			if (coverage == BlockSummaries::OUTSIDE) {
+				std::fill(blockSelection, blockSelection + blockSize, 0);
+				break;
+			}
+			if (coverage == BlockSummaries::OVERLAPPING) {
+				RangeSelection::restrictBlock(range, first, blockSize, blockSelection);
+			}
+		}
+	}
+}
+
+void RangeSelection::restrictBlock(const Range& range, size_t first, size_t count,
+                                   unsigned char* selection) {
+	switch (range.type) {
+	case RangeSelection::FLOAT:
+		restrictFloats(static_cast<const float*>(range.values) + first, (float) range.lowerLimit,
+		               (float) range.upperLimit, selection, count);
+		break;
+	case RangeSelection::DOUBLE:
+		restrictDoubles(static_cast<const double*>(range.values) + first, range.lowerLimit,
+		                range.upperLimit, selection, count);
+		break;
+	case RangeSelection::UNSIGNED_INT:
+		restrictUnsignedInts(static_cast<const unsigned int*>(range.values) + first,
+		                     (unsigned int) range.lowerLimit, (unsigned int) range.upperLimit,
+		                     selection, count);
+		break;
+	case RangeSelection::UNSIGNED_CHAR:
+		restrictUnsignedChars(static_cast<const unsigned char*>(range.values) + first,
+		                      (unsigned char) range.lowerLimit, (unsigned char) range.upperLimit,
+		                      selection, count);
+		break;
+	}
+}
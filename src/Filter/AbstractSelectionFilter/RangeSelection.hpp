@@ -0,0 +1,96 @@
+#ifndef KRONOS_RANGE_SELECTION_HPP
+#define KRONOS_RANGE_SELECTION_HPP
+
+#include <Filter/AbstractSelectionFilter/BlockSummaries.hpp>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Selects the points whose values lie within a closed interval in each of several columns, as
+ * used by the threshold filters.
+ *
+ * Each interval is converted to the value type of its column once, so that every column is
+ * tested by a branch-free compare-and-mask pass over its raw values which the compiler turns into
+ * SIMD instructions. The passes are run block by block, so that the selection mask they are ANDed
+ * into stays in the cache while all columns are applied. Given the `BlockSummaries` of a column,
+ * blocks lying entirely within an interval skip its pass and blocks lying entirely outside of it
+ * are cleared without testing any further columns.
+ */
+class RangeSelection {
+
+public:
+	/**
+	 * The amount of points tested by all passes before moving on to the next ones.
+	 */
+	static const size_t BLOCK_SIZE = BlockSummaries::BLOCK_SIZE;
+
+	/**
+	 * Create a new RangeSelection without any intervals, selecting all points.
+	 */
+	RangeSelection();
+	~RangeSelection();
+
+	/**
+	 * Require the values of a column to lie within a closed interval. NaN values never do.
+	 * @param values The values of the column, which have to outlive this object
+	 * @param lowerLimit The lower limit of the interval
+	 * @param upperLimit The upper limit of the interval
+	 * @param summaries The summaries of the column's blocks, which have to outlive this object, or
+	 * a null pointer to test all values
+	 */
+	void addRange(const float* values, double lowerLimit, double upperLimit,
+	              const BlockSummaries* summaries = nullptr);
+	void addRange(const double* values, double lowerLimit, double upperLimit,
+	              const BlockSummaries* summaries = nullptr);
+	void addRange(const unsigned int* values, double lowerLimit, double upperLimit,
+	              const BlockSummaries* summaries = nullptr);
+	void addRange(const unsigned char* values, double lowerLimit, double upperLimit,
+	              const BlockSummaries* summaries = nullptr);
+
+	/**
+	 * Select the points whose values lie within all intervals.
+	 * @param selection 1 is written here for each selected point and 0 for all others
+	 * @param count The amount of points, which all columns need to have
+	 */
+	void select(unsigned char* selection, size_t count) const;
+
+private:
+	/**
+	 * The value types of the columns.
+	 */
+	enum ValueType {
+		FLOAT, DOUBLE, UNSIGNED_INT, UNSIGNED_CHAR
+	};
+
+	/**
+	 * An interval of a column, whose limits are the smallest and largest values of the column's
+	 * type lying within the requested interval and thus exactly representable as doubles.
+	 */
+	struct Range {
+		ValueType type;
+		const void* values;
+		double lowerLimit;
+		double upperLimit;
+		bool empty;
+		const BlockSummaries* summaries;
+	};
+
+	/**
+	 * Apply an interval to a block of points.
+	 * @param range The interval
+	 * @param first The index of the block's first point
+	 * @param count The amount of points in the block
+	 * @param selection The selection of the block, which is cleared for all points outside of the
+	 * interval
+	 */
+	static void restrictBlock(const Range& range, size_t first, size_t count,
+	                          unsigned char* selection);
+
+	/**
+	 * The intervals all selected points lie within.
+	 */
+	std::vector<Range> ranges;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include <vtkDataObjectAlgorithm.h>
 #include "CLaMSFilter.h"
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include <vtkThreshold.h>
@@ -33,40 +34,34 @@ QList<Data::Type> CLaMSFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>());
 }
 
-bool CLaMSFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-                                vtkPointData* pointData) {
-	vtkSmartPointer<vtkDoubleArray> timeArray = vtkDoubleArray::SafeDownCast(
-	            pointData->GetAbstractArray("time"));
-	vtkSmartPointer<vtkFloatArray> altitudeArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("altitude"));
-	vtkSmartPointer<vtkFloatArray> temperatureArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("temperature"));
-	vtkSmartPointer<vtkFloatArray> pressureArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("pressure"));
-	vtkSmartPointer<vtkFloatArray> vorticityArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("pot_vorticity"));
-	vtkSmartPointer<vtkFloatArray> potTemperatureArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("pot_temperature"));
+void CLaMSFilter::evaluatePoints(vtkPointSet* inputData,
+                                 std::vector<unsigned char>& selection) {
+	const double* times = getValues<vtkDoubleArray>(inputData, "time");
+	const float* altitudes = getValues<vtkFloatArray>(inputData, "altitude");
+	const float* temperatures = getValues<vtkFloatArray>(inputData, "temperature");
+	const float* pressures = getValues<vtkFloatArray>(inputData, "pressure");
+	const float* vorticities = getValues<vtkFloatArray>(inputData, "pot_vorticity");
+	const float* potTemperatures = getValues<vtkFloatArray>(inputData, "pot_temperature");
 
-	if (!timeArray || !altitudeArray || !temperatureArray || !pressureArray || !vorticityArray
-	        || !potTemperatureArray) {
-		return false;
+	if (!times || !altitudes || !temperatures || !pressures || !vorticities || !potTemperatures) {
+		return;
 	}
 
-	double time = timeArray->GetTuple1(pointIndex);
-	float altitude = altitudeArray->GetTuple1(pointIndex);
-	float temperature = temperatureArray->GetTuple1(pointIndex);
-	float pressure = pressureArray->GetTuple1(pointIndex);
-	float vorticity = vorticityArray->GetTuple1(pointIndex);
-	float potTemperature = potTemperatureArray->GetTuple1(pointIndex);
-
-	return (this->lowerTimeLimit <= time && time <= this->upperTimeLimit)
-	       && (this->lowerAltitudeLimit <= altitude && altitude <= this->upperAltitudeLimit) &&
-	       (this->lowerTemperatureLimit <= temperature && temperature <= this->upperTemperatureLimit)
-	       && (this->lowerPressureLimit <= pressure && pressure <= this->upperPressureLimit)
-	       && (this->lowerVorticityLimit <= vorticity && vorticity <= this->upperVorticityLimit)
-	       && (this->lowerPotTemperatureLimit <= potTemperature
-	           && potTemperature <= this->upperPotTemperatureLimit);
+	RangeSelection rangeSelection;
+	rangeSelection.addRange(times, this->lowerTimeLimit, this->upperTimeLimit,
+	                        this->getBlockSummaries(inputData, "time"));
+	rangeSelection.addRange(altitudes, this->lowerAltitudeLimit, this->upperAltitudeLimit,
+	                        this->getBlockSummaries(inputData, "altitude"));
+	rangeSelection.addRange(temperatures, this->lowerTemperatureLimit, this->upperTemperatureLimit,
+	                        this->getBlockSummaries(inputData, "temperature"));
+	rangeSelection.addRange(pressures, this->lowerPressureLimit, this->upperPressureLimit,
+	                        this->getBlockSummaries(inputData, "pressure"));
+	rangeSelection.addRange(vorticities, this->lowerVorticityLimit, this->upperVorticityLimit,
+	                        this->getBlockSummaries(inputData, "pot_vorticity"));
+	rangeSelection.addRange(potTemperatures, this->lowerPotTemperatureLimit,
+	                        this->upperPotTemperatureLimit,
+	                        this->getBlockSummaries(inputData, "pot_temperature"));
+	rangeSelection.select(selection.data(), selection.size());
 }
 
 void CLaMSFilter::SetInputConnection(vtkAlgorithmOutput* input) {
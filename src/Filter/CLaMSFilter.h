@@ -83,7 +83,7 @@ private:
 	CLaMSFilter(const CLaMSFilter&); //Not implemented
 	void operator=(const CLaMSFilter&); //Not implemented
 	QList<Data::Type> getCompatibleDataTypes() override;
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData) override;
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection) override;
 
 	/**
 	 * the upper Limit for the Time
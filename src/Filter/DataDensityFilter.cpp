@@ -1,21 +1,23 @@
 #include <Filter/DataDensityFilter.h>
+#include <Filter/DataDensityFilter/KMeansClustering.hpp>
+#include <Filter/DataDensityFilter/PointClustering.hpp>
+#include <Reader/DataReader/Data.hpp>
+#include <Utils/Misc/Threads.hpp>
 
 #include <vtkDataObject.h>
-#include <vtkKMeansStatistics.h>
-#include <vtkDoubleArray.h>
-#include <vtkTable.h>
 #include <vtkCellArray.h>
-#include <vtkMultiBlockDataSet.h>
 #include <vtkObjectFactory.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkPointData.h>
 #include <vtkAbstractArray.h>
+#include <vtkDataArray.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkCleanUnstructuredGrid.h>
 
-#include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include <qmap.h>
 
@@ -46,7 +48,8 @@ int DataDensityFilter::RequestData(vtkInformation* info,
 	// Get the actual objects from the obtained information
 	vtkPointSet* input = vtkPointSet::SafeDownCast(inInfo->Get(vtkPolyData::DATA_OBJECT()));
 
-	vtkSmartPointer<vtkCleanUnstructuredGrid> cleanFilter = vtkCleanUnstructuredGrid::New();
+	vtkSmartPointer<vtkCleanUnstructuredGrid> cleanFilter =
+	    vtkSmartPointer<vtkCleanUnstructuredGrid>::New();
 	cleanFilter->SetInputData(input);
 	cleanFilter->Update();
 
@@ -60,7 +63,10 @@ int DataDensityFilter::RequestData(vtkInformation* info,
 
 	// Depending on the checkbox either use the kMeans or the simple algorithm
 	if (kMeansEnabled) {
-		reducedDataPoints = this->reducePointsKMeans(cleanedInput);
+		// Points that have not been transformed yet are given as longitude and latitude
+		bool geographic = !inInfo->Has(Data::VTK_DATA_TRANSFORMATION())
+		                  || inInfo->Get(Data::VTK_DATA_TRANSFORMATION()) == Data::UNTRANSFORMED;
+		reducedDataPoints = this->reducePointsKMeans(cleanedInput, geographic);
 	} else {
 		reducedDataPoints = this->reducePointsSimple(cleanedInput);
 	}
@@ -85,75 +91,29 @@ void DataDensityFilter::PrintSelf(ostream& os, vtkIndent indent) {
 	os << indent << "Twitter Filter, Kronos Project" << endl;
 }
 
-DataDensityFilter::PointMap DataDensityFilter::reducePointsKMeans(vtkPointSet* input) {
-	// Get the points into the format needed for KMeans
-	vtkSmartPointer<vtkTable> inputData = vtkSmartPointer<vtkTable>::New();
-
-	// Create the table needed for the KMeans statistics filter
-	for (int c = 0; c < 3; ++c) {
-		std::stringstream colName;
-		colName << "coord " << c;
-		vtkSmartPointer<vtkDoubleArray> doubleArray =
-		    vtkSmartPointer<vtkDoubleArray>::New();
-		doubleArray->SetNumberOfComponents(1);
-		doubleArray->SetName(colName.str().c_str());
-		doubleArray->SetNumberOfTuples(input->GetNumberOfPoints());
-
-		for (int r = 0; r < input->GetNumberOfPoints(); ++r) {
-			double p[3];
-			input->GetPoint(r, p);
-			doubleArray->SetValue(r, p[c]);
-		}
-		inputData->AddColumn(doubleArray);
-	}
-
-	// Actually do the KMeans to calculate the centroids for the clusters
-	vtkSmartPointer<vtkKMeansStatistics> kMeansStatistics =
-	    vtkSmartPointer<vtkKMeansStatistics>::New();
-
-	kMeansStatistics->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, inputData);
-	kMeansStatistics->SetColumnStatus(inputData->GetColumnName(0), 1);
-	kMeansStatistics->SetColumnStatus(inputData->GetColumnName(1), 1);
-	kMeansStatistics->SetColumnStatus(inputData->GetColumnName(2), 1);
-	kMeansStatistics->RequestSelectedColumns();
-
-	// Set the default number of clusters to the number of points that should be kept
-	kMeansStatistics->SetDefaultNumberOfClusters(std::max(int((1 - this->dataPercentage) *
-	        input->GetNumberOfPoints()), 1));
-
-	// Make the filter only do one iteration for a better performance since we do not need a precise kMeans approximation
-	kMeansStatistics->SetMaxNumIterations(1);
-	kMeansStatistics->SetAssessOption(true);
-	kMeansStatistics->Update();
-
-	// Extract the calculated cluster centers from the filter
-	vtkSmartPointer<vtkPoints> centroids =
-	    vtkSmartPointer<vtkPoints>::New();
+DataDensityFilter::PointMap DataDensityFilter::reducePointsKMeans(vtkPointSet* input,
+        bool geographic) {
+	int numberOfPoints = input->GetNumberOfPoints();
 
-	vtkMultiBlockDataSet* outputMetaDS = vtkMultiBlockDataSet::SafeDownCast(
-	        kMeansStatistics->GetOutputDataObject(vtkStatisticsAlgorithm::OUTPUT_MODEL));
-	vtkSmartPointer<vtkTable> outputMeta = vtkTable::SafeDownCast(outputMetaDS->GetBlock(0));
+	std::vector<PointCoordinates> coordinates(numberOfPoints);
+	for (int i = 0; i < numberOfPoints; ++i) {
+		double point[3];
+		input->GetPoint(i, point);
+		coordinates[i] = PointCoordinates(point[0], point[1], point[2]);
+	}
 
-	vtkDoubleArray* coord0 = vtkDoubleArray::SafeDownCast(outputMeta->GetColumnByName("coord 0"));
-	vtkDoubleArray* coord1 = vtkDoubleArray::SafeDownCast(outputMeta->GetColumnByName("coord 1"));
-	vtkDoubleArray* coord2 = vtkDoubleArray::SafeDownCast(outputMeta->GetColumnByName("coord 2"));
+	// Set the number of clusters to the number of points that should be kept
+	KMeansClustering::Clusters clusters = KMeansClustering::cluster(coordinates,
+	                                      std::max(int((1 - this->dataPercentage) * numberOfPoints), 1), geographic);
 
 	PointMap outputMap;
 
-	// Put the centroids into the map
-	for (int i = 0; i < coord0->GetNumberOfTuples(); ++i) {
-		PointCoordinates centroidCoordinates(coord0->GetValue(i), coord1->GetValue(i), coord2->GetValue(i));
-		QList<int> subordinatePoints;
-
-		// Extract the point IDs in the centroid's bucket
-		for (int r = 0; r < kMeansStatistics->GetOutput()->GetNumberOfRows(); ++r) {
-			vtkVariant v = kMeansStatistics->GetOutput()->GetValue(r,
-			               kMeansStatistics->GetOutput()->GetNumberOfColumns() - 1);
-			if (v.ToInt() == i) {
-				subordinatePoints.append(r);
-			}
+	// Put the centroids and the point IDs in their clusters into the map
+	for (size_t i = 0; i < clusters.centroids.size(); ++i) {
+		QList<int>& subordinatePoints = outputMap[clusters.centroids[i]];
+		for (size_t j = 0; j < clusters.members[i].size(); ++j) {
+			subordinatePoints.append(clusters.members[i][j]);
 		}
-		outputMap.insert(std::make_pair(centroidCoordinates, subordinatePoints));
 	}
 
 	return outputMap;
@@ -179,44 +139,31 @@ DataDensityFilter::PointMap DataDensityFilter::reducePointsSimple(vtkPointSet* i
 
 	double absorptionDistance = this->dataPercentage * (width + height + depth);
 
-	// This data structure maps a point index to a boolean flag denoting whether it has been absorped by a central point or has become a central point
-	std::map<int, bool> pointAbsorptionStatus;
-
-	// In the beginning all points are unabsorbed
+	// Read each point's coordinates only once
+	std::vector<PointCoordinates> coordinates(numberOfPoints);
 	for (int i = 0; i < numberOfPoints; ++i) {
-		pointAbsorptionStatus[i] = false;
+		double point[3];
+		input->GetPoint(i, point);
+		coordinates[i] = PointCoordinates(point[0], point[1], point[2]);
 	}
 
-	QMap<PointCoordinates, int> indices;
-
 	// Generate central points and assign close points to them
-	for (int i = 0; i < numberOfPoints; ++i) {
-		if (pointAbsorptionStatus[i] == false) {
-			double centralPointCoordinatesArray[3];
-			input->GetPoint(i, centralPointCoordinatesArray);
-
-			PointCoordinates centralPointCoordinates(centralPointCoordinatesArray[0],
-			        centralPointCoordinatesArray[1], centralPointCoordinatesArray[2]);
-			QList<int> subordinatePointIndices;
-			pointAbsorptionStatus[i] = true;
-
-			indices[centralPointCoordinates] = i;
-
-			for (int j = 0; j < numberOfPoints; ++j) {
-				if (pointAbsorptionStatus[j] == false) {
-					double subordinatePointCoordinatesArray[3];
-					input->GetPoint(j, subordinatePointCoordinatesArray);
-					PointCoordinates subordinatePointCoordinates(subordinatePointCoordinatesArray[0],
-					        subordinatePointCoordinatesArray[1], subordinatePointCoordinatesArray[2]);
-
-					if (centralPointCoordinates.getDistanceTo(subordinatePointCoordinates) < absorptionDistance) {
-						subordinatePointIndices.append(j);
-						pointAbsorptionStatus[j] = true;
-					}
-				}
-			}
-			outputMap[centralPointCoordinates] = subordinatePointIndices;
+	std::vector<PointClustering::Cluster> clusters = PointClustering::absorbPoints(coordinates,
+	        absorptionDistance);
+
+	std::map<PointCoordinates, int, PointCoordinateComparator> indices;
+
+	for (size_t i = 0; i < clusters.size(); ++i) {
+		const PointCoordinates& centralPointCoordinates = coordinates[clusters[i].centralPoint];
+
+		QList<int> subordinatePointIndices;
+		subordinatePointIndices.reserve(clusters[i].subordinatePoints.size());
+		for (size_t j = 0; j < clusters[i].subordinatePoints.size(); ++j) {
+			subordinatePointIndices.append(clusters[i].subordinatePoints[j]);
 		}
+
+		indices[centralPointCoordinates] = clusters[i].centralPoint;
+		outputMap[centralPointCoordinates] = subordinatePointIndices;
 	}
 
 	typedef PointMap::iterator it_type;
@@ -227,6 +174,61 @@ DataDensityFilter::PointMap DataDensityFilter::reducePointsSimple(vtkPointSet* i
 	return outputMap;
 }
 
+/**
+ * Average the tuples of all members of each cluster.
+ * @param input The values of the input array
+ * @param output The values of the output array, holding one tuple for each cluster
+ * @param numberOfComponents The amount of components of both arrays
+ * @param memberOffsets The position of each cluster's first member in `members`, followed by the
+ * amount of members
+ * @param members The input indices of the members of all clusters, one cluster after another
+ */
+template<typename ValueType>
+static void averageTuples(const ValueType* input, ValueType* output, int numberOfComponents,
+                          const std::vector<int>& memberOffsets, const std::vector<int>& members) {
+	std::vector<double> sums(numberOfComponents);
+
+	for (size_t cluster = 0; cluster + 1 < memberOffsets.size(); ++cluster) {
+		std::fill(sums.begin(), sums.end(), 0.0);
+
+		for (int m = memberOffsets[cluster]; m < memberOffsets[cluster + 1]; ++m) {
+			const ValueType* tuple = input + (size_t) members[m] * numberOfComponents;
+			for (int c = 0; c < numberOfComponents; ++c) {
+				sums[c] += tuple[c];
+			}
+		}
+
+		int count = memberOffsets[cluster + 1] - memberOffsets[cluster];
+		ValueType* outputTuple = output + cluster * numberOfComponents;
+		for (int c = 0; c < numberOfComponents; ++c) {
+			outputTuple[c] = count > 0 ? static_cast<ValueType>(sums[c] / count) : ValueType();
+		}
+	}
+}
+
+/**
+ * Give each cluster the tuple of its central point.
+ * @param input The input array
+ * @param output The output array, holding one tuple for each cluster
+ * @param centroidIndices The input index of each cluster's central point, empty for kMeans
+ * centroids, which take the tuple of their first member instead
+ * @param memberOffsets The position of each cluster's first member in `members`, followed by the
+ * amount of members
+ * @param members The input indices of the members of all clusters, one cluster after another
+ */
+static void copyCentralTuples(vtkAbstractArray* input, vtkAbstractArray* output,
+                              const QList<int>& centroidIndices,
+                              const std::vector<int>& memberOffsets,
+                              const std::vector<int>& members) {
+	for (int c = 0; c + 1 < (int) memberOffsets.size(); ++c) {
+		if (centroidIndices.size() > 0) {
+			output->SetTuple(c, centroidIndices[c], input);
+		} else if (memberOffsets[c] < memberOffsets[c + 1]) {
+			output->SetTuple(c, members[memberOffsets[c]], input);
+		}
+	}
+}
+
 vtkSmartPointer<vtkPolyData> DataDensityFilter::generateOutputData(
     PointMap centralPoints, vtkPointSet* input) {
 	vtkSmartPointer<vtkPolyData> output = vtkSmartPointer<vtkPolyData>::New();
@@ -237,9 +239,34 @@ vtkSmartPointer<vtkPolyData> DataDensityFilter::generateOutputData(
 	vertices->Allocate(vertices->EstimateSize(1, centralPoints.size()));
 	vertices->InsertNextCell(centralPoints.size());
 
+	// Flatten the membership of all clusters into a single list. A central point taken from the
+	// input is a member of its own cluster, while kMeans centroids are not part of the input.
+	std::vector<int> memberOffsets(1, 0);
+	std::vector<int> members;
+	members.reserve(input->GetNumberOfPoints());
+
+	int centralPointIndex = 0;
+	for (PointMap::const_iterator i = centralPoints.cbegin(); i != centralPoints.cend(); ++i) {
+		vertices->InsertCellPoint(points->InsertNextPoint(i->first.getX(), i->first.getY(),
+		                          i->first.getZ()));
+
+		if (this->centroidIndices.size() > 0) {
+			members.push_back(this->centroidIndices[centralPointIndex]);
+		}
+
+		QListIterator<int> k(i->second);
+		while (k.hasNext()) {
+			members.push_back(k.next());
+		}
+		memberOffsets.push_back(members.size());
+
+		centralPointIndex++;
+	}
+
 	// Create all arrays from the input data
-	QList<vtkSmartPointer<vtkAbstractArray>> inputArrays;
 	QList<vtkSmartPointer<vtkAbstractArray>> outputArrays;
+	std::vector<vtkDataArray*> numericInputArrays;
+	std::vector<vtkDataArray*> numericOutputArrays;
 
 	for (int h = 0; h < input->GetPointData()->GetNumberOfArrays(); ++h) {
 		vtkSmartPointer<vtkAbstractArray> inputArray = input->GetPointData()->GetAbstractArray(h);
@@ -249,63 +276,62 @@ vtkSmartPointer<vtkPolyData> DataDensityFilter::generateOutputData(
 			return 0;
 		}
 
-		vtkSmartPointer<vtkAbstractArray> outputArray = vtkAbstractArray::CreateArray(
-		            inputArray->GetDataType());
+		vtkSmartPointer<vtkAbstractArray> outputArray = vtkSmartPointer<vtkAbstractArray>::Take(
+		            vtkAbstractArray::CreateArray(inputArray->GetDataType()));
 
 		outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
 		outputArray->SetNumberOfTuples(centralPoints.size());
 		outputArray->SetName(inputArray->GetName());
-
-		inputArrays.append(inputArray);
 		outputArrays.append(outputArray);
-	}
 
-	// Iterate through all the central points and calculate the arithmetic mean of the subordinate point's data
-	PointMap::const_iterator i = centralPoints.cbegin();
-	int centralPointIndex = 0;
-	while (i != centralPoints.cend()) {
-		vertices->InsertCellPoint(points->InsertNextPoint(i->first.getX(), i->first.getY(),
-		                          i->first.getZ()));
-
-		for (int j = 0; j < inputArrays.size(); ++j) {
-			if (inputArrays[j]->IsNumeric()) {
-				// For numeric input arrays, calculate the average for all values of subordinate points associated with the central point
-				vtkSmartPointer<vtkDataArray> inputArray = vtkDataArray::SafeDownCast(inputArrays[j]);
-				vtkSmartPointer<vtkDataArray> outputArray = vtkDataArray::SafeDownCast(outputArrays[j]);
+		if (inputArray->IsNumeric()) {
+			// Numeric arrays are averaged over all members of each cluster further below
+			vtkDataArray* numericInputArray = vtkDataArray::SafeDownCast(inputArray);
+			vtkDataArray* numericOutputArray = vtkDataArray::SafeDownCast(outputArray);
 
-				if (!inputArray || !outputArray) {
-					vtkErrorMacro( << "There was an error while calculating the average.");
-					return 0;
-				}
-
-				std::vector<double> cumulativeAverage(inputArrays[j]->GetNumberOfComponents());
-				for (int l = 0; l < inputArrays[j]->GetNumberOfComponents(); ++l) {
-					cumulativeAverage[l] = inputArray->GetTuple(centralPointIndex)[l];
-				}
+			if (!numericInputArray || !numericOutputArray) {
+				vtkErrorMacro( << "There was an error while calculating the average.");
+				return 0;
+			}
 
-				QListIterator<int> k(i->second);
-				while (k.hasNext()) {
-					int pointIndex = k.next();
-					for (int l = 0; l < inputArrays[j]->GetNumberOfComponents(); l++) {
-						cumulativeAverage[l] = (cumulativeAverage[l] + inputArray->GetTuple(pointIndex)[l]) / 2;
-					}
-				}
+			numericInputArrays.push_back(numericInputArray);
+			numericOutputArrays.push_back(numericOutputArray);
+		} else {
+			// For non-numeric input arrays, simply keep the value of the central point
+			copyCentralTuples(inputArray, outputArray, this->centroidIndices, memberOffsets,
+			                  members);
+		}
+	}
 
-				outputArray->InsertTuple(centralPointIndex, cumulativeAverage.data());
-			} else {
-				// For non-numeric input arrays, simply keep the value of the central point
-				if (this->centroidIndices.size() > 0) {
-					outputArrays[j]->SetTuple(centralPointIndex, this->centroidIndices[centralPointIndex],
-					                          inputArrays[j]);
-				} else {
-					outputArrays[j]->SetTuple(centralPointIndex, centralPointIndex, inputArrays[j]);
+	// Average the numeric arrays independently of each other, each thread taking one at a time
+	if (centralPoints.size() > 0 && !numericInputArrays.empty()) {
+		std::atomic<size_t> nextArray(0);
+
+		auto averageArrays = [&]() {
+			for (size_t a = nextArray++; a < numericInputArrays.size(); a = nextArray++) {
+				vtkDataArray* inputArray = numericInputArrays[a];
+				vtkDataArray* outputArray = numericOutputArrays[a];
+
+				switch (inputArray->GetDataType()) {
+					vtkTemplateMacro(averageTuples(
+					                     static_cast<const VTK_TT*>(inputArray->GetVoidPointer(0)),
+					                     static_cast<VTK_TT*>(outputArray->GetVoidPointer(0)),
+					                     inputArray->GetNumberOfComponents(), memberOffsets, members
+					                 ));
+				default:
+					// Arrays without a plain value type such as bit arrays cannot be averaged
+					copyCentralTuples(inputArray, outputArray, this->centroidIndices,
+					                  memberOffsets, members);
+					break;
 				}
 			}
-		}
+		};
 
-		centralPointIndex++;
-		++i;
+		Threads::run(Threads::getAmountOfThreads(numericInputArrays.size(), 1), [&](int) {
+			averageArrays();
+		});
 	}
+
 	output->SetPoints(points);
 	output->SetVerts(vertices);
 
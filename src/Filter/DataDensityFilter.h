@@ -60,9 +60,10 @@ private:
 	/**
 	 * Reduce a set of points using the kMeans algorithm.
 	 * @param input The input point set
+	 * @param geographic True if the points are given as longitude, latitude and height
 	 * @return A map of point coordinates of central points and a list of point IDs that belong to them
 	 */
-	PointMap reducePointsKMeans(vtkPointSet* input);
+	PointMap reducePointsKMeans(vtkPointSet* input, bool geographic);
 
 	/**
 	 * Reduce a set of points using a simple approach.
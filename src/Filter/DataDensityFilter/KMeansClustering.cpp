@@ -0,0 +1,478 @@
+#include <Filter/DataDensityFilter/KMeansClustering.hpp>
+
+#include <Utils/Math/Functions.hpp>
+#include <Utils/Misc/Macros.hpp>
+#include <Utils/Misc/Threads.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+/**
+ * The amount of mini-batch iterations run before the final assignment
+ */
+static const int MINI_BATCH_ITERATIONS = 10;
+
+/**
+ * The smallest amount of points drawn for each mini-batch
+ */
+static const int MINIMUM_BATCH_SIZE = 4096;
+
+/**
+ * The amount of points the k-means++ seeding considers for each cluster to be created
+ */
+static const int SEEDING_SAMPLES_PER_CLUSTER = 2;
+
+/**
+ * Up to this amount of clusters the initial centroids are chosen by k-means++. Its cost grows
+ * quadratically with the amount of clusters, so beyond this they are drawn uniformly instead.
+ */
+static const int MAXIMUM_SEEDED_CLUSTERS = 16384;
+
+/**
+ * The largest amount of centroids stored in a leaf of the centroid tree
+ */
+static const int LEAF_SIZE = 16;
+
+/**
+ * Point coordinates split into one contiguous array per axis, so that distance computations over
+ * many points can be vectorized.
+ */
+struct CoordinateArrays {
+	std::vector<float> x;
+	std::vector<float> y;
+	std::vector<float> z;
+
+	void resize(size_t size) {
+		this->x.resize(size);
+		this->y.resize(size);
+		this->z.resize(size);
+	}
+
+	size_t size() const {
+		return this->x.size();
+	}
+};
+
+/**
+ * A k-d tree over the current centroids used to find the centroid nearest to a point.
+ */
+class CentroidTree {
+public:
+	/**
+	 * Build the tree over a set of centroids, replacing any previous content.
+	 */
+	void build(const CoordinateArrays& centroids) {
+		int amountOfCentroids = centroids.size();
+
+		this->ids.resize(amountOfCentroids);
+		for (int i = 0; i < amountOfCentroids; i++) {
+			this->ids[i] = i;
+		}
+		this->nodes.clear();
+
+		Node root;
+		root.begin = 0;
+		root.end = amountOfCentroids;
+		this->nodes.push_back(root);
+
+		// Split nodes along their widest axis until they are small enough to be leaves
+		std::vector<int> pending(1, 0);
+		while (!pending.empty()) {
+			int nodeIndex = pending.back();
+			pending.pop_back();
+
+			Node node = this->nodes[nodeIndex];
+			if (node.end - node.begin <= LEAF_SIZE) {
+				continue;
+			}
+
+			const float* axes[3] = { centroids.x.data(), centroids.y.data(), centroids.z.data() };
+			float extent[3];
+			for (int a = 0; a < 3; a++) {
+				float minimum = std::numeric_limits<float>::max();
+				float maximum = std::numeric_limits<float>::lowest();
+				for (int i = node.begin; i < node.end; i++) {
+					minimum = std::min(minimum, axes[a][this->ids[i]]);
+					maximum = std::max(maximum, axes[a][this->ids[i]]);
+				}
+				extent[a] = maximum - minimum;
+			}
+			int axis = std::max_element(extent, extent + 3) - extent;
+			const float* values = axes[axis];
+
+			int middle = node.begin + (node.end - node.begin) / 2;
+			std::nth_element(this->ids.begin() + node.begin, this->ids.begin() + middle,
+			this->ids.begin() + node.end, [values](int a, int b) {
+				return values[a] < values[b];
+			});
+
+			Node left;
+			left.begin = node.begin;
+			left.end = middle;
+			Node right;
+			right.begin = middle;
+			right.end = node.end;
+
+			Node& parent = this->nodes[nodeIndex];
+			parent.axis = axis;
+			parent.split = values[this->ids[middle]];
+			parent.left = this->nodes.size();
+			parent.right = this->nodes.size() + 1;
+
+			this->nodes.push_back(left);
+			this->nodes.push_back(right);
+			pending.push_back(this->nodes.size() - 2);
+			pending.push_back(this->nodes.size() - 1);
+		}
+
+		// Store the centroids in tree order so that each leaf is a contiguous range
+		this->coordinates.resize(amountOfCentroids);
+		for (int i = 0; i < amountOfCentroids; i++) {
+			this->coordinates.x[i] = centroids.x[this->ids[i]];
+			this->coordinates.y[i] = centroids.y[this->ids[i]];
+			this->coordinates.z[i] = centroids.z[this->ids[i]];
+		}
+	}
+
+	/**
+	 * Find the centroid nearest to a point with finite coordinates.
+	 * @return The index of the nearest centroid as passed to `build`
+	 */
+	int findNearest(float x, float y, float z) const {
+		const float query[3] = { x, y, z };
+		float bestDistance = std::numeric_limits<float>::infinity();
+		int best = -1;
+
+		// Each entry holds a node and a lower bound of the squared distance to its centroids
+		std::pair<int, float> stack[64];
+		int stackSize = 0;
+		stack[stackSize++] = std::make_pair(0, 0.0f);
+
+		while (stackSize > 0) {
+			std::pair<int, float> entry = stack[--stackSize];
+			if (entry.second > bestDistance) {
+				continue;
+			}
+
+			const Node& node = this->nodes[entry.first];
+			if (node.left < 0) {
+				float distances[LEAF_SIZE];
+				int count = node.end - node.begin;
+				const float* leafX = this->coordinates.x.data() + node.begin;
+				const float* leafY = this->coordinates.y.data() + node.begin;
+				const float* leafZ = this->coordinates.z.data() + node.begin;
+
+				for (int i = 0; i < count; i++) {
+					float dx = leafX[i] - x;
+					float dy = leafY[i] - y;
+					float dz = leafZ[i] - z;
+					distances[i] = dx * dx + dy * dy + dz * dz;
+				}
+
+				// Distances too large for a float are infinite, but still make a centroid the nearest
+				for (int i = 0; i < count; i++) {
+					if (distances[i] < bestDistance || best < 0) {
+						bestDistance = distances[i];
+						best = node.begin + i;
+					}
+				}
+				continue;
+			}
+
+			// Visit the side containing the point first, the other one only if it may be closer
+			float difference = query[node.axis] - node.split;
+			int nearSide = difference < 0 ? node.left : node.right;
+			int farSide = difference < 0 ? node.right : node.left;
+			stack[stackSize++] = std::make_pair(farSide, std::max(entry.second,
+			                                    difference * difference));
+			stack[stackSize++] = std::make_pair(nearSide, entry.second);
+		}
+
+		return best < 0 ? -1 : this->ids[best];
+	}
+
+private:
+	struct Node {
+		Node() : begin(0), end(0), left(-1), right(-1), axis(0), split(0) { }
+
+		int begin;
+		int end;
+		int left;
+		int right;
+		int axis;
+		float split;
+	};
+
+	std::vector<Node> nodes;
+	std::vector<int> ids;
+	CoordinateArrays coordinates;
+};
+
+/**
+ * Run a function over a range of indices, splitting the range evenly among all available cores.
+ * @param count The amount of indices
+ * @param function Called with the beginning and end of each part of the range
+ */
+template<typename Function>
+static void runInParallel(int count, const Function& function) {
+	int amountOfThreads = Threads::getAmountOfThreads(count, MINIMUM_BATCH_SIZE);
+	Threads::run(amountOfThreads, [&](int thread) {
+		function((int) ((int64_t) count * thread / amountOfThreads),
+		         (int) ((int64_t) count * (thread + 1) / amountOfThreads));
+	});
+}
+
+/**
+ * Get the coordinates used for clustering a point. Geographic points are placed on the unit
+ * sphere so that clusters are not distorted near the poles and across the date line.
+ */
+static void getFeatures(const PointCoordinates& point, bool geographic, float& x, float& y,
+                        float& z) {
+	if (geographic) {
+		double longitude = toRadians(point.getX());
+		double latitude = toRadians(point.getY());
+		x = std::cos(latitude) * std::cos(longitude);
+		y = std::cos(latitude) * std::sin(longitude);
+		z = std::sin(latitude);
+	} else {
+		x = point.getX();
+		y = point.getY();
+		z = point.getZ();
+	}
+}
+
+/**
+ * Choose the initial centroids among a sample of the points. Up to `MAXIMUM_SEEDED_CLUSTERS`
+ * they are chosen by k-means++, preferring points far away from the centroids chosen so far.
+ */
+static void seedCentroids(const CoordinateArrays& features, int amountOfClusters,
+                          std::mt19937& generator, CoordinateArrays& centroids) {
+	int amountOfPoints = features.size();
+	int sampleSize = std::min<int64_t>(amountOfPoints,
+	                                   (int64_t) amountOfClusters * SEEDING_SAMPLES_PER_CLUSTER);
+
+	// Draw the sample without replacement by partially shuffling all indices
+	std::vector<int> indices(amountOfPoints);
+	for (int i = 0; i < amountOfPoints; i++) {
+		indices[i] = i;
+	}
+	for (int i = 0; i < sampleSize; i++) {
+		std::uniform_int_distribution<int> distribution(i, amountOfPoints - 1);
+		std::swap(indices[i], indices[distribution(generator)]);
+	}
+
+	CoordinateArrays sample;
+	sample.resize(sampleSize);
+	for (int i = 0; i < sampleSize; i++) {
+		sample.x[i] = features.x[indices[i]];
+		sample.y[i] = features.y[indices[i]];
+		sample.z[i] = features.z[indices[i]];
+	}
+
+	centroids.resize(amountOfClusters);
+
+	if (amountOfClusters > MAXIMUM_SEEDED_CLUSTERS) {
+		// The sample is already shuffled, so its first points form a uniform choice
+		for (int c = 0; c < amountOfClusters; c++) {
+			centroids.x[c] = sample.x[c];
+			centroids.y[c] = sample.y[c];
+			centroids.z[c] = sample.z[c];
+		}
+		return;
+	}
+
+	std::vector<float> minimumDistances(sampleSize, std::numeric_limits<float>::max());
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+	int chosen = 0;
+
+	for (int c = 0; c < amountOfClusters; c++) {
+		if (c > 0) {
+			double total = 0;
+			for (int i = 0; i < sampleSize; i++) {
+				total += minimumDistances[i];
+			}
+
+			if (total > 0) {
+				// Pick a point with a probability proportional to its squared distance
+				double threshold = uniform(generator) * total;
+				double cumulative = 0;
+				chosen = sampleSize - 1;
+				for (int i = 0; i < sampleSize; i++) {
+					cumulative += minimumDistances[i];
+					if (cumulative > threshold && minimumDistances[i] > 0) {
+						chosen = i;
+						break;
+					}
+				}
+			} else {
+				// All remaining points coincide with a centroid
+				chosen = std::uniform_int_distribution<int>(0, sampleSize - 1)(generator);
+			}
+		}
+
+		float cx = sample.x[chosen];
+		float cy = sample.y[chosen];
+		float cz = sample.z[chosen];
+		centroids.x[c] = cx;
+		centroids.y[c] = cy;
+		centroids.z[c] = cz;
+
+		const float* sampleX = sample.x.data();
+		const float* sampleY = sample.y.data();
+		const float* sampleZ = sample.z.data();
+		float* distances = minimumDistances.data();
+		for (int i = 0; i < sampleSize; i++) {
+			float dx = sampleX[i] - cx;
+			float dy = sampleY[i] - cy;
+			float dz = sampleZ[i] - cz;
+			distances[i] = std::min(distances[i], dx * dx + dy * dy + dz * dz);
+		}
+	}
+}
+
+KMeansClustering::Clusters KMeansClustering::cluster(const std::vector<PointCoordinates>& points,
+        int amountOfClusters, bool geographic) {
+	Clusters clusters;
+
+	// Points with non-finite coordinates cannot be placed, so they are left out of all clusters.
+	// All other points are referred to by their index among the finite ones from here on.
+	CoordinateArrays features;
+	features.resize(points.size());
+	std::vector<int> pointIndices;
+	pointIndices.reserve(points.size());
+	for (size_t i = 0; i < points.size(); i++) {
+		float x, y, z;
+		getFeatures(points[i], geographic, x, y, z);
+		if (std::isfinite(x) && std::isfinite(y) && std::isfinite(z)) {
+			features.x[pointIndices.size()] = x;
+			features.y[pointIndices.size()] = y;
+			features.z[pointIndices.size()] = z;
+			pointIndices.push_back(i);
+		}
+	}
+	features.resize(pointIndices.size());
+
+	int amountOfPoints = pointIndices.size();
+	amountOfClusters = std::min(amountOfClusters, amountOfPoints);
+
+	if (amountOfClusters <= 0) {
+		return clusters;
+	}
+
+	// Use a fixed seed so that the same input always yields the same clusters
+	std::mt19937 generator(42);
+
+	CoordinateArrays centroids;
+	seedCentroids(features, amountOfClusters, generator, centroids);
+
+	CentroidTree tree;
+	std::vector<int> updateCounts(amountOfClusters, 0);
+
+	int batchSize = std::min(amountOfPoints, std::max(MINIMUM_BATCH_SIZE,
+	                         amountOfPoints / MINI_BATCH_ITERATIONS));
+	std::vector<int> batch(batchSize);
+	std::vector<int> batchLabels(batchSize);
+	std::uniform_int_distribution<int> pointDistribution(0, amountOfPoints - 1);
+
+	for (int iteration = 0; iteration < MINI_BATCH_ITERATIONS; iteration++) {
+		tree.build(centroids);
+
+		for (int i = 0; i < batchSize; i++) {
+			batch[i] = pointDistribution(generator);
+		}
+
+		runInParallel(batchSize, [&](int begin, int end) {
+			for (int i = begin; i < end; i++) {
+				int point = batch[i];
+				batchLabels[i] = tree.findNearest(features.x[point], features.y[point],
+				                                  features.z[point]);
+			}
+		});
+
+		// Move each centroid towards its points with a learning rate decreasing over time
+		for (int i = 0; i < batchSize; i++) {
+			int label = batchLabels[i];
+			int point = batch[i];
+			float learningRate = 1.0f / ++updateCounts[label];
+
+			centroids.x[label] += learningRate * (features.x[point] - centroids.x[label]);
+			centroids.y[label] += learningRate * (features.y[point] - centroids.y[label]);
+			centroids.z[label] += learningRate * (features.z[point] - centroids.z[label]);
+		}
+	}
+
+	// Assign every point to its nearest centroid
+	tree.build(centroids);
+	std::vector<int> labels(amountOfPoints);
+	runInParallel(amountOfPoints, [&](int begin, int end) {
+		for (int i = begin; i < end; i++) {
+			labels[i] = tree.findNearest(features.x[i], features.y[i], features.z[i]);
+		}
+	});
+
+	// Bucket the points by their label using a counting sort, keeping their order within each
+	std::vector<int> offsets(amountOfClusters + 1, 0);
+	for (int i = 0; i < amountOfPoints; i++) {
+		offsets[labels[i] + 1]++;
+	}
+	for (int c = 0; c < amountOfClusters; c++) {
+		offsets[c + 1] += offsets[c];
+	}
+	std::vector<int> buckets(amountOfPoints);
+	std::vector<int> positions(offsets.begin(), offsets.end() - 1);
+	for (int i = 0; i < amountOfPoints; i++) {
+		buckets[positions[labels[i]]++] = i;
+	}
+
+	// Place each centroid at the mean of its members, leaving out empty clusters
+	for (int c = 0; c < amountOfClusters; c++) {
+		int count = offsets[c + 1] - offsets[c];
+		if (count == 0) {
+			continue;
+		}
+
+		std::vector<int> members(count);
+		double sum[3] = { 0, 0, 0 };
+		double heightSum = 0;
+		for (int m = 0; m < count; m++) {
+			int feature = buckets[offsets[c] + m];
+			members[m] = pointIndices[feature];
+
+			const PointCoordinates& point = points[members[m]];
+			if (geographic) {
+				sum[0] += features.x[feature];
+				sum[1] += features.y[feature];
+				sum[2] += features.z[feature];
+				heightSum += point.getZ();
+			} else {
+				sum[0] += point.getX();
+				sum[1] += point.getY();
+				sum[2] += point.getZ();
+			}
+		}
+
+		PointCoordinates centroid;
+		double length = std::sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+		if (!geographic) {
+			centroid = PointCoordinates(sum[0] / count, sum[1] / count, sum[2] / count);
+		} else if (length > 0) {
+			// Project the mean back onto the sphere
+			centroid = PointCoordinates(
+			               std::atan2(sum[1], sum[0]) * 180 / KRONOS_PI,
+			               std::asin(clamp(-1.0, sum[2] / length, 1.0)) * 180 / KRONOS_PI,
+			               heightSum / count
+			           );
+		} else {
+			// The members are spread evenly around the globe, so any of them is as central
+			centroid = PointCoordinates(points[members[0]].getX(), points[members[0]].getY(),
+			                            heightSum / count);
+		}
+
+		clusters.centroids.push_back(centroid);
+		clusters.members.push_back(std::move(members));
+	}
+
+	return clusters;
+}
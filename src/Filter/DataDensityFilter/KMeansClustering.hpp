@@ -0,0 +1,59 @@
+#ifndef KRONOS_KMEANS_CLUSTERING_HPP
+#define KRONOS_KMEANS_CLUSTERING_HPP
+
+#include <Utils/Misc/PointCoordinates.hpp>
+
+#include <vector>
+
+/**
+ * Groups points into a fixed amount of clusters using mini-batch k-means. The initial centroids are
+ * chosen by k-means++ seeding on a sample of the points. Each iteration then assigns a random
+ * batch of points to their nearest centroid and moves those centroids towards them. Finally,
+ * every point is assigned to its nearest centroid.
+ *
+ * Nearest centroids are found using a k-d tree whose leaves store their centroids contiguously,
+ * so the distances within a leaf are computed in a single vectorizable loop. Assignments are
+ * spread over all available cores.
+ */
+class KMeansClustering {
+
+public:
+	/**
+	 * The result of a clustering, holding the same amount of entries in both lists.
+	 */
+	struct Clusters {
+		/**
+		 * The centre of each cluster, being the mean of its members
+		 */
+		std::vector<PointCoordinates> centroids;
+
+		/**
+		 * The indices of the points belonging to each cluster in ascending order
+		 */
+		std::vector<std::vector<int>> members;
+	};
+
+	/**
+	 * Cluster a set of points.
+	 * @param points The coordinates of all points
+	 * @param amountOfClusters The amount of clusters to create, clusters without any members are
+	 * left out of the result
+	 * @param geographic True if the points are given as longitude, latitude and height, in which
+	 * case they are clustered by their position on the globe, false if they are cartesian
+	 * coordinates
+	 * @return The clusters that have at least one member. Points whose coordinates are not finite
+	 * do not belong to any of them.
+	 */
+	static Clusters cluster(const std::vector<PointCoordinates>& points, int amountOfClusters,
+	                        bool geographic);
+
+private:
+	/**
+	 * Hidden since this class only offers static utility methods.
+	 */
+	KMeansClustering();
+	~KMeansClustering();
+
+};
+
+#endif
@@ -0,0 +1,123 @@
+#include <Filter/DataDensityFilter/PointClustering.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * Identifies a cell of the hash grid by its integer position along each axis.
+ */
+struct CellKey {
+	int64_t x;
+	int64_t y;
+	int64_t z;
+
+	bool operator==(const CellKey& other) const {
+		return this->x == other.x && this->y == other.y && this->z == other.z;
+	}
+};
+
+struct CellKeyHash {
+	size_t operator()(const CellKey& key) const {
+		// Combine the axes using large odd multipliers to spread neighbouring cells
+		uint64_t hash = (uint64_t) key.x * 73856093ULL;
+		hash ^= (uint64_t) key.y * 19349663ULL;
+		hash ^= (uint64_t) key.z * 83492791ULL;
+		return (size_t) hash;
+	}
+};
+
+typedef std::unordered_map<CellKey, std::vector<int>, CellKeyHash> Grid;
+
+/**
+ * Get the grid cell containing some coordinates.
+ */
+static CellKey getCell(const PointCoordinates& coordinates, const PointCoordinates& origin,
+                       double cellSize) {
+	CellKey key;
+	key.x = (int64_t) std::floor((coordinates.getX() - origin.getX()) / cellSize);
+	key.y = (int64_t) std::floor((coordinates.getY() - origin.getY()) / cellSize);
+	key.z = (int64_t) std::floor((coordinates.getZ() - origin.getZ()) / cellSize);
+	return key;
+}
+
+std::vector<PointClustering::Cluster> PointClustering::absorbPoints(
+    const std::vector<PointCoordinates>& points, double absorptionDistance) {
+	std::vector<Cluster> clusters;
+	int numberOfPoints = points.size();
+
+	// Without a positive distance no point can absorb another one
+	if (!(absorptionDistance > 0)) {
+		clusters.resize(numberOfPoints);
+		for (int i = 0; i < numberOfPoints; i++) {
+			clusters[i].centralPoint = i;
+		}
+		return clusters;
+	}
+
+	PointCoordinates origin = numberOfPoints > 0 ? points[0] : PointCoordinates();
+
+	// Widen the cells slightly so that rounding never puts two points closer than the absorption
+	// distance more than one cell apart
+	double cellSize = absorptionDistance * (1 + 1e-6);
+
+	// Sort all points into the grid, each cell listing its points in ascending order
+	Grid grid;
+	for (int i = 0; i < numberOfPoints; i++) {
+		grid[getCell(points[i], origin, cellSize)].push_back(i);
+	}
+
+	std::vector<bool> absorbed(numberOfPoints, false);
+
+	for (int i = 0; i < numberOfPoints; i++) {
+		if (absorbed[i]) {
+			continue;
+		}
+
+		Cluster cluster;
+		cluster.centralPoint = i;
+		absorbed[i] = true;
+
+		PointCoordinates centralPoint = points[i];
+		CellKey centralCell = getCell(centralPoint, origin, cellSize);
+
+		// All points close enough to be absorbed lie in the central point's cell or its neighbours
+		for (int dx = -1; dx <= 1; dx++) {
+			for (int dy = -1; dy <= 1; dy++) {
+				for (int dz = -1; dz <= 1; dz++) {
+					CellKey key = { centralCell.x + dx, centralCell.y + dy, centralCell.z + dz };
+					Grid::iterator cell = grid.find(key);
+					if (cell == grid.end()) {
+						continue;
+					}
+
+					std::vector<int>& cellPoints = cell->second;
+					for (size_t k = 0; k < cellPoints.size(); k++) {
+						int j = cellPoints[k];
+						if (!absorbed[j] && centralPoint.getDistanceTo(points[j]) < absorptionDistance) {
+							cluster.subordinatePoints.push_back(j);
+							absorbed[j] = true;
+						}
+					}
+
+					// Drop absorbed points so that later searches do not visit them again
+					cellPoints.erase(std::remove_if(cellPoints.begin(), cellPoints.end(),
+					[&absorbed](int j) {
+						return absorbed[j];
+					}), cellPoints.end());
+
+					if (cellPoints.empty()) {
+						grid.erase(cell);
+					}
+				}
+			}
+		}
+
+		// Keep the order in which an exhaustive search would have found the absorbed points
+		std::sort(cluster.subordinatePoints.begin(), cluster.subordinatePoints.end());
+		clusters.push_back(cluster);
+	}
+
+	return clusters;
+}
@@ -0,0 +1,50 @@
+#ifndef KRONOS_POINT_CLUSTERING_HPP
+#define KRONOS_POINT_CLUSTERING_HPP
+
+#include <Utils/Misc/PointCoordinates.hpp>
+
+#include <vector>
+
+/**
+ * Groups points into clusters by greedy absorption: Going through the points in order, each point
+ * that has not been absorbed yet becomes a central point and absorbs all unabsorbed points closer
+ * to it than the absorption distance. Points are looked up in a uniform hash grid whose cells are
+ * as wide as the absorption distance, so only the cells around a central point are searched.
+ */
+class PointClustering {
+
+public:
+	/**
+	 * A central point along with the points it has absorbed.
+	 */
+	struct Cluster {
+		/**
+		 * The index of the central point
+		 */
+		int centralPoint;
+
+		/**
+		 * The indices of all absorbed points in ascending order, not including the central point
+		 */
+		std::vector<int> subordinatePoints;
+	};
+
+	/**
+	 * Cluster a set of points by greedy absorption.
+	 * @param points The coordinates of all points
+	 * @param absorptionDistance Points closer than this distance to a central point are absorbed
+	 * @return All clusters in the order their central points appear in
+	 */
+	static std::vector<Cluster> absorbPoints(const std::vector<PointCoordinates>& points,
+	        double absorptionDistance);
+
+private:
+	/**
+	 * Hidden since this class only offers static utility methods.
+	 */
+	PointClustering();
+	~PointClustering();
+
+};
+
+#endif
@@ -6,8 +6,10 @@
 #include <vtkPointSet.h>
 #include <vtkFloatArray.h>
 #include <vtkStringArray.h>
+#include <vtkFieldData.h>
 
-FlightFilter::FlightFilter() {
+FlightFilter::FlightFilter() : airlineIds(nullptr), originAirportCodeIds(nullptr),
+	destinationAirportCodeIds(nullptr) {
 	this->airlineMatchingMode = FlightFilter::CONTAINING;
 }
 
@@ -19,104 +21,160 @@ QList<Data::Type> FlightFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>() << Data::FLIGHTS);
 }
 
-bool FlightFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-                                 vtkPointData* pointData) {
-	return this->isVisibleBasedOnAirline(pointIndex, pointData)
-	       && this->isVisibleBasedOnOriginAirportCode(pointIndex, pointData)
-	       && this->isVisibleBasedOnDestinationAirportCode(pointIndex, pointData)
-	       && this->isVisibleBasedOnFlightLength(pointIndex, pointData);
+/**
+ * Look up whether the ID of a point is marked as visible.
+ * @param ids The ID of each point
+ * @param visibleIds The visibility of each ID
+ * @param pointIndex The index of the point
+ * @return True if the point's ID is visible, false otherwise
+ */
+static bool isVisibleId(const int* ids, const std::vector<bool>& visibleIds, int pointIndex) {
+	int id = ids[pointIndex];
+	return id >= 0 && id < (int) visibleIds.size() && visibleIds[id];
 }
 
-bool FlightFilter::isVisibleBasedOnAirline(int pointIndex, vtkPointData* pointData) {
-	if (this->visibleAirlines.count() == 0) {
-		return true;
-	} else {
-		vtkSmartPointer<vtkStringArray> airlines = vtkStringArray::SafeDownCast(
-		            pointData->GetAbstractArray("airlines"));
-
-		if (!airlines) {
-			return false;
+void FlightFilter::prepareVisibilities(vtkPointSet* inputData) {
+	vtkSmartPointer<vtkStringArray> airlineDictionary = vtkStringArray::SafeDownCast(
+	            inputData->GetFieldData()->GetAbstractArray("airlineDictionary"));
+	vtkSmartPointer<vtkStringArray> airportCodeDictionary = vtkStringArray::SafeDownCast(
+	            inputData->GetFieldData()->GetAbstractArray("airportCodeDictionary"));
+
+	// Match each distinct airline and airport code only once instead of once per flight
+	this->airlineIds = getValues<vtkIntArray>(inputData, "airlineIds");
+	if (this->airlineIds && airlineDictionary) {
+		this->visibleAirlineIds.assign(airlineDictionary->GetNumberOfValues(), false);
+		for (vtkIdType i = 0; i < airlineDictionary->GetNumberOfValues(); i++) {
+			this->visibleAirlineIds[i] = this->isVisibleAirline(
+			                                 QString::fromStdString(airlineDictionary->GetValue(i)));
 		}
+	} else {
+		this->airlineIds = nullptr;
+	}
 
-		QString airline = QString::fromStdString(airlines->GetValue(pointIndex));
-		airline.remove(' ');
-
-		//check if the given airline is contained in a airline in visibleAirlines
-		for (int i = 0; i < visibleAirlines.count(); i++) {
-			if (this->airlineMatchingMode == CONTAINING) {
-				//containing Mode
-				if (airline.contains(visibleAirlines.at(i), Qt::CaseInsensitive)) {
-					return true;
-				}
-			} else if (this->airlineMatchingMode == MATCHING) {
-				//exact match
-				if (QString::compare(airline, visibleAirlines.at(i), Qt::CaseInsensitive) == 0) {
-					return true;
-				}
-			}
+	this->originAirportCodeIds = getValues<vtkIntArray>(inputData, "originAirportCodeIds");
+	this->destinationAirportCodeIds = getValues<vtkIntArray>(inputData, "destinationAirportCodeIds");
+	if (this->originAirportCodeIds && this->destinationAirportCodeIds && airportCodeDictionary) {
+		this->visibleOriginAirportCodeIds.assign(airportCodeDictionary->GetNumberOfValues(), false);
+		this->visibleDestinationAirportCodeIds.assign(airportCodeDictionary->GetNumberOfValues(),
+		        false);
+		for (vtkIdType i = 0; i < airportCodeDictionary->GetNumberOfValues(); i++) {
+			QString airportCode = QString::fromStdString(airportCodeDictionary->GetValue(i));
+			this->visibleOriginAirportCodeIds[i] = this->isVisibleAirportCode(
+			        airportCode, this->visibleOriginAirportCodes);
+			this->visibleDestinationAirportCodeIds[i] = this->isVisibleAirportCode(
+			            airportCode, this->visibleDestinationAirportCodes);
 		}
-		return false;
+	} else {
+		this->originAirportCodeIds = nullptr;
+		this->destinationAirportCodeIds = nullptr;
 	}
 }
 
-bool FlightFilter::isVisibleBasedOnOriginAirportCode(int pointIndex, vtkPointData* pointData) {
-	vtkSmartPointer<vtkStringArray> originAirportCodes = vtkStringArray::SafeDownCast(
-	            pointData->GetAbstractArray("originAirportCodes"));
+void FlightFilter::evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection) {
+	const float* flightLengths = getValues<vtkFloatArray>(inputData, "flightLengths");
 
-	if (!originAirportCodes) {
-		return false;
+	if (!flightLengths) {
+		return;
 	}
 
-	QString originAirportCode = QString::fromStdString(originAirportCodes->GetValue(pointIndex));
+	this->prepareVisibilities(inputData);
+	vtkPointData* pointData = inputData->GetPointData();
+	vtkStringArray* airlines = vtkStringArray::SafeDownCast(pointData->GetAbstractArray("airlines"));
+	vtkStringArray* originAirportCodes = vtkStringArray::SafeDownCast(
+	        pointData->GetAbstractArray("originAirportCodes"));
+	vtkStringArray* destinationAirportCodes = vtkStringArray::SafeDownCast(
+	            pointData->GetAbstractArray("destinationAirportCodes"));
 
-	if (this->visibleOriginAirportCodes.count() == 0) {
-		return true;
-	} else {
-		for (int i = 0; i < visibleOriginAirportCodes.count(); i++) {
-			//accept only exact match
-			if (QString::compare(originAirportCode, visibleOriginAirportCodes.at(i),
-			                     Qt::CaseInsensitive) == 0) {
-				return true;
-			}
-		}
-		return false;
+	for (size_t i = 0; i < selection.size(); i++) {
+		selection[i] = this->minFlightLength <= flightLengths[i]
+		               && flightLengths[i] <= this->maxFlightLength
+		               && this->isVisibleBasedOnAirline(i, airlines)
+		               && this->isVisibleBasedOnOriginAirportCode(i, originAirportCodes)
+		               && this->isVisibleBasedOnDestinationAirportCode(i, destinationAirportCodes);
 	}
 }
 
-bool FlightFilter::isVisibleBasedOnDestinationAirportCode(int pointIndex, vtkPointData* pointData) {
-	vtkSmartPointer<vtkStringArray> destinationAirportCodes = vtkStringArray::SafeDownCast(
-	            pointData->GetAbstractArray("destinationAirportCodes"));
-
-	if (!destinationAirportCodes) {
+bool FlightFilter::isVisibleBasedOnAirline(int pointIndex, vtkStringArray* airlines) {
+	if (this->visibleAirlines.count() == 0) {
+		return true;
+	} else if (this->airlineIds) {
+		return isVisibleId(this->airlineIds, this->visibleAirlineIds, pointIndex);
+	} else if (!airlines) {
 		return false;
+	} else {
+		return this->isVisibleAirline(QString::fromStdString(airlines->GetValue(pointIndex)));
 	}
+}
 
-	QString destinationAirportCode = QString::fromStdString(destinationAirportCodes->GetValue(
-	                                     pointIndex));
-	if (this->visibleDestinationAirportCodes.count() == 0) {
+bool FlightFilter::isVisibleAirline(QString airline) {
+	if (this->visibleAirlines.count() == 0) {
 		return true;
-	} else {
-		for (int i = 0; i < visibleDestinationAirportCodes.count(); i++) {
-			//accept only exact match
-			if (QString::compare(destinationAirportCode, visibleDestinationAirportCodes.at(i),
-			                     Qt::CaseInsensitive) == 0) {
+	}
+
+	airline.remove(' ');
+
+	//check if the given airline is contained in a airline in visibleAirlines
+	for (int i = 0; i < visibleAirlines.count(); i++) {
+		if (this->airlineMatchingMode == CONTAINING) {
+			//containing Mode
+			if (airline.contains(visibleAirlines.at(i), Qt::CaseInsensitive)) {
+				return true;
+			}
+		} else if (this->airlineMatchingMode == MATCHING) {
+			//exact match
+			if (QString::compare(airline, visibleAirlines.at(i), Qt::CaseInsensitive) == 0) {
 				return true;
 			}
 		}
+	}
+	return false;
+}
+
+bool FlightFilter::isVisibleBasedOnOriginAirportCode(int pointIndex,
+        vtkStringArray* originAirportCodes) {
+	if (this->originAirportCodeIds) {
+		return isVisibleId(this->originAirportCodeIds, this->visibleOriginAirportCodeIds,
+		                   pointIndex);
+	}
+
+	if (!originAirportCodes) {
 		return false;
 	}
+
+	return this->isVisibleAirportCode(
+	           QString::fromStdString(originAirportCodes->GetValue(pointIndex)),
+	           this->visibleOriginAirportCodes);
 }
 
-bool FlightFilter::isVisibleBasedOnFlightLength(int pointIndex, vtkPointData* pointData) {
-	vtkSmartPointer<vtkFloatArray> flightLengths = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("flightLengths"));
+bool FlightFilter::isVisibleBasedOnDestinationAirportCode(int pointIndex,
+        vtkStringArray* destinationAirportCodes) {
+	if (this->destinationAirportCodeIds) {
+		return isVisibleId(this->destinationAirportCodeIds, this->visibleDestinationAirportCodeIds,
+		                   pointIndex);
+	}
 
-	if (!flightLengths) {
+	if (!destinationAirportCodes) {
 		return false;
 	}
 
-	double flightLength = flightLengths->GetTuple1(pointIndex);
-	return this->minFlightLength <= flightLength && flightLength <= this->maxFlightLength;
+	return this->isVisibleAirportCode(
+	           QString::fromStdString(destinationAirportCodes->GetValue(pointIndex)),
+	           this->visibleDestinationAirportCodes);
+}
+
+bool FlightFilter::isVisibleAirportCode(QString airportCode,
+                                        const QStringList& visibleAirportCodes) {
+	if (visibleAirportCodes.count() == 0) {
+		return true;
+	}
+
+	for (int i = 0; i < visibleAirportCodes.count(); i++) {
+		//accept only exact match
+		if (QString::compare(airportCode, visibleAirportCodes.at(i), Qt::CaseInsensitive) == 0) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void FlightFilter::updateStringList(QString inputString, QStringList& list) {
@@ -9,6 +9,11 @@
 #include <QMap>
 #include <QStringList>
 
+#include <vtkIntArray.h>
+#include <vtkStringArray.h>
+
+#include <vector>
+
 
 /**
  * This filter can extract data from flight point sets read by a Kronos reader depending on the flight's origin and destination airport code, the airline operating the flight and its length.
@@ -68,36 +73,50 @@ private:
 	void operator=(const FlightFilter&);  // Not implemented.
 
 	QList<Data::Type> getCompatibleDataTypes();
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData);
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection);
+
+	/**
+	 * look up the interned IDs of the input and decide which entries of its dictionaries are visible
+	 * @param inputData the data set whose flights are about to be evaluated
+	 */
+	void prepareVisibilities(vtkPointSet* inputData);
 
 	/**
 	 * check if data point is visible (based on airline filter)
 	 * @param pointIndex index of the point whose visiblity is checked
-	 * @param pointData contains all information about flight
+	 * @param airlines the airline of each flight, only used if the input holds no airline IDs
 	 * @return true, if data point is visible (based on airline filter)
 	 */
-	bool isVisibleBasedOnAirline(int pointIndex, vtkPointData* pointData);
+	bool isVisibleBasedOnAirline(int pointIndex, vtkStringArray* airlines);
 	/**
 	 * check if data point is visible (based on origin airport code filter)
 	 * @param pointIndex index of the point whose visiblity is checked
-	 * @param pointData contains all information about flight
+	 * @param originAirportCodes the origin of each flight, only used if the input holds no IDs
 	 * @return true, if data point is visible (based on origin airport code)
 	 */
-	bool isVisibleBasedOnOriginAirportCode(int pointIndex, vtkPointData* pointData);
+	bool isVisibleBasedOnOriginAirportCode(int pointIndex, vtkStringArray* originAirportCodes);
 	/**
 	 * check if data point is visible (based on destination airport code filter)
 	 * @param pointIndex index of the point whose visiblity is checked
-	 * @param pointData contains all information about flight
+	 * @param destinationAirportCodes the destination of each flight, only used if the input holds
+	 * no IDs
 	 * @return true, if data point is visible (based on destination airport code)
 	 */
-	bool isVisibleBasedOnDestinationAirportCode(int pointIndex, vtkPointData* pointData);
+	bool isVisibleBasedOnDestinationAirportCode(int pointIndex,
+	        vtkStringArray* destinationAirportCodes);
 	/**
-	 * check if data point is visible (based on flight length)
-	 * @param pointIndex index of the point whose visiblity is checked
-	 * @param pointData contains all information about flight
-	 * @return true, if data point is visible (based on flight length)
+	 * check if the flights of an airline are visible (based on airline filter)
+	 * @param airline name of the airline
+	 * @return true, if the airline's flights are visible
+	 */
+	bool isVisibleAirline(QString airline);
+	/**
+	 * check if an airport code is contained in a list of visible airport codes
+	 * @param airportCode the airport code to be checked
+	 * @param visibleAirportCodes the visible airport codes, an empty list makes all codes visible
+	 * @return true, if the airport code is visible
 	 */
-	bool isVisibleBasedOnFlightLength(int pointIndex, vtkPointData* pointData);
+	bool isVisibleAirportCode(QString airportCode, const QStringList& visibleAirportCodes);
 
 	///enum Mode determines the string matching mode
 	enum Mode {
@@ -125,6 +144,15 @@ private:
 	//maximum flight length in km
 	double maxFlightLength;
 
+	//interned IDs of the current input, null pointers if the input only holds the strings
+	const int* airlineIds;
+	const int* originAirportCodeIds;
+	const int* destinationAirportCodeIds;
+	//visibility of each entry of the current input's dictionaries, indexed by ID
+	std::vector<bool> visibleAirlineIds;
+	std::vector<bool> visibleOriginAirportCodeIds;
+	std::vector<bool> visibleDestinationAirportCodeIds;
+
 
 };
 
@@ -1,16 +1,21 @@
 #include <Filter/HeatmapDensityFilter.h>
+#include <Filter/HeatmapDensityFilter/DensityGrid.hpp>
 
 #include <Reader/DataReader/Data.hpp>
-#include <Utils/Misc/PointCoordinates.hpp>
 
 #include <vtkSmartPointer.h>
 #include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkIntArray.h>
 #include <vtkPointData.h>
+#include <vtkPointSet.h>
+#include <vtkPolyData.h>
 #include <vtkInformationVector.h>
 #include <vtkObjectFactory.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
 
-#include <qmap.h>
-#include <cmath>
+#include <algorithm>
 
 HeatmapDensityFilter::HeatmapDensityFilter() {
 	this->SetNumberOfInputPorts(1);
@@ -29,6 +34,16 @@ void HeatmapDensityFilter::setVerticalHeatmapResolution(int verticalHeatmapResol
 	this->Modified();
 }
 
+void HeatmapDensityFilter::setKernelBandwidth(double kernelBandwidth) {
+	this->kernelBandwidth = kernelBandwidth;
+	this->Modified();
+}
+
+void HeatmapDensityFilter::setImageOutputEnabled(bool imageOutputEnabled) {
+	this->imageOutputEnabled = imageOutputEnabled;
+	this->Modified();
+}
+
 void HeatmapDensityFilter::PrintSelf(ostream& os, vtkIndent indent) {
 	this->Superclass::PrintSelf(os, indent);
 	os << indent << "Heatmap Density Filter, Kronos Project" << endl;
@@ -41,10 +56,35 @@ void HeatmapDensityFilter::fail(QString message) {
 	                   message).toStdString());
 }
 
+/**
+ * Copy the densities of a grid into an output array.
+ * @param densities The densities of all grid points, one row after another
+ * @param output The values of the output array
+ * @param columns The amount of columns of the grid
+ * @param rows The amount of rows of the grid
+ * @param columnByColumn True if the output should list the grid points column by column, false if
+ * it should keep the order of the grid
+ */
+template<typename T>
+static void storeDensities(const std::vector<T>& densities, T* output, int columns, int rows,
+                           bool columnByColumn) {
+	if (!columnByColumn) {
+		std::copy(densities.begin(), densities.end(), output);
+		return;
+	}
+
+	for (int x = 0; x < columns; x++) {
+		for (int y = 0; y < rows; y++) {
+			*output++ = densities[y * columns + x];
+		}
+	}
+}
+
 int HeatmapDensityFilter::RequestData(vtkInformation* info,
                                       vtkInformationVector** inputVector,
                                       vtkInformationVector* outputVector) {
 	// Get the input data
+	vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
 	vtkPointSet* dataInput = vtkPointSet::GetData(inputVector[0], 0);
 
 	// Compute the bounds of the input data
@@ -58,48 +98,98 @@ int HeatmapDensityFilter::RequestData(vtkInformation* info,
 	double width = maxX - minX;
 	double height = maxY - minY;
 
-	QMap<PointCoordinates, int> densities;
+	// Points that have not been transformed yet are given as longitude and latitude
+	bool geographic = !inInfo->Has(Data::VTK_DATA_TRANSFORMATION())
+	                  || inInfo->Get(Data::VTK_DATA_TRANSFORMATION()) == Data::UNTRANSFORMED;
+	bool smoothed = this->kernelBandwidth > 0;
+
+	// A smoothed heatmap of the globe covers all of it so that it can wrap around the date line
+	if (smoothed && geographic) {
+		minX = -180;
+		minY = -90;
+		width = 360;
+		height = 180;
+	}
+
 	double horizontalStep = width / double(this->horizontalResolution);
 	double verticalStep = height / double(this->verticalResolution);
 
-	// Fill the map of densities with zeroes
-	for (int x = 0; x <= this->horizontalResolution; x++) {
-		for (int y = 0; y <= this->verticalResolution; y++) {
-			densities[PointCoordinates(minX + (x * horizontalStep), minY + (y * verticalStep), 0)] = 0;
+	// Add all points to the nearest grid point
+	DensityGrid grid(minX, minY, horizontalStep, verticalStep, this->horizontalResolution + 1,
+	                 this->verticalResolution + 1);
+
+	vtkPoints* inputPoints = dataInput->GetPoints();
+	if (inputPoints && inputPoints->GetNumberOfPoints() > 0) {
+		vtkDataArray* coordinates = inputPoints->GetData();
+
+		switch (coordinates->GetDataType()) {
+			vtkTemplateMacro(grid.count(static_cast<const VTK_TT*>(coordinates->GetVoidPointer(0)),
+			                            coordinates->GetNumberOfTuples(),
+			                            coordinates->GetNumberOfComponents()));
 		}
 	}
 
-	// Iterate through all points and add them to the nearest grid point
-	for (int i = 0; i < dataInput->GetNumberOfPoints(); i++) {
-		double point[3];
-		dataInput->GetPoint(i, point);
+	int columns = grid.getColumns();
+	int rows = grid.getRows();
 
-		densities[PointCoordinates(minX + (round((point[0] - minX) / horizontalStep) * horizontalStep),
-		                           minY + (round((point[1] - minY) / verticalStep) * verticalStep), 0)] += 1;
+	vtkInformation* outInfo = outputVector->GetInformationObject(0);
+	bool columnByColumn = !this->imageOutputEnabled;
+
+	// Output either the raw amount of points or a kernel density estimate
+	vtkSmartPointer<vtkDataArray> densityValues;
+	if (smoothed) {
+		vtkSmartPointer<vtkFloatArray> smoothedValues = vtkSmartPointer<vtkFloatArray>::New();
+		smoothedValues->SetNumberOfValues((vtkIdType) columns * rows);
+		storeDensities(grid.getSmoothedDensities(this->kernelBandwidth, this->kernelBandwidth,
+		               geographic), smoothedValues->GetPointer(0), columns, rows, columnByColumn);
+		densityValues = smoothedValues;
+	} else {
+		vtkSmartPointer<vtkIntArray> countValues = vtkSmartPointer<vtkIntArray>::New();
+		countValues->SetNumberOfValues((vtkIdType) columns * rows);
+		storeDensities(grid.getDensities(), countValues->GetPointer(0), columns, rows, columnByColumn);
+		densityValues = countValues;
+	}
+	densityValues->SetName("density");
+
+	if (this->imageOutputEnabled) {
+		// Output the densities as an image with one pixel per grid point
+		vtkImageData* output = vtkImageData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+		if (!output) {
+			this->fail("The output could not be created.");
+			return 0;
+		}
+
+		output->SetExtent(0, columns - 1, 0, rows - 1, 0, 0);
+		output->SetOrigin(minX, minY, 0);
+		output->SetSpacing(horizontalStep > 0 ? horizontalStep : 1, verticalStep > 0 ? verticalStep : 1,
+		                   1);
+		output->GetPointData()->AddArray(densityValues);
+
+		return 1;
 	}
 
 	// Output the densities as a poly data object
-	vtkInformation* outInfo = outputVector->GetInformationObject(0);
-	vtkSmartPointer<vtkPolyData> output = vtkPolyData::SafeDownCast(outInfo->Get(
-	        vtkDataObject::DATA_OBJECT()));
+	vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+	if (!output) {
+		this->fail("The output could not be created.");
+		return 0;
+	}
+
 	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-	vtkCellArray* verts = vtkCellArray::New();
-	verts->Allocate(verts->EstimateSize(1, densities.size()));
-	verts->InsertNextCell(densities.size());
-
-	// Add the coordinates of all points and the densities as a new array
-	vtkSmartPointer<vtkIntArray> densityValues = vtkSmartPointer<vtkIntArray>::New();
-	densityValues->SetNumberOfComponents(1);
-	densityValues->SetNumberOfValues(densities.size());
-	densityValues->SetName("density");
+	points->SetNumberOfPoints((vtkIdType) columns * rows);
+
+	vtkSmartPointer<vtkCellArray> verts = vtkSmartPointer<vtkCellArray>::New();
+	verts->Allocate(verts->EstimateSize(1, columns * rows));
+	verts->InsertNextCell(columns * rows);
 
+	// Add the coordinates of all points column by column, matching the order of the densities
 	int valueIndex = 0;
-	QMap<PointCoordinates, int>::const_iterator i = densities.constBegin();
-	while (i != densities.constEnd()) {
-		verts->InsertCellPoint(points->InsertNextPoint(i.key().getX(), i.key().getY(), i.key().getZ()));
-		densityValues->InsertValue(valueIndex, i.value());
-		valueIndex++;
-		++i;
+	for (int x = 0; x < columns; x++) {
+		for (int y = 0; y < rows; y++) {
+			points->SetPoint(valueIndex, minX + (x * horizontalStep), minY + (y * verticalStep), 0);
+			verts->InsertCellPoint(valueIndex);
+			valueIndex++;
+		}
 	}
 
 	output->SetPoints(points);
@@ -109,6 +199,24 @@ int HeatmapDensityFilter::RequestData(vtkInformation* info,
 	return 1;
 }
 
+int HeatmapDensityFilter::RequestDataObject(vtkInformation* request,
+        vtkInformationVector** inputVector,
+        vtkInformationVector* outputVector) {
+	vtkInformation* outInfo = outputVector->GetInformationObject(0);
+	vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+
+	// Replace the output whenever the requested type of output has changed
+	if (this->imageOutputEnabled && !vtkImageData::SafeDownCast(output)) {
+		vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+		outInfo->Set(vtkDataObject::DATA_OBJECT(), image);
+	} else if (!this->imageOutputEnabled && !vtkPolyData::SafeDownCast(output)) {
+		vtkSmartPointer<vtkPolyData> polyData = vtkSmartPointer<vtkPolyData>::New();
+		outInfo->Set(vtkDataObject::DATA_OBJECT(), polyData);
+	}
+
+	return 1;
+}
+
 int HeatmapDensityFilter::RequestInformation(vtkInformation* request,
         vtkInformationVector** inputVector,
         vtkInformationVector* outputVector) {
@@ -116,11 +224,20 @@ int HeatmapDensityFilter::RequestInformation(vtkInformation* request,
 
 	outInfo->Set(Data::VTK_DATA_STATE(), Data::DENSITY_MAPPED);
 
+	// Images need to announce their extent, which only depends on the resolution
+	if (this->imageOutputEnabled) {
+		outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), 0,
+		             std::max(this->horizontalResolution, 0), 0, std::max(this->verticalResolution, 0), 0,
+		             0);
+	} else {
+		outInfo->Remove(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT());
+	}
+
 	return 1;
 }
 
 int HeatmapDensityFilter::FillOutputPortInformation(int port, vtkInformation* info) {
-	info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkPolyData");
+	info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkDataSet");
 	return 1;
 }
 
@@ -4,18 +4,19 @@
 #include <Utils/Misc/Macros.hpp>
 
 #include <vtkInformation.h>
-#include <vtkPolyDataAlgorithm.h>
+#include <vtkDataObjectAlgorithm.h>
 
 #include <qstring.h>
 
 /**
  * Filter that receives vtkPolyData and calculates the data density for each point,
- * the resolution can be changed dynamically.
+ * the resolution can be changed dynamically. The densities are output either as a point cloud or
+ * as vtkImageData.
  */
-class HeatmapDensityFilter : public vtkPolyDataAlgorithm {
+class HeatmapDensityFilter : public vtkDataObjectAlgorithm {
 
 public:
-	vtkTypeMacro(HeatmapDensityFilter, vtkPolyDataAlgorithm)
+	vtkTypeMacro(HeatmapDensityFilter, vtkDataObjectAlgorithm)
 	static HeatmapDensityFilter* New();
 	void PrintSelf(ostream& os, vtkIndent indent) override;
 
@@ -31,10 +32,27 @@ public:
 	 */
 	void setVerticalHeatmapResolution(int verticalHeatmapResolution);
 
+	/**
+	 * Callback method for setting the bandwidth of the kernel density estimate.
+	 * @param kernelBandwidth The standard deviation of the Gaussian kernel in the unit of the point
+	 * coordinates, or 0 to output the raw amount of points per grid point
+	 */
+	void setKernelBandwidth(double kernelBandwidth);
+
+	/**
+	 * Callback method for setting whether the densities should be output as vtkImageData.
+	 * @param imageOutputEnabled True if vtkImageData should be output, false if vtkPolyData should
+	 * be output
+	 */
+	void setImageOutputEnabled(bool imageOutputEnabled);
+
 protected:
 	int RequestData(vtkInformation* info,
 	                vtkInformationVector** inputVector,
 	                vtkInformationVector* outputVector) override;
+	int RequestDataObject(vtkInformation* request,
+	                      vtkInformationVector** inputVector,
+	                      vtkInformationVector* outputVector) override;
 	int RequestInformation(vtkInformation* request,
 	                       vtkInformationVector** inputVector,
 	                       vtkInformationVector* outputVector) override;
@@ -66,6 +84,17 @@ private:
 	 * This filter's vertical grid resolution.
 	 */
 	int verticalResolution = 1;
+
+	/**
+	 * The standard deviation of the Gaussian kernel used for smoothing the densities, where 0
+	 * disables smoothing.
+	 */
+	double kernelBandwidth = 0;
+
+	/**
+	 * Whether the densities are output as vtkImageData instead of vtkPolyData.
+	 */
+	bool imageOutputEnabled = false;
 };
 
 #endif
@@ -0,0 +1,138 @@
+#include <Filter/HeatmapDensityFilter/DensityGrid.hpp>
+
+#include <Utils/Math/Functions.hpp>
+
+#include <cmath>
+
+const int64_t DensityGrid::MINIMUM_POINTS_PER_THREAD;
+
+/**
+ * Run a function over all rows of a grid, splitting them evenly among all available cores.
+ * @param rows The amount of rows
+ * @param function Called with the first and the end of each range of rows
+ */
+template<typename Function>
+static void runOnRows(int rows, const Function& function) {
+	int amountOfThreads = Threads::getAmountOfThreads(rows, 1);
+	Threads::run(amountOfThreads, [&](int thread) {
+		function(rows * thread / amountOfThreads, rows * (thread + 1) / amountOfThreads);
+	});
+}
+
+DensityGrid::DensityGrid(double minX, double minY, double horizontalStep, double verticalStep,
+                         int columns, int rows) : minX(minX), minY(minY),
+	horizontalStep(horizontalStep), verticalStep(verticalStep),
+	columns(std::max(columns, 1)), rows(std::max(rows, 1)) {
+	this->densities.assign((size_t) this->columns * this->rows, 0);
+}
+
+int DensityGrid::getDensity(int column, int row) const {
+	return this->densities[row * this->columns + column];
+}
+
+const std::vector<int>& DensityGrid::getDensities() const {
+	return this->densities;
+}
+
+int DensityGrid::getColumns() const {
+	return this->columns;
+}
+
+int DensityGrid::getRows() const {
+	return this->rows;
+}
+
+std::vector<float> DensityGrid::createKernel(double standardDeviation) {
+	// Narrower kernels would only put all their weight on the centre anyway
+	if (!(standardDeviation > 0.1)) {
+		return std::vector<float>(1, 1.0f);
+	}
+
+	int radius = (int) std::ceil(3 * standardDeviation);
+	std::vector<float> kernel(2 * radius + 1);
+
+	double sum = 0;
+	for (int i = -radius; i <= radius; i++) {
+		double weight = std::exp(-0.5 * (i * i) / (standardDeviation * standardDeviation));
+		kernel[i + radius] = weight;
+		sum += weight;
+	}
+	for (size_t i = 0; i < kernel.size(); i++) {
+		kernel[i] /= sum;
+	}
+
+	return kernel;
+}
+
+std::vector<float> DensityGrid::getSmoothedDensities(double horizontalBandwidth,
+        double verticalBandwidth, bool wrapHorizontally) const {
+	int columns = this->columns;
+	int rows = this->rows;
+
+	std::vector<float> horizontalKernel = DensityGrid::createKernel(
+	        this->horizontalStep > 0 ? horizontalBandwidth / this->horizontalStep : 0);
+	std::vector<float> verticalKernel = DensityGrid::createKernel(
+	        this->verticalStep > 0 ? verticalBandwidth / this->verticalStep : 0);
+	int horizontalRadius = horizontalKernel.size() / 2;
+	int verticalRadius = verticalKernel.size() / 2;
+
+	// When wrapping, the last column duplicates the first one and is left out of the blur
+	bool wrap = wrapHorizontally && columns > 1;
+	int period = wrap ? columns - 1 : columns;
+
+	// Blur each row, reading it from a copy padded with the values beyond its ends
+	std::vector<float> rowPass(this->densities.size(), 0.0f);
+	runOnRows(rows, [&](int begin, int end) {
+		std::vector<float> padded(period + 2 * horizontalRadius);
+
+		for (int y = begin; y < end; y++) {
+			const int* input = this->densities.data() + (size_t) y * columns;
+			float* output = rowPass.data() + (size_t) y * columns;
+
+			for (int i = 0; i < (int) padded.size(); i++) {
+				int source = i - horizontalRadius;
+				if (wrap) {
+					source = absoluteModulo(source, period);
+					padded[i] = input[source] + (source == 0 ? input[period] : 0);
+				} else {
+					padded[i] = source >= 0 && source < period ? input[source] : 0;
+				}
+			}
+
+			for (int k = 0; k < (int) horizontalKernel.size(); k++) {
+				float weight = horizontalKernel[k];
+				const float* shifted = padded.data() + k;
+				for (int x = 0; x < period; x++) {
+					output[x] += weight * shifted[x];
+				}
+			}
+
+			if (wrap) {
+				output[period] = output[0];
+			}
+		}
+	});
+
+	// Blur each column by adding up whole rows, which keeps the memory accesses sequential
+	std::vector<float> smoothedDensities(this->densities.size(), 0.0f);
+	runOnRows(rows, [&](int begin, int end) {
+		for (int y = begin; y < end; y++) {
+			float* output = smoothedDensities.data() + (size_t) y * columns;
+
+			for (int k = -verticalRadius; k <= verticalRadius; k++) {
+				int sourceRow = y + k;
+				if (sourceRow < 0 || sourceRow >= rows) {
+					continue;
+				}
+
+				float weight = verticalKernel[k + verticalRadius];
+				const float* input = rowPass.data() + (size_t) sourceRow * columns;
+				for (int x = 0; x < columns; x++) {
+					output[x] += weight * input[x];
+				}
+			}
+		}
+	});
+
+	return smoothedDensities;
+}
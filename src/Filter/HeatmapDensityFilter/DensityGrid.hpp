@@ -0,0 +1,188 @@
+#ifndef KRONOS_DENSITY_GRID_HPP
+#define KRONOS_DENSITY_GRID_HPP
+
+#include <Utils/Misc/Threads.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A regular two-dimensional grid counting the points closest to each of its nodes. The counts are
+ * stored in a single flat histogram with the column index varying fastest, which is also the order
+ * of point data in `vtkImageData`.
+ *
+ * Points are counted in parallel, each thread filling a partial histogram of its own that is
+ * summed up afterwards. Since each partial histogram is as large as the grid, fewer threads are
+ * used for grids that are large compared to the amount of points.
+ *
+ * The counts can be smoothed into a kernel density estimate by a Gaussian blur, which is applied
+ * as two separate passes along the rows and the columns.
+ */
+class DensityGrid {
+
+public:
+	/**
+	 * Create a new grid with all densities set to zero.
+	 * @param minX The x coordinate of the first column
+	 * @param minY The y coordinate of the first row
+	 * @param horizontalStep The distance between two columns
+	 * @param verticalStep The distance between two rows
+	 * @param columns The amount of columns
+	 * @param rows The amount of rows
+	 */
+	DensityGrid(double minX, double minY, double horizontalStep, double verticalStep, int columns,
+	            int rows);
+
+	/**
+	 * Add points to the nearest node of the grid each. Points outside of the grid are added to the
+	 * nearest node on its border, points with invalid coordinates are ignored.
+	 * @param coordinates The coordinates of all points, with a fixed amount of components per point
+	 * of which the first two are the x and y coordinates
+	 * @param amountOfPoints The amount of points
+	 * @param numberOfComponents The amount of components per point, at least two
+	 */
+	template<typename T>
+	void count(const T* coordinates, int64_t amountOfPoints, int numberOfComponents) {
+		int64_t amountOfCells = this->densities.size();
+
+		// A thread is only worth its partial histogram if it counts considerably more points
+		int amountOfThreads = Threads::getAmountOfThreads(amountOfPoints,
+		                      std::max<int64_t>(amountOfCells, MINIMUM_POINTS_PER_THREAD));
+
+		std::vector<std::vector<int>> partialDensities(amountOfThreads - 1,
+		                           std::vector<int>(amountOfCells, 0));
+
+		auto countRange = [&](int thread) {
+			int* histogram = thread == 0 ? this->densities.data() : partialDensities[thread - 1].data();
+			int64_t begin = amountOfPoints * thread / amountOfThreads;
+			int64_t end = amountOfPoints * (thread + 1) / amountOfThreads;
+
+			for (int64_t i = begin; i < end; i++) {
+				const T* point = coordinates + i * numberOfComponents;
+				int cell = this->getCell(point[0], point[1]);
+				if (cell >= 0) {
+					histogram[cell]++;
+				}
+			}
+		};
+
+		Threads::run(amountOfThreads, countRange);
+
+		if (partialDensities.empty()) {
+			return;
+		}
+
+		// Sum up the partial histograms, each thread taking a range of cells
+		auto mergeRange = [&](int thread) {
+			int64_t begin = amountOfCells * thread / amountOfThreads;
+			int64_t end = amountOfCells * (thread + 1) / amountOfThreads;
+
+			for (size_t p = 0; p < partialDensities.size(); p++) {
+				const int* partial = partialDensities[p].data();
+				for (int64_t i = begin; i < end; i++) {
+					this->densities[i] += partial[i];
+				}
+			}
+		};
+
+		Threads::run(amountOfThreads, mergeRange);
+	}
+
+	/**
+	 * Get the amount of points counted for a node.
+	 * @param column The column of the node
+	 * @param row The row of the node
+	 * @return The amount of points closest to the node
+	 */
+	int getDensity(int column, int row) const;
+
+	/**
+	 * Get the densities of all nodes, one row after another.
+	 * @return The flat histogram of this grid
+	 */
+	const std::vector<int>& getDensities() const;
+
+	/**
+	 * Get the densities of all nodes blurred by a Gaussian kernel, one row after another. The
+	 * total amount of points is kept, except for the share the kernel spreads beyond the grid.
+	 * @param horizontalBandwidth The standard deviation of the kernel along the x axis in the unit
+	 * of the coordinates
+	 * @param verticalBandwidth The standard deviation of the kernel along the y axis in the unit of
+	 * the coordinates
+	 * @param wrapHorizontally True if the first and the last column lie on the same meridian, in
+	 * which case the kernel wraps around instead of spreading beyond the grid
+	 * @return The smoothed amount of points at each node
+	 */
+	std::vector<float> getSmoothedDensities(double horizontalBandwidth, double verticalBandwidth,
+	                                        bool wrapHorizontally) const;
+
+	/**
+	 * @return The amount of columns of this grid
+	 */
+	int getColumns() const;
+
+	/**
+	 * @return The amount of rows of this grid
+	 */
+	int getRows() const;
+
+private:
+	/**
+	 * Get the index of the node nearest to a point.
+	 * @return The index into the histogram or -1 if the coordinates are invalid
+	 */
+	int getCell(double x, double y) const {
+		int column = DensityGrid::getIndex(x, this->minX, this->horizontalStep, this->columns);
+		int row = DensityGrid::getIndex(y, this->minY, this->verticalStep, this->rows);
+
+		if (column < 0 || row < 0) {
+			return -1;
+		}
+		return row * this->columns + column;
+	}
+
+	/**
+	 * Get the index of the grid line nearest to a coordinate along one axis.
+	 * @return The index clamped to the grid or -1 if the coordinate is invalid
+	 */
+	static int getIndex(double value, double minimum, double step, int count) {
+		if (!(step > 0)) {
+			return value == value ? 0 : -1;
+		}
+
+		double position = (value - minimum) / step + 0.5;
+		if (!(position >= 0)) {
+			// Either left of the grid or not a number
+			return position < 0 ? 0 : -1;
+		}
+		return position < count ? (int) position : count - 1;
+	}
+
+	/**
+	 * Create a normalized Gaussian kernel reaching three standard deviations to each side.
+	 * @param standardDeviation The standard deviation in grid cells
+	 * @return The weights of the kernel, centred on the middle element
+	 */
+	static std::vector<float> createKernel(double standardDeviation);
+
+	/**
+	 * The minimum amount of points a thread counts
+	 */
+	static const int64_t MINIMUM_POINTS_PER_THREAD = 1 << 16;
+
+	double minX;
+	double minY;
+	double horizontalStep;
+	double verticalStep;
+	int columns;
+	int rows;
+
+	/**
+	 * The amount of points counted for each node, one row after another
+	 */
+	std::vector<int> densities;
+
+};
+
+#endif
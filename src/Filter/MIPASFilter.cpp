@@ -1,5 +1,6 @@
 #include <vtkDataObjectAlgorithm.h>
 #include "MIPASFilter.h"
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include <vtkThreshold.h>
@@ -33,34 +34,30 @@ QList<Data::Type> MIPASFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>());
 }
 
-bool MIPASFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-                                vtkPointData* pointData) {
-	vtkSmartPointer<vtkDoubleArray> timeArray = vtkDoubleArray::SafeDownCast(
-	            pointData->GetAbstractArray("time"));
-	vtkSmartPointer<vtkFloatArray> altitudeArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetAbstractArray("altitude"));
-	vtkSmartPointer<vtkUnsignedIntArray> orbitArray = vtkUnsignedIntArray::SafeDownCast(
-	            pointData->GetAbstractArray("orbit_id"));
-	vtkSmartPointer<vtkUnsignedCharArray> profileArray = vtkUnsignedCharArray::SafeDownCast(
-	            pointData->GetAbstractArray("profile_id"));
-	vtkSmartPointer<vtkUnsignedCharArray> detectionArray = vtkUnsignedCharArray::SafeDownCast(
-	            pointData->GetAbstractArray("detection"));
+void MIPASFilter::evaluatePoints(vtkPointSet* inputData,
+                                 std::vector<unsigned char>& selection) {
+	const double* times = getValues<vtkDoubleArray>(inputData, "time");
+	const float* altitudes = getValues<vtkFloatArray>(inputData, "altitude");
+	const unsigned int* orbits = getValues<vtkUnsignedIntArray>(inputData, "orbit_id");
+	const unsigned char* profiles = getValues<vtkUnsignedCharArray>(inputData, "profile_id");
+	const unsigned char* detections = getValues<vtkUnsignedCharArray>(inputData, "detection");
 
-	if (!timeArray || !altitudeArray || !orbitArray || !profileArray || !detectionArray) {
-		return false;
+	if (!times || !altitudes || !orbits || !profiles || !detections) {
+		return;
 	}
 
-	double time = timeArray->GetTuple1(pointIndex);
-	float altitude = altitudeArray->GetTuple1(pointIndex);
-	int orbit = orbitArray->GetTuple1(pointIndex);
-	char detection = detectionArray->GetTuple1(pointIndex);
-	char profile = profileArray->GetTuple1(pointIndex);
-
-	return (this->lowerTimeLimit <= time && time <= this->upperTimeLimit)
-	       && (this->lowerAltitudeLimit <= altitude && altitude <= this->upperAltitudeLimit) &&
-	       (this->lowerOrbitLimit <= orbit && orbit <= this->upperOrbitLimit)
-	       && (this->lowerDetectionLimit <= detection && detection <= this->upperDetectionLimit)
-	       && (this->lowerProfileLimit <= profile && profile <= this->upperProfileLimit);
+	RangeSelection rangeSelection;
+	rangeSelection.addRange(times, this->lowerTimeLimit, this->upperTimeLimit,
+	                        this->getBlockSummaries(inputData, "time"));
+	rangeSelection.addRange(altitudes, this->lowerAltitudeLimit, this->upperAltitudeLimit,
+	                        this->getBlockSummaries(inputData, "altitude"));
+	rangeSelection.addRange(orbits, this->lowerOrbitLimit, this->upperOrbitLimit,
+	                        this->getBlockSummaries(inputData, "orbit_id"));
+	rangeSelection.addRange(detections, this->lowerDetectionLimit, this->upperDetectionLimit,
+	                        this->getBlockSummaries(inputData, "detection"));
+	rangeSelection.addRange(profiles, this->lowerProfileLimit, this->upperProfileLimit,
+	                        this->getBlockSummaries(inputData, "profile_id"));
+	rangeSelection.select(selection.data(), selection.size());
 }
 
 void MIPASFilter::SetInputConnection(vtkAlgorithmOutput* input) {
@@ -76,7 +76,7 @@ private:
 	MIPASFilter(const MIPASFilter&); //Not implemented
 	void operator=(const MIPASFilter&); //Not implemented
 	QList<Data::Type> getCompatibleDataTypes() override;
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData) override;
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection) override;
 
 	/**
 	 * the upper Limit for the Time
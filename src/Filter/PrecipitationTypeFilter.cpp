@@ -7,9 +7,8 @@
 
 PrecipitationTypeFilter::PrecipitationTypeFilter() {
 	// Display all precipitation types by default
-	for (int i = PrecipitationDataPoint::NONE; i <= PrecipitationDataPoint::HAIL; i++) {
-		this->precipitationTypeVisibilities.insert(static_cast<PrecipitationDataPoint::PrecipitationType>
-		        (i), true);
+	for (int i = Data::NONE; i <= Data::HAIL; i++) {
+		this->precipitationTypeVisibilities.insert(static_cast<Data::PrecipitationType>(i), true);
 	}
 }
 PrecipitationTypeFilter::~PrecipitationTypeFilter() { }
@@ -20,48 +19,54 @@ QList<Data::Type> PrecipitationTypeFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>() << Data::PRECIPITATION);
 }
 
-bool PrecipitationTypeFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-        vtkPointData* pointData) {
-	vtkSmartPointer<vtkIntArray> precipitationTypeArray = vtkIntArray::SafeDownCast(
-	            pointData->GetArray("precipitationTypes"));
+void PrecipitationTypeFilter::evaluatePoints(vtkPointSet* inputData,
+        std::vector<unsigned char>& selection) {
+	const int* precipitationTypes = getValues<vtkIntArray>(inputData, "precipitationTypes");
 
-	if (!precipitationTypeArray) {
-		return false;
+	if (!precipitationTypes) {
+		return;
 	}
 
-	// For the point that should be checked, get its data type from the VTK data array and look up
-	// in the QMap `precipitationTypeVisibilities` whether points with this data type should be
-	// visible or not.
-	return this->precipitationTypeVisibilities[static_cast<PrecipitationDataPoint::PrecipitationType>
-	        (static_cast<int>(precipitationTypeArray->GetTuple1(pointIndex)))];
+	// Look up the visibility of each precipitation type in the QMap `precipitationTypeVisibilities`
+	// only once. Points of unknown types are hidden.
+	std::vector<unsigned char> visibilities(Data::HAIL + 1);
+	for (int type = Data::NONE; type <= Data::HAIL; type++) {
+		visibilities[type] = this->precipitationTypeVisibilities.value(
+		                         static_cast<Data::PrecipitationType>(type), false);
+	}
+
+	for (size_t i = 0; i < selection.size(); i++) {
+		int type = precipitationTypes[i];
+		selection[i] = type >= 0 && type < (int) visibilities.size() && visibilities[type];
+	}
 }
 
 void PrecipitationTypeFilter::SetInputConnection(vtkAlgorithmOutput* input) {
 	this->Superclass::SetInputConnection(input);
 }
 
-void PrecipitationTypeFilter::displayPrecipitationType(PrecipitationDataPoint::PrecipitationType
-        type, bool display) {
+void PrecipitationTypeFilter::displayPrecipitationType(Data::PrecipitationType type,
+        bool display) {
 	this->precipitationTypeVisibilities[type] = display;
 	this->Modified();
 }
 
 void PrecipitationTypeFilter::enableUndefined(int enabled) {
-	this->displayPrecipitationType(PrecipitationDataPoint::NONE, enabled);
+	this->displayPrecipitationType(Data::NONE, enabled);
 }
 
 void PrecipitationTypeFilter::enableRain(int enabled) {
-	this->displayPrecipitationType(PrecipitationDataPoint::RAIN, enabled);
+	this->displayPrecipitationType(Data::RAIN, enabled);
 }
 
 void PrecipitationTypeFilter::enableSnow(int enabled) {
-	this->displayPrecipitationType(PrecipitationDataPoint::SNOW, enabled);
+	this->displayPrecipitationType(Data::SNOW, enabled);
 }
 
 void PrecipitationTypeFilter::enableSleet(int enabled) {
-	this->displayPrecipitationType(PrecipitationDataPoint::SLEET, enabled);
+	this->displayPrecipitationType(Data::SLEET, enabled);
 }
 
 void PrecipitationTypeFilter::enableHail(int enabled) {
-	this->displayPrecipitationType(PrecipitationDataPoint::HAIL, enabled);
+	this->displayPrecipitationType(Data::HAIL, enabled);
 }
@@ -5,7 +5,7 @@
 #include <qlist.h>
 
 #include <Filter/AbstractSelectionFilter.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
+#include <Reader/DataReader/Data.hpp>
 
 #include <vtkAlgorithmOutput.h>
 
@@ -60,20 +60,20 @@ private:
 	void operator=(const PrecipitationTypeFilter&);  // Not implemented.
 
 	QList<Data::Type> getCompatibleDataTypes();
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData);
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection);
 
 	/**
 	 * Internal method that handles VTK-related mechanics to set a specific precipitation type's visibility.
 	 * @param type The precipitation type whose visibility should be changed
 	 * @param display True if the precipitation type should be displayed, false otherwise
 	 */
-	void displayPrecipitationType(PrecipitationDataPoint::PrecipitationType type, bool display);
+	void displayPrecipitationType(Data::PrecipitationType type, bool display);
 
 	/**
 	 * An internal data structure that maps each precipitation type to a boolean value that denotes its visibility.
 	 * This will be updated on callbacks and used to build necessary VTK structures.
 	 */
-	QMap<PrecipitationDataPoint::PrecipitationType, bool> precipitationTypeVisibilities;
+	QMap<Data::PrecipitationType, bool> precipitationTypeVisibilities;
 };
 
 #endif
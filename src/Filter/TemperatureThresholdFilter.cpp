@@ -1,5 +1,6 @@
 #include <Filter/TemperatureThresholdFilter.h>
 
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
 #include <Reader/DataReader/Data.hpp>
 
 #include <vtkObjectFactory.h>
@@ -14,18 +15,18 @@ QList<Data::Type> TemperatureThresholdFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>() << Data::TEMPERATURE);
 }
 
-bool TemperatureThresholdFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-        vtkPointData* pointData) {
-	vtkSmartPointer<vtkFloatArray> temperatureArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetArray("temperatures"));
+void TemperatureThresholdFilter::evaluatePoints(vtkPointSet* inputData,
+        std::vector<unsigned char>& selection) {
+	const float* temperatures = getValues<vtkFloatArray>(inputData, "temperatures");
 
-	if (!temperatureArray) {
-		return false;
+	if (!temperatures) {
+		return;
 	}
 
-	float temperature = temperatureArray->GetTuple1(pointIndex);
-
-	return temperature >= this->lowerLimit && temperature <= this->upperLimit;
+	RangeSelection rangeSelection;
+	rangeSelection.addRange(temperatures, this->lowerLimit, this->upperLimit,
+	                        this->getBlockSummaries(inputData, "temperatures"));
+	rangeSelection.select(selection.data(), selection.size());
 }
 
 void TemperatureThresholdFilter::SetInputConnection(vtkAlgorithmOutput* input) {
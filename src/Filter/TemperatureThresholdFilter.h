@@ -38,7 +38,7 @@ private:
 	void operator=(const TemperatureThresholdFilter&);  // Not implemented.
 
 	QList<Data::Type> getCompatibleDataTypes();
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData);
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection);
 
 	/**
 	 * Stores the lower temperature limit for visible data points.
@@ -10,13 +10,16 @@
 #include <vtkExecutive.h>
 #include <vtkInformationExecutivePortVectorKey.h>
 
+#include <algorithm>
+
 vtkStandardNewMacro(TemporalAggregationFilter);
 
 const QList<Data::Type> TemporalAggregationFilter::SUPPORTED_DATA_TYPES = QList<Data::Type>() <<
         Data::PRECIPITATION << Data::TEMPERATURE << Data::WIND << Data::CLOUD_COVERAGE;
 
 TemporalAggregationFilter::TemporalAggregationFilter() : currentTimeStep(0),
-	dataAggregator() {
+	dataAggregator(), streaming(false), statistic(WindowAggregator::MEAN), percentile(50),
+	windowLength(0), requestedTimeStep(-1) {
 	this->SetNumberOfInputPorts(1);
 	this->SetNumberOfOutputPorts(1);
 }
@@ -34,6 +37,43 @@ void TemporalAggregationFilter::PrintSelf(ostream& os, vtkIndent indent) {
 	os << indent << "Temporal data point aggregation, Kronos Project" << endl;
 }
 
+void TemporalAggregationFilter::setStatistic(int statistic) {
+	this->statistic = static_cast<WindowAggregator::Statistic>(statistic);
+	this->Modified();
+}
+
+void TemporalAggregationFilter::setPercentile(double percentile) {
+	this->percentile = percentile;
+	this->Modified();
+}
+
+void TemporalAggregationFilter::setWindowLength(int windowLength) {
+	this->windowLength = windowLength;
+	this->Modified();
+}
+
+bool TemporalAggregationFilter::usesWindowAggregator() const {
+	return this->windowLength > 0 || this->statistic != WindowAggregator::MEAN;
+}
+
+void TemporalAggregationFilter::getWindow(vtkInformation* inInfo, vtkInformation* outInfo,
+        int& firstTimeStep, int& lastTimeStep) const {
+	int amountOfTimeSteps = inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+	double* inputTimeSteps = inInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+	firstTimeStep = 0;
+	lastTimeStep = amountOfTimeSteps - 1;
+
+	if (this->windowLength > 0 && inputTimeSteps
+	        && outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())) {
+		// The window ends with the last input time step that is not after the requested one
+		double requestedTime = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+		lastTimeStep = std::upper_bound(inputTimeSteps, inputTimeSteps + amountOfTimeSteps,
+		                                requestedTime) - inputTimeSteps - 1;
+		lastTimeStep = std::max(lastTimeStep, 0);
+		firstTimeStep = std::max(lastTimeStep - this->windowLength + 1, 0);
+	}
+}
+
 int TemporalAggregationFilter::FillInputPortInformation(int port, vtkInformation* info) {
 	if (port == 0) {
 		info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPolyData");
@@ -118,10 +158,15 @@ int TemporalAggregationFilter::RequestInformation (
 
 	// Pass all data set information to the aggregator
 	this->dataAggregator.setDataSetAttributes(this->dataType, this->timeResolution);
-
-	// This filter's output is an aggregation of values over time and therefore has no time information
-	outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
-	outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+	this->parallelAggregator.setDataSetAttributes(this->dataType, this->timeResolution);
+	this->windowAggregator.setDataSetAttributes(this->dataType, this->timeResolution);
+	this->windowAggregator.setStatistic(this->statistic, this->percentile, this->windowLength > 0);
+
+	if (this->windowLength <= 0) {
+		// This filter's output is an aggregation of values over time and therefore has no time information
+		outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+		outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+	}
 
 	// Update the state of the output data
 	outInfo->Set(Data::VTK_DATA_STATE(), Data::AGGREGATED);
@@ -140,11 +185,71 @@ int TemporalAggregationFilter::RequestData(
 	vtkPointSet* input = vtkPointSet::GetData(inInfo);
 	vtkPolyData* output = vtkPolyData::GetData(outInfo);
 
+	if (this->usesWindowAggregator()) {
+		// Move the window to the requested time step, only adding the time step requested last
+		int firstTimeStep, lastTimeStep;
+		this->getWindow(inInfo, outInfo, firstTimeStep, lastTimeStep);
+		this->windowAggregator.retainTimeSteps(firstTimeStep, lastTimeStep);
+
+		if (this->requestedTimeStep >= firstTimeStep && this->requestedTimeStep <= lastTimeStep
+		        && !this->windowAggregator.addTimeStep(this->requestedTimeStep, input)) {
+			this->fail("The input data lacks the arrays holding the values to be aggregated.");
+			return 0;
+		}
+
+		int missingTimeStep = this->windowAggregator.getMissingTimeStep(firstTimeStep, lastTimeStep);
+		if (missingTimeStep >= 0) {
+			// There are still time steps left, continue on
+			request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+			this->SetProgressText("Aggregating data...");
+			this->UpdateProgress((missingTimeStep - firstTimeStep) / (1.0 * (lastTimeStep -
+			                     firstTimeStep + 1)));
+		} else {
+			output->ShallowCopy(this->windowAggregator.getPolyData());
+			if (this->windowLength > 0
+			        && outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())) {
+				output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(),
+				                              outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()));
+			}
+			request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+			this->SetProgressText("");
+			this->SetProgress(1.0);
+		}
+
+		return 1;
+	}
+
 	if (this->currentTimeStep == 0) {
 		this->SetProgressText("Aggregating data...");
 		this->SetProgress(0.0);
 	}
 
+	if (this->currentTimeStep == 0 && !this->streaming && inInfo->Has(Data::VTK_START_TIME())) {
+		// The input has been asked for all time steps at once, which it only provided if the data
+		// set is not marked with a single time step. The request is withdrawn right away so that
+		// other consumers of the reader are not served all time steps as well.
+		inInfo->Remove(Data::VTK_ALL_TIME_STEPS());
+
+		vtkSmartPointer<vtkPolyData> aggregatedData;
+		if (!input->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP())) {
+			aggregatedData = this->parallelAggregator.aggregate(input,
+			                 inInfo->Get(Data::VTK_START_TIME()));
+		}
+
+		if (aggregatedData) {
+			output->ShallowCopy(aggregatedData);
+			request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+			this->SetProgressText("");
+			this->SetProgress(1.0);
+		} else {
+			// Fall back to iterating the time steps one after another
+			this->streaming = true;
+			request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+		}
+
+		return 1;
+	}
+
 	// Add the data from the current timestep to the accumulation
 	for (int i = 0; i < input->GetNumberOfPoints(); i++) {
 		double coordinates[3];
@@ -165,10 +270,11 @@ int TemporalAggregationFilter::RequestData(
 		                                vtkStreamingDemandDrivenPipeline::TIME_STEPS())));
 		this->UpdateProgress(progress);
 	} else {
-		// Everything has been accumulated
-		output->DeepCopy(this->dataAggregator.getPolyData());
+		// Everything has been accumulated, the aggregator's poly data is created anew each time
+		output->ShallowCopy(this->dataAggregator.getPolyData());
 		request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
 		this->currentTimeStep = 0;
+		this->streaming = false;
 		this->dataAggregator.clearAggregationData();
 		this->SetProgressText("");
 		this->SetProgress(1.0);
@@ -184,6 +290,36 @@ int TemporalAggregationFilter::RequestUpdateExtent (
 
 	vtkInformation* inputInformation = inputVector[0]->GetInformationObject(0);
 
+	if (this->usesWindowAggregator()) {
+		// Request the next time step of the window that has not been aggregated yet. If there is
+		// none, the last one is requested, which the window aggregator ignores.
+		inputInformation->Remove(Data::VTK_ALL_TIME_STEPS());
+
+		int firstTimeStep, lastTimeStep;
+		this->getWindow(inputInformation, outputVector->GetInformationObject(0), firstTimeStep,
+		                lastTimeStep);
+		this->requestedTimeStep = this->windowAggregator.getMissingTimeStep(firstTimeStep,
+		                          lastTimeStep);
+
+		double* inputTimeSteps = inputInformation->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+		int inputTimeStep = this->requestedTimeStep >= 0 ? this->requestedTimeStep : lastTimeStep;
+		if (inputTimeSteps && inputTimeStep >= 0) {
+			inputInformation->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(),
+			                      inputTimeSteps[inputTimeStep]);
+		}
+
+		return 1;
+	}
+
+	// Ask a directly connected reader for all time steps at once unless it did not provide them
+	if (this->currentTimeStep == 0 && !this->streaming
+	        && inputInformation->Has(Data::VTK_START_TIME())) {
+		inputInformation->Set(Data::VTK_ALL_TIME_STEPS(), 1);
+		inputInformation->Remove(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+		return 1;
+	}
+	inputInformation->Remove(Data::VTK_ALL_TIME_STEPS());
+
 	// Make the pipeline executive iterate the upstream pipeline time steps by setting the update time step appropiately
 	double* inputTimeSteps = inputInformation->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
 	if (inputTimeSteps) {
@@ -4,6 +4,8 @@
 #include <Reader/DataReader/Data.hpp>
 #include <Utils/Misc/PointCoordinates.hpp>
 #include <Filter/TemporalAggregationFilter/DataAggregator.hpp>
+#include <Filter/TemporalAggregationFilter/ParallelAggregator.hpp>
+#include <Filter/TemporalAggregationFilter/WindowAggregator.hpp>
 
 #include <vtkFiltersGeneralModule.h>
 #include <vtkPassInputTypeAlgorithm.h>
@@ -20,6 +22,26 @@ public:
 	vtkTypeMacro(TemporalAggregationFilter, vtkPassInputTypeAlgorithm);
 	void PrintSelf(ostream& os, vtkIndent indent);
 
+	/**
+	 * Callback method for setting the statistic calculated from the values of each point.
+	 * @param statistic The statistic (0 stands for the average or accumulation, 1 for the
+	 * minimum, 2 for the maximum, 3 for the standard deviation and 4 for a percentile)
+	 */
+	void setStatistic(int statistic);
+
+	/**
+	 * Callback method for setting the percentile calculated if the statistic is a percentile.
+	 * @param percentile The percentile within [0, 100]
+	 */
+	void setPercentile(double percentile);
+
+	/**
+	 * Callback method for setting the length of the window following the time slider.
+	 * @param windowLength The amount of time steps up to the current one that are aggregated, or 0
+	 * to aggregate all time steps at once
+	 */
+	void setWindowLength(int windowLength);
+
 protected:
 	TemporalAggregationFilter();
 	~TemporalAggregationFilter();
@@ -45,6 +67,23 @@ private:
 	 */
 	void fail(QString message);
 
+	/**
+	 * Check whether the aggregation is done by the window aggregator, which is the case for a
+	 * window following the time slider and for any statistic other than the average.
+	 * @return True if the window aggregator is used, false otherwise
+	 */
+	bool usesWindowAggregator() const;
+
+	/**
+	 * Determine the input time steps to be aggregated for the time step requested downstream.
+	 * @param inInfo The input information holding the input's time steps
+	 * @param outInfo The output information holding the requested time step
+	 * @param firstTimeStep The index of the first input time step is written here
+	 * @param lastTimeStep The index of the last input time step is written here
+	 */
+	void getWindow(vtkInformation* inInfo, vtkInformation* outInfo, int& firstTimeStep,
+	               int& lastTimeStep) const;
+
 	/**
 	 * This integer will store the current time step while this filter iterates through all of them
 	 * to aggregate data.
@@ -71,6 +110,43 @@ private:
 	 */
 	DataAggregator dataAggregator;
 
+	/**
+	 * Aggregates all time steps at once if the input can provide them in a single data set.
+	 */
+	ParallelAggregator parallelAggregator;
+
+	/**
+	 * Boolean flag denoting whether this filter iterates the input's time steps one after another
+	 * since the input did not provide all of them at once.
+	 */
+	bool streaming;
+
+	/**
+	 * Aggregates the time steps of the window or calculates any statistic other than the average.
+	 */
+	WindowAggregator windowAggregator;
+
+	/**
+	 * The statistic calculated from the values of each point.
+	 */
+	WindowAggregator::Statistic statistic;
+
+	/**
+	 * The percentile calculated if the statistic is a percentile.
+	 */
+	double percentile;
+
+	/**
+	 * The amount of time steps aggregated up to the current one, or 0 for all time steps.
+	 */
+	int windowLength;
+
+	/**
+	 * The index of the input time step requested from the window aggregator's input, or -1 if the
+	 * window aggregator already holds all time steps needed.
+	 */
+	int requestedTimeStep;
+
 	TemporalAggregationFilter(const TemporalAggregationFilter&); // Not implemented.
 	void operator=(const TemporalAggregationFilter&); // Not implemented.
 };
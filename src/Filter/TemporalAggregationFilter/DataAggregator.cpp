@@ -4,6 +4,7 @@
 #include <Filter/TemporalAggregationFilter/TemperatureAggregationValue.hpp>
 #include <Filter/TemporalAggregationFilter/WindAggregationValue.hpp>
 #include <Filter/TemporalAggregationFilter/CloudCoverageAggregationValue.hpp>
+#include <Utils/Math/WindVectors.hpp>
 #include <Utils/Misc/Macros.hpp>
 
 #include <vtkPoints.h>
@@ -11,6 +12,8 @@
 #include <vtkDataArray.h>
 #include <vtkFloatArray.h>
 
+#include <vector>
+
 DataAggregator::DataAggregator() : lastTimeIndex(0) { }
 
 DataAggregator::~DataAggregator() {
@@ -110,7 +113,10 @@ void DataAggregator::addPointData(int pointIndex, PointCoordinates coordinates,
 		}
 
 		double currentVelocity = velocitiesArray->GetValue(pointIndex);
-		double currentBearing = bearingsArray->GetValue(pointIndex);
+
+		// Bearings wrap around, so they are averaged as vectors: 350° and 10° average to 0°
+		float currentEastward, currentNorthward;
+		WindVectors::toComponents(bearingsArray->GetValue(pointIndex), currentEastward, currentNorthward);
 
 		if (this->aggregatedData.contains(coordinates)) {
 			// The point has already been looked at before
@@ -121,14 +127,17 @@ void DataAggregator::addPointData(int pointIndex, PointCoordinates coordinates,
 			// This is a bit more costly than the naive way to calculate the average but prevents huge numbers from showing up while summing up all values.
 			currentValue->setAverageVelocity((currentVelocity + (currentValue->getTimeIndex() *
 			                                  currentValue->getAverageVelocity())) / (currentValue->getTimeIndex() * 1.0 + 1));
-			currentValue->setAverageBearing((currentBearing + (currentValue->getTimeIndex() *
-			                                 currentValue->getAverageBearing())) / (currentValue->getTimeIndex() * 1.0 + 1));
+			currentValue->setAverageEastward((currentEastward + (currentValue->getTimeIndex() *
+			                                  currentValue->getAverageEastward())) / (currentValue->getTimeIndex() * 1.0 + 1));
+			currentValue->setAverageNorthward((currentNorthward + (currentValue->getTimeIndex() *
+			                                   currentValue->getAverageNorthward())) / (currentValue->getTimeIndex() * 1.0 + 1));
 			currentValue->setTimeIndex(currentValue->getTimeIndex() + 1);
 		} else {
 			// This is the first time a point with these coordinates shows up
 			WindAggregationValue* newValue = new WindAggregationValue();
 			newValue->setAverageVelocity(currentVelocity);
-			newValue->setAverageBearing(currentBearing);
+			newValue->setAverageEastward(currentEastward);
+			newValue->setAverageNorthward(currentNorthward);
 			newValue->setTimeIndex(1);
 			this->aggregatedData.insert(coordinates, newValue);
 		}
@@ -254,6 +263,10 @@ vtkSmartPointer<vtkPolyData> DataAggregator::getPolyData() {
 		aggregatedDirections->SetNumberOfTuples(this->aggregatedData.size());
 		aggregatedDirections->SetName("Average Wind Directions");
 
+		// The average bearings are recomposed from their components all at once
+		std::vector<float> averageEastwards(this->aggregatedData.size());
+		std::vector<float> averageNorthwards(this->aggregatedData.size());
+
 		// Iterate over all points in the aggregated data
 		QMap<PointCoordinates, AggregationValue*>::iterator i;
 		int tupleNumber = 0;
@@ -269,15 +282,16 @@ vtkSmartPointer<vtkPolyData> DataAggregator::getPolyData() {
 			};
 			aggregatedSpeeds->SetTuple(tupleNumber, aggregatedSpeed);
 
-			// Add the point's average direction
-			double aggregatedBearing[1] = {
-				(double) currentValue->getAverageBearing()
-			};
-			aggregatedDirections->SetTuple(tupleNumber, aggregatedBearing);
+			// Collect the point's average direction
+			averageEastwards[tupleNumber] = currentValue->getAverageEastward();
+			averageNorthwards[tupleNumber] = currentValue->getAverageNorthward();
 
 			tupleNumber++;
 		}
 
+		WindVectors::toBearings(averageEastwards.data(), averageNorthwards.data(),
+		                        aggregatedDirections->GetPointer(0), averageEastwards.size());
+
 		dataSet->GetPointData()->AddArray(aggregatedSpeeds);
 		dataSet->GetPointData()->AddArray(aggregatedDirections);
 		break;
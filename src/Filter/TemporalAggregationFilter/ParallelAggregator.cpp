@@ -0,0 +1,318 @@
+#include <Filter/TemporalAggregationFilter/ParallelAggregator.hpp>
+
+#include <Utils/Math/WindVectors.hpp>
+#include <Utils/Misc/PointCoordinates.hpp>
+#include <Utils/Misc/Threads.hpp>
+
+#include <vtkPoints.h>
+#include <vtkCellArray.h>
+#include <vtkPointData.h>
+#include <vtkFloatArray.h>
+#include <vtkIntArray.h>
+
+#include <qstringlist.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The smallest amount of data points worth another thread
+ */
+static const int MINIMUM_POINTS_PER_THREAD = 65536;
+
+/**
+ * The aggregated values of a point, whose meaning depends on the data type.
+ */
+struct AggregatedPoint {
+	PointCoordinates coordinates;
+	double values[3];
+
+	bool operator<(const AggregatedPoint& other) const {
+		return this->coordinates < other.coordinates;
+	}
+};
+
+/**
+ * Get the coordinates of a point of a data set.
+ */
+static PointCoordinates getCoordinates(vtkPointSet* input, vtkIdType index) {
+	double point[3];
+	input->GetPoint(index, point);
+	return PointCoordinates(point[0], point[1], point[2]);
+}
+
+ParallelAggregator::ParallelAggregator() : dataType(Data::TEMPERATURE), timeResolution(0) { }
+
+ParallelAggregator::~ParallelAggregator() { }
+
+void ParallelAggregator::setDataSetAttributes(Data::Type dataType, int timeResolution) {
+	this->dataType = dataType;
+	this->timeResolution = timeResolution;
+}
+
+vtkSmartPointer<vtkPolyData> ParallelAggregator::aggregate(vtkPointSet* input,
+        int startTime) const {
+	// Look up the same arrays as the DataAggregator does, but only once
+	QStringList arrayNames;
+	switch (this->dataType) {
+	case Data::PRECIPITATION:
+		arrayNames << "precipitationRates";
+		break;
+	case Data::TEMPERATURE:
+		arrayNames << "temperatures";
+		break;
+	case Data::WIND:
+		arrayNames << "speeds" << "directions";
+		break;
+	case Data::CLOUD_COVERAGE:
+		arrayNames << "cloudCovers";
+		break;
+	default:
+		return nullptr;
+	}
+
+	std::vector<const float*> columns;
+	for (int a = 0; a < arrayNames.size(); a++) {
+		vtkFloatArray* array = vtkFloatArray::SafeDownCast(input->GetPointData()->GetArray(
+		                           arrayNames[a].toStdString().c_str()));
+		if (!array) {
+			return nullptr;
+		}
+		columns.push_back(array->GetPointer(0));
+	}
+
+	vtkIntArray* timestampArray = vtkIntArray::SafeDownCast(
+	                                  input->GetPointData()->GetArray("timestamps"));
+	if (!timestampArray) {
+		return nullptr;
+	}
+	const int* timestamps = timestampArray->GetPointer(0);
+	int timeResolution = std::max(this->timeResolution, 1);
+
+	vtkIdType amountOfPoints = input->GetNumberOfPoints();
+	int amountOfThreads = Threads::getAmountOfThreads(amountOfPoints, MINIMUM_POINTS_PER_THREAD);
+
+	// Assign each point to the thread reducing it by the hash of its coordinates, counting the
+	// points each thread hands to each other one
+	std::vector<int> owners(amountOfPoints);
+	std::vector<int64_t> counts((size_t) amountOfThreads * amountOfThreads, 0);
+	std::vector<int> lastTimeSteps(amountOfThreads, 0);
+
+	Threads::run(amountOfThreads, [&](int thread) {
+		vtkIdType begin = amountOfPoints * thread / amountOfThreads;
+		vtkIdType end = amountOfPoints * (thread + 1) / amountOfThreads;
+		int64_t* threadCounts = &counts[(size_t) thread * amountOfThreads];
+		PointCoordinatesHash hash;
+
+		for (vtkIdType i = begin; i < end; i++) {
+			int owner = hash(getCoordinates(input, i)) % amountOfThreads;
+			owners[i] = owner;
+			threadCounts[owner]++;
+
+			lastTimeSteps[thread] = std::max(lastTimeSteps[thread],
+			                                 (timestamps[i] - startTime) / timeResolution);
+		}
+	});
+
+	int lastTimeStep = *std::max_element(lastTimeSteps.begin(), lastTimeSteps.end());
+
+	// Each owner gets a contiguous partition, filled by the threads in the order of their ranges
+	// so that the points of a partition keep their input order
+	std::vector<int64_t> offsets((size_t) amountOfThreads * amountOfThreads);
+	std::vector<int64_t> partitionBegins(amountOfThreads + 1);
+	int64_t offset = 0;
+	for (int owner = 0; owner < amountOfThreads; owner++) {
+		partitionBegins[owner] = offset;
+		for (int thread = 0; thread < amountOfThreads; thread++) {
+			offsets[(size_t) thread * amountOfThreads + owner] = offset;
+			offset += counts[(size_t) thread * amountOfThreads + owner];
+		}
+	}
+	partitionBegins[amountOfThreads] = offset;
+
+	std::vector<vtkIdType> order(amountOfPoints);
+	Threads::run(amountOfThreads, [&](int thread) {
+		vtkIdType begin = amountOfPoints * thread / amountOfThreads;
+		vtkIdType end = amountOfPoints * (thread + 1) / amountOfThreads;
+		int64_t* threadOffsets = &offsets[(size_t) thread * amountOfThreads];
+
+		for (vtkIdType i = begin; i < end; i++) {
+			order[threadOffsets[owners[i]]++] = i;
+		}
+	});
+
+	// Each thread groups the points of its partition by their coordinates and reduces each group
+	std::vector<std::vector<AggregatedPoint>> partialResults(amountOfThreads);
+
+	Threads::run(amountOfThreads, [&](int thread) {
+		int64_t begin = partitionBegins[thread];
+		int64_t size = partitionBegins[thread + 1] - begin;
+
+		std::unordered_map<PointCoordinates, int, PointCoordinatesHash> groups;
+		std::vector<AggregatedPoint>& results = partialResults[thread];
+		std::vector<int> groupOfEntry(size);
+
+		for (int64_t k = 0; k < size; k++) {
+			PointCoordinates coordinates = getCoordinates(input, order[begin + k]);
+			std::unordered_map<PointCoordinates, int, PointCoordinatesHash>::iterator group =
+			    groups.find(coordinates);
+
+			if (group == groups.end()) {
+				group = groups.insert(std::make_pair(coordinates, (int) results.size())).first;
+				AggregatedPoint result;
+				result.coordinates = coordinates;
+				results.push_back(result);
+			}
+			groupOfEntry[k] = group->second;
+		}
+
+		// Sort the entries by their group, keeping the input order within each group
+		std::vector<int64_t> groupBegins(results.size() + 1, 0);
+		for (int64_t k = 0; k < size; k++) {
+			groupBegins[groupOfEntry[k] + 1]++;
+		}
+		for (size_t g = 0; g < results.size(); g++) {
+			groupBegins[g + 1] += groupBegins[g];
+		}
+
+		std::vector<vtkIdType> entries(size);
+		std::vector<int64_t> positions(groupBegins.begin(), groupBegins.end() - 1);
+		for (int64_t k = 0; k < size; k++) {
+			entries[positions[groupOfEntry[k]]++] = order[begin + k];
+		}
+
+		auto getTimeStep = [&](vtkIdType i) {
+			return (timestamps[i] - startTime) / timeResolution;
+		};
+
+		for (size_t g = 0; g < results.size(); g++) {
+			vtkIdType* first = entries.data() + groupBegins[g];
+			vtkIdType* last = entries.data() + groupBegins[g + 1];
+			double count = last - first;
+			double* values = results[g].values;
+
+			switch (this->dataType) {
+			case Data::PRECIPITATION: {
+				// Accumulate the precipitation in the order of time, assuming each rate lasts until
+				// the next one is known, just like the DataAggregator does
+				std::stable_sort(first, last, [&](vtkIdType a, vtkIdType b) {
+					return getTimeStep(a) < getTimeStep(b);
+				});
+
+				double accumulatedPrecipitation = 0;
+				for (vtkIdType* entry = first + 1; entry < last; entry++) {
+					accumulatedPrecipitation += (1.0 * (getTimeStep(*entry) - getTimeStep(*(entry - 1)))
+					                             * this->timeResolution) * columns[0][*(entry - 1)];
+				}
+				accumulatedPrecipitation += (1.0 * (lastTimeStep - getTimeStep(*(last - 1)) + 1)
+				                             * this->timeResolution) * columns[0][*(last - 1)];
+
+				values[0] = accumulatedPrecipitation;
+				break;
+			}
+			case Data::WIND: {
+				// Bearings are averaged as vectors
+				double speedSum = 0;
+				double eastwardSum = 0;
+				double northwardSum = 0;
+				for (vtkIdType* entry = first; entry < last; entry++) {
+					float eastward, northward;
+					WindVectors::toComponents(columns[1][*entry], eastward, northward);
+					speedSum += columns[0][*entry];
+					eastwardSum += eastward;
+					northwardSum += northward;
+				}
+
+				values[0] = speedSum / count;
+				values[1] = eastwardSum / count;
+				values[2] = northwardSum / count;
+				break;
+			}
+			default: {
+				double sum = 0;
+				for (vtkIdType* entry = first; entry < last; entry++) {
+					sum += columns[0][*entry];
+				}
+
+				values[0] = sum / count;
+				break;
+			}
+			}
+		}
+	});
+
+	// Order the points like the DataAggregator does, by their coordinates
+	std::vector<AggregatedPoint> results;
+	for (int thread = 0; thread < amountOfThreads; thread++) {
+		results.insert(results.end(), partialResults[thread].begin(), partialResults[thread].end());
+		std::vector<AggregatedPoint>().swap(partialResults[thread]);
+	}
+	std::sort(results.begin(), results.end());
+
+	// Create the content of the output poly data object
+	vtkSmartPointer<vtkPolyData> dataSet = vtkSmartPointer<vtkPolyData>::New();
+	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+	points->SetNumberOfPoints(results.size());
+	vtkSmartPointer<vtkCellArray> vertices = vtkSmartPointer<vtkCellArray>::New();
+	vertices->Allocate(vertices->EstimateSize(1, results.size()));
+	vertices->InsertNextCell(results.size());
+
+	for (size_t i = 0; i < results.size(); i++) {
+		points->SetPoint(i, results[i].coordinates.getX(), results[i].coordinates.getY(),
+		                 results[i].coordinates.getZ());
+		vertices->InsertCellPoint(i);
+	}
+
+	QStringList outputNames;
+	switch (this->dataType) {
+	case Data::PRECIPITATION:
+		outputNames << "Accumulated Precipitation Amounts";
+		break;
+	case Data::TEMPERATURE:
+		outputNames << "Average Temperatures";
+		break;
+	case Data::WIND:
+		outputNames << "Average Wind Speeds" << "Average Wind Directions";
+		break;
+	default:
+		outputNames << "Average Cloud Coverage Values";
+		break;
+	}
+
+	std::vector<vtkSmartPointer<vtkFloatArray>> outputArrays;
+	for (int a = 0; a < outputNames.size(); a++) {
+		vtkSmartPointer<vtkFloatArray> array = vtkSmartPointer<vtkFloatArray>::New();
+		array->SetNumberOfComponents(1);
+		array->SetNumberOfTuples(results.size());
+		array->SetName(outputNames[a].toStdString().c_str());
+		outputArrays.push_back(array);
+	}
+
+	for (size_t i = 0; i < results.size(); i++) {
+		outputArrays[0]->SetValue(i, results[i].values[0]);
+	}
+
+	if (this->dataType == Data::WIND) {
+		// Recompose the average bearings from their components all at once
+		std::vector<float> averageEastwards(results.size());
+		std::vector<float> averageNorthwards(results.size());
+		for (size_t i = 0; i < results.size(); i++) {
+			averageEastwards[i] = results[i].values[1];
+			averageNorthwards[i] = results[i].values[2];
+		}
+
+		WindVectors::toBearings(averageEastwards.data(), averageNorthwards.data(),
+		                        outputArrays[1]->GetPointer(0), results.size());
+	}
+
+	for (size_t a = 0; a < outputArrays.size(); a++) {
+		dataSet->GetPointData()->AddArray(outputArrays[a]);
+	}
+
+	dataSet->SetPoints(points);
+	dataSet->SetVerts(vertices);
+
+	return dataSet;
+}
@@ -0,0 +1,56 @@
+#ifndef KRONOS_PARALLEL_AGGREGATOR_HPP
+#define KRONOS_PARALLEL_AGGREGATOR_HPP
+
+#include <Reader/DataReader/Data.hpp>
+
+#include <vtkSmartPointer.h>
+#include <vtkPolyData.h>
+#include <vtkPointSet.h>
+
+/**
+ * Aggregates the data points of all time steps at once, producing the same output as a
+ * `DataAggregator` fed with one time step after another.
+ *
+ * Instead of looking up every data point in a map, the points are partitioned by the hash of
+ * their coordinates, so that each thread owns all occurrences of its points and reduces them
+ * without any synchronization. The aggregated points are sorted by their coordinates afterwards.
+ */
+class ParallelAggregator {
+
+public:
+	/**
+	 * Create a new ParallelAggregator.
+	 */
+	ParallelAggregator();
+	~ParallelAggregator();
+
+	/**
+	 * Define some attributes of the input data set that stay the same for all data points.
+	 * @param dataType The type of the input data
+	 * @param timeResolution The temporal resolution of the input data set
+	 */
+	void setDataSetAttributes(Data::Type dataType, int timeResolution);
+
+	/**
+	 * Aggregate the data points of all time steps.
+	 * @param input The data points of all time steps, each carrying its timestamp in the
+	 * `timestamps` array
+	 * @param startTime The timestamp starting the first time step
+	 * @return A poly data object of the aggregated data as returned by
+	 * `DataAggregator::getPolyData`, or a null pointer if the input lacks any of the arrays needed
+	 */
+	vtkSmartPointer<vtkPolyData> aggregate(vtkPointSet* input, int startTime) const;
+
+private:
+	/**
+	 * Stores the data type of the input data.
+	 */
+	Data::Type dataType;
+
+	/**
+	 * Stores the time resolution of the input data.
+	 */
+	int timeResolution;
+};
+
+#endif
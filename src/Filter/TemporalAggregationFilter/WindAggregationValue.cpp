@@ -1,14 +1,23 @@
 #include <Filter/TemporalAggregationFilter/WindAggregationValue.hpp>
 
-WindAggregationValue::WindAggregationValue() : averageBearing(0), averageVelocity(0) { }
+WindAggregationValue::WindAggregationValue() : averageEastward(0), averageNorthward(0),
+	averageVelocity(0) { }
 WindAggregationValue::~WindAggregationValue() { }
 
-void WindAggregationValue::setAverageBearing(double averageBearing) {
-	this->averageBearing = averageBearing;
+void WindAggregationValue::setAverageEastward(double averageEastward) {
+	this->averageEastward = averageEastward;
 }
 
-double WindAggregationValue::getAverageBearing() const {
-	return this->averageBearing;
+double WindAggregationValue::getAverageEastward() const {
+	return this->averageEastward;
+}
+
+void WindAggregationValue::setAverageNorthward(double averageNorthward) {
+	this->averageNorthward = averageNorthward;
+}
+
+double WindAggregationValue::getAverageNorthward() const {
+	return this->averageNorthward;
 }
 
 void WindAggregationValue::setAverageVelocity(double averageVelocity) {
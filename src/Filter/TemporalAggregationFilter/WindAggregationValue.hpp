@@ -4,7 +4,8 @@
 #include <Filter/TemporalAggregationFilter/AggregationValue.hpp>
 
 /**
- * Holds a wind data point's aggregated values.
+ * Holds a wind data point's aggregated values. Bearings wrap around and are therefore averaged as
+ * the components of their unit vectors.
  */
 class WindAggregationValue : public AggregationValue {
 
@@ -16,16 +17,28 @@ public:
 	~WindAggregationValue();
 
 	/**
-	* Set the average wind bearing of the data point.
-	* @param averageBearing The new average wind bearing
+	* Set the average eastward component of the unit vectors of the wind bearings.
+	* @param averageEastward The new average eastward component
 	*/
-	void setAverageBearing(double averageBearing);
+	void setAverageEastward(double averageEastward);
 
 	/**
-	* Get the average wind bearing of the data point.
-	* @return The current average wind bearing
+	* Get the average eastward component of the unit vectors of the wind bearings.
+	* @return The current average eastward component
 	*/
-	double getAverageBearing() const;
+	double getAverageEastward() const;
+
+	/**
+	* Set the average northward component of the unit vectors of the wind bearings.
+	* @param averageNorthward The new average northward component
+	*/
+	void setAverageNorthward(double averageNorthward);
+
+	/**
+	* Get the average northward component of the unit vectors of the wind bearings.
+	* @return The current average northward component
+	*/
+	double getAverageNorthward() const;
 
 	/**
 	* Set the average wind velocity of the data point.
@@ -40,7 +53,8 @@ public:
 	double getAverageVelocity() const;
 
 private:
-	double averageBearing;
+	double averageEastward;
+	double averageNorthward;
 	double averageVelocity;
 };
 
@@ -0,0 +1,339 @@
+#include <Filter/TemporalAggregationFilter/WindowAggregator.hpp>
+
+#include <Utils/Math/WindVectors.hpp>
+
+#include <vtkPoints.h>
+#include <vtkCellArray.h>
+#include <vtkPointData.h>
+#include <vtkFloatArray.h>
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Check whether the wind of a point can be aggregated, as missing values are NaN.
+ * @param speed The wind speed
+ * @param eastward The eastward component of the wind bearing
+ * @param northward The northward component of the wind bearing
+ * @return True if none of the values is NaN
+ */
+static bool hasWind(float speed, float eastward, float northward) {
+	return !std::isnan(speed) && !std::isnan(eastward) && !std::isnan(northward);
+}
+
+WindowAggregator::WindowAggregator() : dataType(Data::TEMPERATURE), timeResolution(0),
+	statistic(WindowAggregator::MEAN), percentile(50), removable(false) { }
+
+WindowAggregator::~WindowAggregator() { }
+
+void WindowAggregator::setDataSetAttributes(Data::Type dataType, int timeResolution) {
+	this->dataType = dataType;
+	this->timeResolution = timeResolution;
+	this->clearAggregationData();
+}
+
+void WindowAggregator::setStatistic(Statistic statistic, double percentile, bool removable) {
+	this->statistic = statistic;
+	this->percentile = std::min(std::max(percentile, 0.0), 100.0);
+	this->removable = removable;
+	this->clearAggregationData();
+}
+
+void WindowAggregator::clearAggregationData() {
+	this->slots.clear();
+	this->coordinates.clear();
+	this->counts.clear();
+	this->shifts.clear();
+	this->sums.clear();
+	this->squareSums.clear();
+	this->eastwardSums.clear();
+	this->northwardSums.clear();
+	this->sortedValues.clear();
+	this->timeSteps.clear();
+}
+
+bool WindowAggregator::addTimeStep(int timeStep, vtkPointSet* input) {
+	if (this->timeSteps.count(timeStep) > 0) {
+		return true;
+	}
+
+	const char* valueArrayName;
+	switch (this->dataType) {
+	case Data::PRECIPITATION:
+		valueArrayName = "precipitationRates";
+		break;
+	case Data::TEMPERATURE:
+		valueArrayName = "temperatures";
+		break;
+	case Data::WIND:
+		valueArrayName = "speeds";
+		break;
+	case Data::CLOUD_COVERAGE:
+		valueArrayName = "cloudCovers";
+		break;
+	default:
+		return false;
+	}
+
+	vtkFloatArray* valueArray = vtkFloatArray::SafeDownCast(input->GetPointData()->GetArray(
+	                                valueArrayName));
+	vtkFloatArray* bearingArray = vtkFloatArray::SafeDownCast(input->GetPointData()->GetArray(
+	                                  "directions"));
+	if (!valueArray || (this->dataType == Data::WIND && !bearingArray)) {
+		return false;
+	}
+
+	vtkIdType amountOfPoints = input->GetNumberOfPoints();
+	const float* values = valueArray->GetPointer(0);
+	TimeStepValues& addedValues = this->timeSteps[timeStep];
+
+	// Bearings are averaged as vectors, so they are decomposed all at once
+	std::vector<float> eastwards;
+	std::vector<float> northwards;
+	if (this->dataType == Data::WIND) {
+		eastwards.resize(amountOfPoints);
+		northwards.resize(amountOfPoints);
+		WindVectors::toComponents(bearingArray->GetPointer(0), eastwards.data(), northwards.data(),
+		                          amountOfPoints);
+	}
+
+	std::vector<int> pointSlots(amountOfPoints);
+	for (vtkIdType i = 0; i < amountOfPoints; i++) {
+		double point[3];
+		input->GetPoint(i, point);
+		PointCoordinates pointCoordinates(point[0], point[1], point[2]);
+
+		std::unordered_map<PointCoordinates, int, PointCoordinatesHash>::iterator slot =
+		    this->slots.find(pointCoordinates);
+		if (slot == this->slots.end()) {
+			// This is the first time a point with these coordinates shows up
+			slot = this->slots.insert(std::make_pair(pointCoordinates,
+			                          (int) this->coordinates.size())).first;
+			this->coordinates.push_back(pointCoordinates);
+			this->counts.push_back(0);
+			this->shifts.push_back(0);
+			this->sums.push_back(0);
+			this->squareSums.push_back(0);
+			this->eastwardSums.push_back(0);
+			this->northwardSums.push_back(0);
+			this->sortedValues.push_back(std::vector<float>());
+		}
+		pointSlots[i] = slot->second;
+
+		this->updateSlot(slot->second, values[i], 1);
+		if (this->dataType == Data::WIND && hasWind(values[i], eastwards[i], northwards[i])) {
+			this->eastwardSums[slot->second] += eastwards[i];
+			this->northwardSums[slot->second] += northwards[i];
+		}
+	}
+
+	if (this->removable) {
+		addedValues.slots.swap(pointSlots);
+		addedValues.values.assign(values, values + amountOfPoints);
+		addedValues.eastwards.swap(eastwards);
+		addedValues.northwards.swap(northwards);
+	}
+
+	return true;
+}
+
+void WindowAggregator::retainTimeSteps(int firstTimeStep, int lastTimeStep) {
+	std::map<int, TimeStepValues>::iterator timeStep = this->timeSteps.begin();
+	while (timeStep != this->timeSteps.end()) {
+		if (timeStep->first >= firstTimeStep && timeStep->first <= lastTimeStep) {
+			++timeStep;
+			continue;
+		}
+
+		if (!this->removable) {
+			// The values cannot be subtracted, so everything has to be aggregated anew
+			this->clearAggregationData();
+			return;
+		}
+
+		// Subtract the expired time step's values
+		const TimeStepValues& expiredValues = timeStep->second;
+		for (size_t i = 0; i < expiredValues.slots.size(); i++) {
+			int slot = expiredValues.slots[i];
+			this->updateSlot(slot, expiredValues.values[i], -1);
+
+			if (this->dataType == Data::WIND && hasWind(expiredValues.values[i],
+			        expiredValues.eastwards[i], expiredValues.northwards[i])) {
+				this->eastwardSums[slot] -= expiredValues.eastwards[i];
+				this->northwardSums[slot] -= expiredValues.northwards[i];
+			}
+			if (this->counts[slot] == 0) {
+				// Do not let rounding errors pile up in points that are gone
+				this->eastwardSums[slot] = 0;
+				this->northwardSums[slot] = 0;
+			}
+		}
+
+		timeStep = this->timeSteps.erase(timeStep);
+	}
+}
+
+int WindowAggregator::getMissingTimeStep(int firstTimeStep, int lastTimeStep) const {
+	for (int t = firstTimeStep; t <= lastTimeStep; t++) {
+		if (this->timeSteps.count(t) == 0) {
+			return t;
+		}
+	}
+	return -1;
+}
+
+void WindowAggregator::updateSlot(int slot, float value, int sign) {
+	// A missing value is skipped as if the point was not part of the time step
+	if (std::isnan(value)) {
+		return;
+	}
+
+	if (sign > 0 && this->counts[slot] == 0) {
+		this->shifts[slot] = value;
+	}
+
+	double shiftedValue = value - this->shifts[slot];
+	this->counts[slot] += sign;
+	this->sums[slot] += sign * shiftedValue;
+	this->squareSums[slot] += sign * shiftedValue * shiftedValue;
+
+	if (this->counts[slot] == 0) {
+		this->sums[slot] = 0;
+		this->squareSums[slot] = 0;
+	}
+
+	if (this->statistic == WindowAggregator::MINIMUM || this->statistic == WindowAggregator::MAXIMUM
+	        || this->statistic == WindowAggregator::PERCENTILE) {
+		std::vector<float>& sorted = this->sortedValues[slot];
+		if (sign > 0) {
+			sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), value), value);
+		} else {
+			std::vector<float>::iterator position = std::lower_bound(sorted.begin(), sorted.end(), value);
+			if (position != sorted.end() && *position == value) {
+				sorted.erase(position);
+			}
+		}
+	}
+}
+
+double WindowAggregator::getStatistic(int slot) const {
+	double count = this->counts[slot];
+	double mean = this->sums[slot] / count;
+
+	switch (this->statistic) {
+	case WindowAggregator::MEAN:
+		if (this->dataType == Data::PRECIPITATION) {
+			// Each rate lasts for one time step
+			return (count * this->shifts[slot] + this->sums[slot]) * this->timeResolution;
+		}
+		return this->shifts[slot] + mean;
+	case WindowAggregator::MINIMUM:
+		return this->sortedValues[slot].front();
+	case WindowAggregator::MAXIMUM:
+		return this->sortedValues[slot].back();
+	case WindowAggregator::STANDARD_DEVIATION:
+		return std::sqrt(std::max(this->squareSums[slot] / count - mean * mean, 0.0));
+	case WindowAggregator::PERCENTILE: {
+		// Interpolate linearly between the closest ranks
+		const std::vector<float>& sorted = this->sortedValues[slot];
+		double rank = this->percentile / 100 * (sorted.size() - 1);
+		size_t lowerRank = (size_t) rank;
+		size_t upperRank = std::min(lowerRank + 1, sorted.size() - 1);
+		return sorted[lowerRank] + (rank - lowerRank) * (sorted[upperRank] - sorted[lowerRank]);
+	}
+	default:
+		return 0;
+	}
+}
+
+QString WindowAggregator::getArrayName() const {
+	QString values;
+	QString value;
+	switch (this->dataType) {
+	case Data::PRECIPITATION:
+		if (this->statistic == WindowAggregator::MEAN) {
+			return "Accumulated Precipitation Amounts";
+		}
+		values = "Precipitation Rates";
+		value = "Precipitation Rate";
+		break;
+	case Data::TEMPERATURE:
+		values = "Temperatures";
+		value = "Temperature";
+		break;
+	case Data::WIND:
+		values = "Wind Speeds";
+		value = "Wind Speed";
+		break;
+	default:
+		values = "Cloud Coverage Values";
+		value = "Cloud Coverage";
+		break;
+	}
+
+	switch (this->statistic) {
+	case WindowAggregator::MINIMUM:
+		return QString("Minimum %1").arg(values);
+	case WindowAggregator::MAXIMUM:
+		return QString("Maximum %1").arg(values);
+	case WindowAggregator::STANDARD_DEVIATION:
+		return QString("%1 Standard Deviations").arg(value);
+	case WindowAggregator::PERCENTILE:
+		return QString("%1 Percentiles").arg(value);
+	default:
+		return QString("Average %1").arg(values);
+	}
+}
+
+vtkSmartPointer<vtkPolyData> WindowAggregator::getPolyData() const {
+	std::vector<int> presentSlots;
+	for (size_t slot = 0; slot < this->counts.size(); slot++) {
+		if (this->counts[slot] > 0) {
+			presentSlots.push_back(slot);
+		}
+	}
+
+	// Create the content of the output poly data object
+	vtkSmartPointer<vtkPolyData> dataSet = vtkSmartPointer<vtkPolyData>::New();
+	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+	points->SetNumberOfPoints(presentSlots.size());
+	vtkSmartPointer<vtkCellArray> vertices = vtkSmartPointer<vtkCellArray>::New();
+	vertices->Allocate(vertices->EstimateSize(1, presentSlots.size()));
+	vertices->InsertNextCell(presentSlots.size());
+
+	vtkSmartPointer<vtkFloatArray> statistics = vtkSmartPointer<vtkFloatArray>::New();
+	statistics->SetNumberOfComponents(1);
+	statistics->SetNumberOfTuples(presentSlots.size());
+	statistics->SetName(this->getArrayName().toStdString().c_str());
+
+	for (size_t i = 0; i < presentSlots.size(); i++) {
+		const PointCoordinates& pointCoordinates = this->coordinates[presentSlots[i]];
+		points->SetPoint(i, pointCoordinates.getX(), pointCoordinates.getY(), pointCoordinates.getZ());
+		vertices->InsertCellPoint(i);
+		statistics->SetValue(i, this->getStatistic(presentSlots[i]));
+	}
+	dataSet->GetPointData()->AddArray(statistics);
+
+	if (this->dataType == Data::WIND) {
+		// Recompose the average bearings from their components all at once
+		std::vector<float> eastwards(presentSlots.size());
+		std::vector<float> northwards(presentSlots.size());
+		for (size_t i = 0; i < presentSlots.size(); i++) {
+			eastwards[i] = this->eastwardSums[presentSlots[i]];
+			northwards[i] = this->northwardSums[presentSlots[i]];
+		}
+
+		vtkSmartPointer<vtkFloatArray> directions = vtkSmartPointer<vtkFloatArray>::New();
+		directions->SetNumberOfComponents(1);
+		directions->SetNumberOfTuples(presentSlots.size());
+		directions->SetName("Average Wind Directions");
+		WindVectors::toBearings(eastwards.data(), northwards.data(), directions->GetPointer(0),
+		                        presentSlots.size());
+		dataSet->GetPointData()->AddArray(directions);
+	}
+
+	dataSet->SetPoints(points);
+	dataSet->SetVerts(vertices);
+
+	return dataSet;
+}
@@ -0,0 +1,206 @@
+#ifndef KRONOS_WINDOW_AGGREGATOR_HPP
+#define KRONOS_WINDOW_AGGREGATOR_HPP
+
+#include <Utils/Misc/PointCoordinates.hpp>
+#include <Reader/DataReader/Data.hpp>
+
+#include <vtkSmartPointer.h>
+#include <vtkPolyData.h>
+#include <vtkPointSet.h>
+
+#include <qstring.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Aggregates a set of time steps that can grow and shrink one time step at a time, such as a
+ * window following the time slider. Adding a time step adds its values to running sums of each
+ * point and removing one subtracts them again, so moving a window by one time step only costs a
+ * pass over the points of the time steps entering and leaving it, whatever the window's length.
+ *
+ * Besides the mean, the minimum, maximum, standard deviation and a percentile of each point's
+ * values can be calculated. For those depending on the order of the values, each point keeps its
+ * values in the set sorted, so that adding or removing one is a binary search and a short move.
+ * Precipitation rates are accumulated to amounts in place of the mean and wind bearings are always
+ * averaged as vectors, while the statistic is applied to the wind speeds.
+ *
+ * Unlike the `DataAggregator`, a rate does not last until the next one is known: each time step
+ * only contributes the values it contains, which matches densely sampled or interpolated data.
+ * Missing values, which are NaN, are skipped both when adding and when removing a time step.
+ */
+class WindowAggregator {
+
+public:
+	/**
+	 * The statistic calculated from the values of each point.
+	 */
+	enum Statistic {
+		MEAN, MINIMUM, MAXIMUM, STANDARD_DEVIATION, PERCENTILE
+	};
+
+	/**
+	 * Create a new WindowAggregator.
+	 */
+	WindowAggregator();
+	~WindowAggregator();
+
+	/**
+	 * Define some attributes of the input data set that stay the same for all data points and
+	 * clear all aggregated values.
+	 * @param dataType The type of the input data
+	 * @param timeResolution The temporal resolution of the input data set
+	 */
+	void setDataSetAttributes(Data::Type dataType, int timeResolution);
+
+	/**
+	 * Define the statistic to calculate and clear all aggregated values.
+	 * @param statistic The statistic calculated from the values of each point
+	 * @param percentile The percentile calculated for `PERCENTILE`, within [0, 100]
+	 * @param removable True if time steps are going to be removed again, which requires keeping
+	 * a copy of their values
+	 */
+	void setStatistic(Statistic statistic, double percentile, bool removable);
+
+	/**
+	 * Add the values of a time step to the aggregation.
+	 * @param timeStep The index of the time step
+	 * @param input The data points of the time step
+	 * @return False if the input lacks any of the arrays needed, true otherwise
+	 */
+	bool addTimeStep(int timeStep, vtkPointSet* input);
+
+	/**
+	 * Remove all time steps outside of a range from the aggregation.
+	 * @param firstTimeStep The first time step to keep
+	 * @param lastTimeStep The last time step to keep
+	 */
+	void retainTimeSteps(int firstTimeStep, int lastTimeStep);
+
+	/**
+	 * Find a time step within a range that has not been added yet.
+	 * @param firstTimeStep The first time step of the range
+	 * @param lastTimeStep The last time step of the range
+	 * @return The index of the first missing time step or -1 if all of them have been added
+	 */
+	int getMissingTimeStep(int firstTimeStep, int lastTimeStep) const;
+
+	/**
+	 * Generate a poly data object containing all points that have any values in the aggregated
+	 * time steps, in the order they have first been added, along with their statistics.
+	 * @return A poly data object of the aggregated data
+	 */
+	vtkSmartPointer<vtkPolyData> getPolyData() const;
+
+	/**
+	 * Clear all aggregated values.
+	 */
+	void clearAggregationData();
+
+private:
+	/**
+	 * The values a time step contributed to the aggregation, kept to remove them again.
+	 */
+	struct TimeStepValues {
+		std::vector<int> slots;
+		std::vector<float> values;
+		std::vector<float> eastwards;
+		std::vector<float> northwards;
+	};
+
+	/**
+	 * Add or remove a single value of a point, ignoring NaN values.
+	 * @param slot The index of the point
+	 * @param value The value
+	 * @param sign 1 to add the value, -1 to remove it
+	 */
+	void updateSlot(int slot, float value, int sign);
+
+	/**
+	 * Calculate the configured statistic of a point.
+	 * @param slot The index of the point
+	 * @return The statistic of the point's values
+	 */
+	double getStatistic(int slot) const;
+
+	/**
+	 * Get the name of the array holding the configured statistic.
+	 * @return The array name, depending on the data type and statistic
+	 */
+	QString getArrayName() const;
+
+	/**
+	 * Stores the data type of the input data.
+	 */
+	Data::Type dataType;
+
+	/**
+	 * Stores the time resolution of the input data.
+	 */
+	int timeResolution;
+
+	/**
+	 * The statistic calculated from the values of each point.
+	 */
+	Statistic statistic;
+
+	/**
+	 * The percentile calculated for `PERCENTILE`, within [0, 100].
+	 */
+	double percentile;
+
+	/**
+	 * True if the values of each time step are kept to remove them again.
+	 */
+	bool removable;
+
+	/**
+	 * Maps the coordinates of each point to its index in the following arrays.
+	 */
+	std::unordered_map<PointCoordinates, int, PointCoordinatesHash> slots;
+
+	/**
+	 * The coordinates of each point.
+	 */
+	std::vector<PointCoordinates> coordinates;
+
+	/**
+	 * The amount of values of each point.
+	 */
+	std::vector<int> counts;
+
+	/**
+	 * The first value of each point, which the sums below are relative to so that the variance
+	 * does not suffer from cancellation.
+	 */
+	std::vector<double> shifts;
+
+	/**
+	 * The sum of the shifted values of each point.
+	 */
+	std::vector<double> sums;
+
+	/**
+	 * The sum of the squared shifted values of each point.
+	 */
+	std::vector<double> squareSums;
+
+	/**
+	 * The sums of the wind bearings' eastward and northward components of each point.
+	 */
+	std::vector<double> eastwardSums;
+	std::vector<double> northwardSums;
+
+	/**
+	 * The sorted values of each point, only kept for statistics depending on their order.
+	 */
+	std::vector<std::vector<float>> sortedValues;
+
+	/**
+	 * The time steps added so far, along with their values if they are removable.
+	 */
+	std::map<int, TimeStepValues> timeSteps;
+};
+
+#endif
@@ -10,33 +10,28 @@
 #include <vtkFloatArray.h>
 #include <vtkIntArray.h>
 #include <vtkCellArray.h>
+#include <vtkDataArray.h>
 #include <vtkExecutive.h>
 #include <vtkInformationExecutivePortVectorKey.h>
 
-#include <Filter/TemporalInterpolationFilter/PrecipitationInterpolationValue.hpp>
-#include <Filter/TemporalInterpolationFilter/TemperatureInterpolationValue.hpp>
-#include <Filter/TemporalInterpolationFilter/WindInterpolationValue.hpp>
-#include <Filter/TemporalInterpolationFilter/CloudCoverageInterpolationValue.hpp>
-#include <Filter/TemporalInterpolationFilter/TwitterInterpolationValue.hpp>
 #include <Utils/Misc/MakeUnique.hpp>
 #include <Utils/Math/Functions.hpp>
+#include <Utils/Math/WindVectors.hpp>
+
+#include <algorithm>
 
 vtkStandardNewMacro(TemporalInterpolationFilter);
 
 const QList<Data::Type> TemporalInterpolationFilter::SUPPORTED_DATA_TYPES = QList<Data::Type>() <<
         Data::PRECIPITATION << Data::TEMPERATURE << Data::WIND << Data::CLOUD_COVERAGE << Data::TWEETS;
 
-TemporalInterpolationFilter::TemporalInterpolationFilter() : preprocessed(false),
-	currentTimeStep(0) {
+TemporalInterpolationFilter::TemporalInterpolationFilter() : interpolatedTime(-1),
+	preprocessed(false), currentTimeStep(0) {
 	this->SetNumberOfInputPorts(1);
 	this->SetNumberOfOutputPorts(1);
 }
 
-TemporalInterpolationFilter::~TemporalInterpolationFilter() {
-	for (int i = 0; i < this->pointData.size(); i++) {
-		qDeleteAll(this->pointData[i]);
-	}
-}
+TemporalInterpolationFilter::~TemporalInterpolationFilter() { }
 
 void TemporalInterpolationFilter::fail(QString message) {
 	vtkErrorMacro( << QString("%1 This filter may not work, please proceed with caution.").arg(
@@ -135,10 +130,20 @@ int TemporalInterpolationFilter::RequestData(
 	vtkPolyData* output = vtkPolyData::GetData(outInfo);
 
 	if (this->hasPreprocessed()) {
-		vtkSmartPointer<vtkPolyData> interpolatedOutput = this->getOutputPolyData(outInfo->Get(
-		            vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()));
-		if (interpolatedOutput != nullptr) {
-			output->DeepCopy(interpolatedOutput);
+		// Blend the requested time into the reused arrays and hand them out without copying them.
+		// The output lets go of them first, so that only consumers keeping an earlier output still
+		// hold them.
+		output->GetPointData()->Initialize();
+		if (this->interpolateOutput(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))) {
+			output->SetPoints(this->outputPoints);
+			output->SetVerts(this->outputVertices);
+
+			for (size_t a = 0; a < this->integerOutputArrays.size(); a++) {
+				output->GetPointData()->AddArray(this->integerOutputArrays[a]);
+			}
+			for (size_t a = 0; a < this->floatOutputArrays.size(); a++) {
+				output->GetPointData()->AddArray(this->floatOutputArrays[a]);
+			}
 		}
 		request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 0);
 		return 1;
@@ -147,6 +152,7 @@ int TemporalInterpolationFilter::RequestData(
 	if (this->currentTimeStep == 0) {
 		this->SetProgressText("Interpolating data...");
 		this->SetProgress(0.0);
+		this->createTimeline();
 	}
 
 	this->storeTimestepData(this->currentTimeStep, input);
@@ -165,7 +171,8 @@ int TemporalInterpolationFilter::RequestData(
 		this->currentTimeStep = 0;
 		this->SetProgressText("");
 		this->SetProgress(1.0);
-		this->fillTimesteps();
+		this->timeline->fill();
+		this->createOutputArrays();
 		this->preprocessed = true;
 	}
 
@@ -173,494 +180,232 @@ int TemporalInterpolationFilter::RequestData(
 	return 1;
 }
 
-vtkSmartPointer<vtkPolyData> TemporalInterpolationFilter::getOutputPolyData(double time) {
-	vtkSmartPointer<vtkPolyData> dataSet = vtkSmartPointer<vtkPolyData>::New();
+void TemporalInterpolationFilter::createOutputArrays() {
+	int amountOfPoints = this->timeline->getAmountOfPoints();
+	const std::vector<PointCoordinates>& coordinates = this->timeline->getCoordinates();
 
-	// Interpolate between the two adjacent time steps
-	QMap<PointCoordinates, InterpolationValue*> interpolatedData;
-	float factorA = time - (int) time;
-	float factorB = 1 - factorA;
+	// The points do not move over time, so they are only created once
+	this->outputPoints = vtkSmartPointer<vtkPoints>::New();
+	this->outputPoints->SetNumberOfPoints(amountOfPoints);
 
-	if (time < 0 || time > this->pointData.size() - 1) {
-		return nullptr;
-	}
+	this->outputVertices = vtkSmartPointer<vtkCellArray>::New();
+	this->outputVertices->Allocate(this->outputVertices->EstimateSize(1, amountOfPoints));
+	this->outputVertices->InsertNextCell(amountOfPoints);
 
-	if (time == this->pointData.size() - 1) {
-		interpolatedData = this->pointData[(int) time];
-	} else {
-		for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = this->pointData[(int)
-		        time].begin();
-		        iterator != this->pointData[(int) time].end(); ++iterator) {
-			interpolatedData.insert(iterator.key(),
-			                        this->interpolateDataPoint(this->pointData[((int) time)][iterator.key()],
-			                                this->pointData[((int) time) + 1][iterator.key()], factorA, factorB));
-		}
+	for (int i = 0; i < amountOfPoints; i++) {
+		this->outputPoints->SetPoint(i, coordinates[i].getX(), coordinates[i].getY(),
+		                             coordinates[i].getZ());
+		this->outputVertices->InsertCellPoint(i);
 	}
 
-	// Create the content of the output poly data object
-	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-	vtkCellArray* verts = vtkCellArray::New();
-	verts->Allocate(verts->EstimateSize(1, interpolatedData.size()));
-	verts->InsertNextCell(interpolatedData.size());
-
-	vtkIdType numberOfTuples[1];
-	numberOfTuples[0] = interpolatedData.size();
-
-	// Add the common priority and timestamp arrays
-	vtkSmartPointer<vtkIntArray> priorities = vtkSmartPointer<vtkIntArray>::New();
-	priorities->SetName("priorities");
-	priorities->SetNumberOfComponents(1);
-	priorities->SetNumberOfTuples(*numberOfTuples);
-
-	vtkSmartPointer<vtkIntArray> timestamps = vtkSmartPointer<vtkIntArray>::New();
-	timestamps->SetName("timestamps");
-	timestamps->SetNumberOfComponents(1);
-	timestamps->SetNumberOfTuples(*numberOfTuples);
-
-	// The current tuple index in the iteration
-	int tupleNumber = 0;
-
-	// Iterate through all data points, add their coordinates as new points and fill the
-	// array of priority and timestamp values.
-	for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = interpolatedData.begin();
-	        iterator != interpolatedData.end(); ++iterator) {
-		verts->InsertCellPoint(points->InsertNextPoint(
-		                           iterator.key().getX(),
-		                           iterator.key().getY(),
-		                           iterator.key().getZ()
-		                       ));
-
-		double priority[1] = {(double) iterator.value()->getPriority()};
-		priorities->SetTuple(tupleNumber, priority);
-
-		double timestamp[1] = {(double) iterator.value()->getTimestamp()};
-		timestamps->SetTuple(tupleNumber, timestamp);
-
-		tupleNumber++;
+	this->integerOutputArrays.clear();
+	for (int a = 0; a < this->integerAttributeNames.size(); a++) {
+		vtkSmartPointer<vtkIntArray> array = vtkSmartPointer<vtkIntArray>::New();
+		array->SetName(this->integerAttributeNames[a].toStdString().c_str());
+		array->SetNumberOfComponents(1);
+		array->SetNumberOfTuples(amountOfPoints);
+		this->integerOutputArrays.push_back(array);
 	}
 
-	if (this->dataType != Data::TWEETS) {
-		dataSet->GetPointData()->AddArray(timestamps);
-		dataSet->GetPointData()->AddArray(priorities);
+	this->floatOutputArrays.clear();
+	for (int a = 0; a < this->floatAttributeNames.size(); a++) {
+		vtkSmartPointer<vtkFloatArray> array = vtkSmartPointer<vtkFloatArray>::New();
+		array->SetName(this->floatAttributeNames[a].toStdString().c_str());
+		array->SetNumberOfComponents(1);
+		array->SetNumberOfTuples(amountOfPoints);
+		this->floatOutputArrays.push_back(array);
 	}
 
-	switch (this->dataType) {
-	case Data::TEMPERATURE: {
-		vtkSmartPointer<vtkFloatArray> temperatures
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		temperatures->SetNumberOfComponents(1);
-		temperatures->SetNumberOfTuples(interpolatedData.size());
-		temperatures->SetName("temperatures");
-
-		int tupleNumber = 0;
-		for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = interpolatedData.begin();
-		        iterator != interpolatedData.end(); ++iterator) {
-			const TemperatureInterpolationValue* dataPoint
-			    = static_cast<const TemperatureInterpolationValue*>(iterator.value());
-
-			double temperature[1] = {
-				(double) dataPoint->getTemperature()
-			};
-			temperatures->SetTuple(tupleNumber, temperature);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(temperatures);
-
-		break;
-	}
-	case Data::TWEETS: {
-		vtkSmartPointer<vtkFloatArray> densities
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		densities->SetNumberOfComponents(1);
-		densities->SetNumberOfTuples(interpolatedData.size());
-		densities->SetName("density");
-
-		int tupleNumber = 0;
-		for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = interpolatedData.begin();
-		        iterator != interpolatedData.end(); ++iterator) {
-			const TwitterInterpolationValue* dataPoint
-			    = static_cast<const TwitterInterpolationValue*>(iterator.value());
-
-			double density[1] = {
-				(double) dataPoint->getDensity()
-			};
-			densities->SetTuple(tupleNumber, density);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(densities);
+	this->interpolatedTime = -1;
+}
 
-		break;
-	}
-	case Data::PRECIPITATION: {
-		vtkSmartPointer<vtkFloatArray> precipitationRates
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		precipitationRates->SetNumberOfComponents(1);
-		precipitationRates->SetNumberOfTuples(interpolatedData.size());
-		precipitationRates->SetName("precipitationRates");
-
-		vtkSmartPointer<vtkIntArray> precipitationTypes
-		    = vtkSmartPointer<vtkIntArray>::New();
-		precipitationTypes->SetNumberOfComponents(1);
-		precipitationTypes->SetNumberOfTuples(interpolatedData.size());
-		precipitationTypes->SetName("precipitationTypes");
-
-		int tupleNumber = 0;
-		for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = interpolatedData.begin();
-		        iterator != interpolatedData.end(); ++iterator) {
-			const PrecipitationInterpolationValue* dataPoint
-			    = static_cast<const PrecipitationInterpolationValue*>(iterator.value());
-
-			double precipitationRate[1] = {
-				(double) dataPoint->getPrecipitationRate()
-			};
-			precipitationRates->SetTuple(tupleNumber, precipitationRate);
-
-			double precipitationType[1] = {
-				(double) dataPoint->getPrecipitationType()
-			};
-			precipitationTypes->SetTuple(tupleNumber, precipitationType);
-
-			tupleNumber++;
-		}
+/**
+ * Replace an output array by a new one of the same size if anyone besides the filter still holds
+ * it, so that the outputs kept by consumers are not overwritten.
+ * @param array The output array, replaced in place
+ */
+template<typename ArrayType>
+static void detachArray(vtkSmartPointer<ArrayType>& array) {
+	if (array->GetReferenceCount() <= 1) {
+		return;
+	}
+
+	vtkSmartPointer<ArrayType> detachedArray = vtkSmartPointer<ArrayType>::New();
+	detachedArray->SetName(array->GetName());
+	detachedArray->SetNumberOfComponents(array->GetNumberOfComponents());
+	detachedArray->SetNumberOfTuples(array->GetNumberOfTuples());
+	array = detachedArray;
+}
 
-		dataSet->GetPointData()->AddArray(precipitationRates);
-		dataSet->GetPointData()->AddArray(precipitationTypes);
+bool TemporalInterpolationFilter::interpolateOutput(double time) {
+	int amountOfTimeSteps = this->timeline->getAmountOfTimeSteps();
 
-		break;
+	if (time < 0 || time > amountOfTimeSteps - 1) {
+		return false;
 	}
-	case Data::WIND: {
-		vtkSmartPointer<vtkFloatArray> windDirections
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		windDirections->SetNumberOfComponents(1);
-		windDirections->SetNumberOfTuples(interpolatedData.size());
-		windDirections->SetName("directions");
-
-		vtkSmartPointer<vtkFloatArray> windSpeeds
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		windSpeeds->SetNumberOfComponents(1);
-		windSpeeds->SetNumberOfTuples(interpolatedData.size());
-		windSpeeds->SetName("speeds");
-
-		int tupleNumber = 0;
-		for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = interpolatedData.begin();
-		        iterator != interpolatedData.end(); ++iterator) {
-			const WindInterpolationValue* dataPoint
-			    = static_cast<const WindInterpolationValue*>(iterator.value());
-
-			double windDirection[1] = {
-				(double) dataPoint->getBearing()
-			};
-			windDirections->SetTuple(tupleNumber, windDirection);
-
-			double windSpeed[1] = {
-				(double) dataPoint->getSpeed()
-			};
-			windSpeeds->SetTuple(tupleNumber, windSpeed);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(windSpeeds);
-		dataSet->GetPointData()->AddArray(windDirections);
 
-		break;
+	// The arrays still hold the values of the time requested last
+	if (time == this->interpolatedTime) {
+		return true;
 	}
-	case Data::CLOUD_COVERAGE: {
-		vtkSmartPointer<vtkFloatArray> cloudCoverageArray
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		cloudCoverageArray->SetNumberOfComponents(1);
-		cloudCoverageArray->SetNumberOfTuples(interpolatedData.size());
-		cloudCoverageArray->SetName("cloudCovers");
-
-		int tupleNumber = 0;
-		for (QMap<PointCoordinates, InterpolationValue*>::iterator iterator = interpolatedData.begin();
-		        iterator != interpolatedData.end(); ++iterator) {
-			const CloudCoverageInterpolationValue* dataPoint
-			    = static_cast<const CloudCoverageInterpolationValue*>(iterator.value());
-
-			double cloudCoverage[1] = {
-				(double) dataPoint->getCloudCoverage()
-			};
-			cloudCoverageArray->SetTuple(tupleNumber, cloudCoverage);
-
-			tupleNumber++;
-		}
 
-		dataSet->GetPointData()->AddArray(cloudCoverageArray);
-
-		break;
+	// Blend into new arrays wherever a consumer still holds an earlier output
+	for (size_t a = 0; a < this->integerOutputArrays.size(); a++) {
+		detachArray(this->integerOutputArrays[a]);
 	}
-	default: {
-		break;
-	}
-	}
-
-	// Assign points and vertices to the output data set
-	dataSet->SetPoints(points);
-	dataSet->SetVerts(verts);
-
-	if (time != this->pointData.size() - 1) {
-		qDeleteAll(interpolatedData);
+	for (size_t a = 0; a < this->floatOutputArrays.size(); a++) {
+		detachArray(this->floatOutputArrays[a]);
 	}
 
-	return dataSet;
-}
+	// Interpolate between the two adjacent time steps
+	int leftTimeStep = (int) time;
+	int rightTimeStep = std::min(leftTimeStep + 1, amountOfTimeSteps - 1);
+	float factorA = time - leftTimeStep;
+	float factorB = 1 - factorA;
+	int amountOfPoints = this->timeline->getAmountOfPoints();
 
-void TemporalInterpolationFilter::storeTimestepData(int timestep, vtkPointSet* inputData) {
-	QMap<PointCoordinates, InterpolationValue*> timestepData;
+	for (size_t a = 0; a < this->integerOutputArrays.size(); a++) {
+		const int* left = this->timeline->getIntegerValues(a, leftTimeStep);
+		const int* right = this->timeline->getIntegerValues(a, rightTimeStep);
+		int* output = this->integerOutputArrays[a]->GetPointer(0);
 
-	for (int i = 0; i < inputData->GetNumberOfPoints(); i++) {
-		double coordinates[3];
-		inputData->GetPoint(i, coordinates);
+		if (factorA > 0 && this->timeline->getIntegerInterpolation(a) == Timeline::LINEAR) {
+			for (int i = 0; i < amountOfPoints; i++) {
+				output[i] = int(factorB * left[i] + factorA * right[i]);
+			}
+		} else {
+			const int* nearest = factorA >= 0.5 ? right : left;
+			std::copy(nearest, nearest + amountOfPoints, output);
+		}
 
-		PointCoordinates currentCoordinates(coordinates[0], coordinates[1], coordinates[2]);
-		timestepData.insert(currentCoordinates, this->createDataPoint(i, inputData));
+		this->integerOutputArrays[a]->Modified();
 	}
 
-	this->pointData.insert(timestep, timestepData);
-}
+	for (size_t a = 0; a < this->floatOutputArrays.size(); a++) {
+		const float* left = this->timeline->getFloatValues(a, leftTimeStep);
+		const float* right = this->timeline->getFloatValues(a, rightTimeStep);
+		float* output = this->floatOutputArrays[a]->GetPointer(0);
 
-InterpolationValue* TemporalInterpolationFilter::createDataPoint(int pointIndex,
-        vtkPointSet* inputData) {
-	int priority = 0;
-	int timestamp = 0;
+		Timeline::Interpolation interpolation = this->timeline->getFloatInterpolation(a);
 
-	if (this->dataType != Data::TWEETS) {
-		// Twitter data can only be density-mapped and is therefore a special case
-
-		vtkSmartPointer<vtkIntArray> priorityArray = vtkIntArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("priorities"));
-		vtkSmartPointer<vtkIntArray> timestampArray = vtkIntArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("timestamps"));
-
-		if (!priorityArray || !timestampArray) {
-			switch (this->dataType) {
-			case Data::TEMPERATURE:
-				return new TemperatureInterpolationValue(0, 0, 0);
-				break;
-			case Data::TWEETS:
-				return new TwitterInterpolationValue(0);
-				break;
-			case Data::PRECIPITATION:
-				return new PrecipitationInterpolationValue(0, 0, 0, PrecipitationDataPoint::NONE);
-				break;
-			case Data::WIND:
-				return new WindInterpolationValue(0, 0, 0, 0);
-				break;
-			case Data::CLOUD_COVERAGE:
-				return new CloudCoverageInterpolationValue(0, 0, 0);
-				break;
-			default:
-				return new InterpolationValue(0, 0);
-				break;
+		if (factorA > 0 && interpolation == Timeline::BEARING) {
+			WindVectors::blendBearings(left, right, factorA, output, amountOfPoints);
+		} else if (factorA > 0 && interpolation == Timeline::LINEAR) {
+			for (int i = 0; i < amountOfPoints; i++) {
+				output[i] = factorB * left[i] + factorA * right[i];
 			}
+		} else {
+			const float* nearest = factorA >= 0.5 ? right : left;
+			std::copy(nearest, nearest + amountOfPoints, output);
 		}
 
-		priority = priorityArray->GetValue(pointIndex);
-		timestamp = timestampArray->GetValue(pointIndex);
+		this->floatOutputArrays[a]->Modified();
 	}
 
-	switch (this->dataType) {
-	case Data::TEMPERATURE: {
-		vtkSmartPointer<vtkFloatArray> temperatureArray = vtkFloatArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("temperatures"));
-
-		if (!temperatureArray) {
-			return new TemperatureInterpolationValue(0, 0, 0);
-		}
-
-		return new TemperatureInterpolationValue(priority, timestamp,
-		        temperatureArray->GetValue(pointIndex));
-		break;
-	}
-	case Data::TWEETS: {
-		vtkSmartPointer<vtkIntArray> densityArray = vtkIntArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("density"));
+	this->interpolatedTime = time;
 
-		if (!densityArray) {
-			return new TwitterInterpolationValue(0);
-		}
+	return true;
+}
 
-		return new TwitterInterpolationValue(densityArray->GetValue(pointIndex));
-		break;
+/**
+ * Copy the values of a VTK array into a column of a timeline.
+ */
+template<typename InputType, typename OutputType>
+static void copyColumn(const InputType* input, int numberOfComponents, std::vector<OutputType>& output) {
+	for (size_t i = 0; i < output.size(); i++) {
+		output[i] = static_cast<OutputType>(input[i * numberOfComponents]);
 	}
-	case Data::PRECIPITATION: {
-		vtkSmartPointer<vtkFloatArray> precipitationRateArray = vtkFloatArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("precipitationRates"));
-		vtkSmartPointer<vtkIntArray> precipitationTypeArray = vtkIntArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("precipitationTypes"));
-
-		if (!precipitationRateArray || !precipitationTypeArray) {
-			return new PrecipitationInterpolationValue(0, 0, 0, PrecipitationDataPoint::NONE);
-		}
+}
 
-		return new PrecipitationInterpolationValue(priority, timestamp,
-		        precipitationRateArray->GetValue(pointIndex),
-		        static_cast<PrecipitationDataPoint::PrecipitationType>(precipitationTypeArray->GetValue(
-		                    pointIndex)));
-		break;
-	}
-	case Data::WIND: {
-		vtkSmartPointer<vtkFloatArray> bearingArray = vtkFloatArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("directions"));
-		vtkSmartPointer<vtkFloatArray> velocityArray = vtkFloatArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("speeds"));
-
-		if (!bearingArray || !velocityArray) {
-			return new WindInterpolationValue(0, 0, 0, 0);
-		}
+/**
+ * Read a column of a timeline from a point data array, using zeroes if the array does not exist.
+ * @param inputData The data set holding the array
+ * @param name The name of the array
+ * @param column The column to fill, already holding one element for each point
+ */
+template<typename OutputType>
+static void readColumn(vtkPointSet* inputData, QString name, std::vector<OutputType>& column) {
+	vtkDataArray* array = inputData->GetPointData()->GetArray(name.toStdString().c_str());
 
-		return new WindInterpolationValue(priority, timestamp, bearingArray->GetValue(pointIndex),
-		                                  velocityArray->GetValue(pointIndex));
-		break;
+	if (!array || array->GetNumberOfTuples() < (vtkIdType) column.size()) {
+		std::fill(column.begin(), column.end(), OutputType());
+		return;
 	}
-	case Data::CLOUD_COVERAGE: {
-		vtkSmartPointer<vtkFloatArray> cloudCoverageArray = vtkFloatArray::SafeDownCast(
-		            inputData->GetPointData()->GetArray("cloudCovers"));
-
-		if (!cloudCoverageArray) {
-			return new CloudCoverageInterpolationValue(0, 0, 0);
-		}
 
-		return new CloudCoverageInterpolationValue(priority, timestamp,
-		        cloudCoverageArray->GetValue(pointIndex));
-		break;
-	}
-	default: {
-		return new InterpolationValue();
-		break;
-	}
+	switch (array->GetDataType()) {
+		vtkTemplateMacro(copyColumn(static_cast<const VTK_TT*>(array->GetVoidPointer(0)),
+		                            array->GetNumberOfComponents(), column));
 	}
 }
 
-void TemporalInterpolationFilter::fillTimesteps() {
-	// First of all, fill in the first and the last time step with points, whose information only are available in the middle of the time span. This groundwork is necessary to enable easier linear interpolation of intermediate points using the algorithm below.
-	QMap<PointCoordinates, InterpolationValue*> firstTimeStep;
-	QMap<PointCoordinates, InterpolationValue*> lastTimeStep;
-
-	for (int t = 0; t < this->pointData.size(); t++) {
-		// Iterate through all points in all time steps
-		QMap<PointCoordinates, InterpolationValue*>::const_iterator i = this->pointData[t].constBegin();
-		while (i != this->pointData[t].constEnd()) {
-			// Add newly found points to the first time step only if they are not there yet, therefore keeping the chronologically first information
-			if (!firstTimeStep.contains(i.key())) {
-				firstTimeStep.insert(i.key(), i.value());
-			}
-
-			// Always add newly found points to the last time step, therefore keeping the chronologically last information
-			lastTimeStep[i.key()] = i.value();
+void TemporalInterpolationFilter::storeTimestepData(int timestep, vtkPointSet* inputData) {
+	int amountOfPoints = inputData->GetNumberOfPoints();
 
-			++i;
-		}
+	std::vector<PointCoordinates> coordinates(amountOfPoints);
+	for (int i = 0; i < amountOfPoints; i++) {
+		double point[3];
+		inputData->GetPoint(i, point);
+		coordinates[i] = PointCoordinates(point[0], point[1], point[2]);
 	}
 
-	this->pointData[0] = firstTimeStep;
-	this->pointData[this->pointData.size() - 1] = lastTimeStep;
-
-	// After this has been done, the real interpolation can start. It will fill all remaining gaps in the time steps with linearly interpolated data.
-	QList<PointCoordinates> allPoints = this->pointData[0].keys();
-
-	for (int i = 0; i < allPoints.size(); i++) {
-		int leftIndex = 0;
-		int rightIndex = 0;
-		while (leftIndex < this->pointData.size() - 1) {
-			rightIndex++;
-
-			if (this->pointData[rightIndex].contains(allPoints[i])) {
-				for (int j = leftIndex; j <= rightIndex; j++) {
-					float factorA = float(j - leftIndex) / float(rightIndex - leftIndex);
-					float factorB = 1 - factorA;
-					this->pointData[j].insert(allPoints[i],
-					                          this->interpolateDataPoint(this->pointData[leftIndex][allPoints[i]],
-					                                  this->pointData[rightIndex][allPoints[i]], factorA, factorB));
-				}
-
-				leftIndex = rightIndex;
-			}
-		}
+	std::vector<std::vector<float>> floatColumns(this->floatAttributeNames.size(),
+	                              std::vector<float>(amountOfPoints));
+	for (int a = 0; a < this->floatAttributeNames.size(); a++) {
+		readColumn(inputData, this->floatAttributeNames[a], floatColumns[a]);
 	}
-}
 
-InterpolationValue* TemporalInterpolationFilter::interpolateDataPoint(InterpolationValue* left,
-        InterpolationValue* right, float factorA, float factorB) {
-	int priority;
-	if (factorA >= 0.5) {
-		priority = right->getPriority();
-	} else {
-		priority = left->getPriority();
+	std::vector<std::vector<int>> integerColumns(this->integerAttributeNames.size(),
+	                            std::vector<int>(amountOfPoints));
+	for (int a = 0; a < this->integerAttributeNames.size(); a++) {
+		readColumn(inputData, this->integerAttributeNames[a], integerColumns[a]);
 	}
 
-	int interpolatedTimestamp = int(factorB * left->getTimestamp() + factorA * right->getTimestamp());
-
-	switch (this->dataType) {
-	case Data::TEMPERATURE: {
-		TemperatureInterpolationValue* leftValue = static_cast<TemperatureInterpolationValue*>(left);
-		TemperatureInterpolationValue* rightValue = static_cast<TemperatureInterpolationValue*>(right);
+	this->timeline->addTimeStep(coordinates, std::move(floatColumns), std::move(integerColumns));
+}
 
-		float interpolatedTemperature = factorB * leftValue->getTemperature() + factorA *
-		                                rightValue->getTemperature();
+void TemporalInterpolationFilter::createTimeline() {
+	this->floatAttributeNames.clear();
+	this->integerAttributeNames.clear();
+	std::vector<Timeline::Interpolation> floatInterpolations;
+	std::vector<Timeline::Interpolation> integerInterpolations;
 
-		return new TemperatureInterpolationValue(priority, interpolatedTimestamp, interpolatedTemperature);
-		break;
+	// Twitter data can only be density-mapped and is therefore a special case
+	if (this->dataType != Data::TWEETS) {
+		this->integerAttributeNames << "timestamps" << "priorities";
+		integerInterpolations.push_back(Timeline::LINEAR);
+		integerInterpolations.push_back(Timeline::NEAREST);
 	}
-	case Data::TWEETS: {
-		TwitterInterpolationValue* leftValue = static_cast<TwitterInterpolationValue*>(left);
-		TwitterInterpolationValue* rightValue = static_cast<TwitterInterpolationValue*>(right);
-
-		float interpolatedDensity = factorB * leftValue->getDensity() + factorA * rightValue->getDensity();
 
-		return new TwitterInterpolationValue(interpolatedDensity);
+	switch (this->dataType) {
+	case Data::TEMPERATURE:
+		this->floatAttributeNames << "temperatures";
+		floatInterpolations.push_back(Timeline::LINEAR);
 		break;
-	}
-	case Data::PRECIPITATION: {
-		PrecipitationInterpolationValue* leftValue = static_cast<PrecipitationInterpolationValue*>(left);
-		PrecipitationInterpolationValue* rightValue = static_cast<PrecipitationInterpolationValue*>(right);
-
-		PrecipitationDataPoint::PrecipitationType precipitationType;
-		if (factorA >= 0.5) {
-			precipitationType = rightValue->getPrecipitationType();
-		} else {
-			precipitationType = leftValue->getPrecipitationType();
-		}
-
-		float interpolatedPrecipitationRate = factorB * leftValue->getPrecipitationRate() + factorA *
-		                                      rightValue->getPrecipitationRate();
-
-		return new PrecipitationInterpolationValue(priority, interpolatedTimestamp,
-		        interpolatedPrecipitationRate, precipitationType);
+	case Data::TWEETS:
+		this->floatAttributeNames << "density";
+		floatInterpolations.push_back(Timeline::LINEAR);
 		break;
-	}
-	case Data::WIND: {
-		WindInterpolationValue* leftValue = static_cast<WindInterpolationValue*>(left);
-		WindInterpolationValue* rightValue = static_cast<WindInterpolationValue*>(right);
-
-		float interpolatedBearing = factorB * leftValue->getBearing() + factorA * rightValue->getBearing();
-		float interpolatedSpeed = factorB * leftValue->getSpeed() + factorA * rightValue->getSpeed();
-
-		return new WindInterpolationValue(priority, interpolatedTimestamp, interpolatedBearing,
-		                                  interpolatedSpeed);
+	case Data::PRECIPITATION:
+		this->floatAttributeNames << "precipitationRates";
+		floatInterpolations.push_back(Timeline::LINEAR);
+		this->integerAttributeNames << "precipitationTypes";
+		integerInterpolations.push_back(Timeline::NEAREST);
 		break;
-	}
-	case Data::CLOUD_COVERAGE: {
-		CloudCoverageInterpolationValue* leftValue = static_cast<CloudCoverageInterpolationValue*>(left);
-		CloudCoverageInterpolationValue* rightValue = static_cast<CloudCoverageInterpolationValue*>(right);
-		float interpolatedCloudCoverage = factorB * leftValue->getCloudCoverage() + factorA *
-		                                  rightValue->getCloudCoverage();
-
-		return new CloudCoverageInterpolationValue(priority, interpolatedTimestamp,
-		        interpolatedCloudCoverage);
+	case Data::WIND:
+		// Bearings wrap around and are blended as vectors, so that 350° and 10° meet at 0°
+		this->floatAttributeNames << "speeds" << "directions";
+		floatInterpolations.push_back(Timeline::LINEAR);
+		floatInterpolations.push_back(Timeline::BEARING);
 		break;
-	}
-	default: {
-		this->fail("The data type of this filter seems to be invalid.");
-		return nullptr;
+	case Data::CLOUD_COVERAGE:
+		this->floatAttributeNames << "cloudCovers";
+		floatInterpolations.push_back(Timeline::LINEAR);
+		break;
+	default:
 		break;
 	}
-	}
+
+	this->timeline = makeUnique<Timeline>(floatInterpolations, integerInterpolations);
 }
 
 bool TemporalInterpolationFilter::hasPreprocessed() {
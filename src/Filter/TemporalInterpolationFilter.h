@@ -3,17 +3,24 @@
 
 #include <Reader/DataReader/Data.hpp>
 #include <Utils/Misc/PointCoordinates.hpp>
-#include <Filter/TemporalInterpolationFilter/InterpolationValue.hpp>
+#include <Filter/TemporalInterpolationFilter/Timeline.hpp>
 
 #include <vtkFiltersGeneralModule.h>
 #include <vtkPassInputTypeAlgorithm.h>
 #include <vtkDataSet.h>
 #include <vtkSmartPointer.h>
 #include <vtkPointSet.h>
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIntArray.h>
+#include <vtkPoints.h>
 
 #include <qstring.h>
+#include <qstringlist.h>
 #include <qlist.h>
-#include <qmap.h>
+
+#include <memory>
+#include <vector>
 
 class TemporalInterpolationFilter : public vtkPassInputTypeAlgorithm {
 public:
@@ -47,6 +54,11 @@ private:
 	 */
 	void fail(QString message);
 
+	/**
+	 * Create an empty timeline holding the attributes of this filter's data type.
+	 */
+	void createTimeline();
+
 	/**
 	 * Store the points in a poly data object in an internal representation for later interpolation.
 	 * @param timestep The timestep the data should be stored under
@@ -55,40 +67,45 @@ private:
 	void storeTimestepData(int timestep, vtkPointSet* inputData);
 
 	/**
-	 * Create a temporal data point from the data available in a `vtkPolyData` object.
-	 * @param pointIndex The index of the data point in the input data
-	 * @param inputData The poly data object containing the point data
-	 * @return A temporal data point of the right type with all available data
+	 * Create the points and arrays of the output, which are reused for every requested time
+	 * as long as no consumer holds on to them.
 	 */
-	InterpolationValue* createDataPoint(int pointIndex, vtkPointSet* inputData);
+	void createOutputArrays();
 
 	/**
-	 * Fill in all missing points of integral time steps in this filter's point data map using linear interpolation. All scalar values are assumed to be constant up until new data is available.
+	 * Blend the two time steps adjacent to a time into the output arrays. Arrays still held by
+	 * consumers of an earlier output are replaced by new ones first.
+	 * @param time The requested time value
+	 * @return True if the output arrays hold the values for the time, false if the time lies
+	 * outside of the input's time steps
 	 */
-	void fillTimesteps();
+	bool interpolateOutput(double time);
 
 	/**
-	 * Create a new data point value by interpolating between two existing ones.
-	 * @param left Pointer to the known value to the left
-	 * @param right Pointer to the known value to the right
-	 * @param factorA Weight of the left interpolation value
-	 * @param factorB Weight of the right interpolation value
-	 * @return The interpolated value
+	 * The attributes of all points in all time steps, filled in once all of them have been stored.
 	 */
-	InterpolationValue* interpolateDataPoint(InterpolationValue* left, InterpolationValue* right,
-	        float factorA, float factorB);
+	std::unique_ptr<Timeline> timeline;
 
 	/**
-	 * Get a fully interpolated output data set for a given time.
-	 * @param time The requested time value
-	 * @return A smart pointer to the linearly interpolated poly data object for the given time
+	 * The names of the point data arrays stored as float and as integral attributes in the
+	 * timeline, in the order of the timeline's attributes.
+	 */
+	QStringList floatAttributeNames;
+	QStringList integerAttributeNames;
+
+	/**
+	 * The points, vertices and arrays handed out as this filter's output, in the order of the
+	 * timeline's attributes.
 	 */
-	vtkSmartPointer<vtkPolyData> getOutputPolyData(double time);
+	vtkSmartPointer<vtkPoints> outputPoints;
+	vtkSmartPointer<vtkCellArray> outputVertices;
+	std::vector<vtkSmartPointer<vtkFloatArray>> floatOutputArrays;
+	std::vector<vtkSmartPointer<vtkIntArray>> integerOutputArrays;
 
 	/**
-	 * This map stores nested maps for each timestep which in turn map point coordinates to their respective scalar values.
+	 * The time whose values the output arrays currently hold, or -1 if there is none.
 	 */
-	QMap<int, QMap<PointCoordinates, InterpolationValue*>> pointData;
+	double interpolatedTime;
 
 	/**
 	 * Check whether this filter has successfully finished preprocessing data.
@@ -0,0 +1,266 @@
+#include <Filter/TemporalInterpolationFilter/Timeline.hpp>
+
+#include <Utils/Math/WindVectors.hpp>
+
+#include <algorithm>
+
+Timeline::Timeline(const std::vector<Interpolation>& floatInterpolations,
+                   const std::vector<Interpolation>& integerInterpolations)
+	: floatInterpolations(floatInterpolations), integerInterpolations(integerInterpolations),
+	  amountOfTimeSteps(0) { }
+
+int Timeline::getPointIndex(const PointCoordinates& coordinates, size_t position) {
+	// Most data sets list their points in the same order in every time step
+	if (!this->timeSteps.empty()) {
+		const std::vector<int>& previousPoints = this->timeSteps.back().points;
+		if (position < previousPoints.size()
+		        && this->coordinates[previousPoints[position]] == coordinates) {
+			return previousPoints[position];
+		}
+	}
+
+	std::unordered_map<PointCoordinates, int, PointCoordinatesHash>::iterator entry =
+	    this->pointIndices.find(coordinates);
+	if (entry != this->pointIndices.end()) {
+		return entry->second;
+	}
+
+	int index = this->coordinates.size();
+	this->coordinates.push_back(coordinates);
+	this->pointIndices[coordinates] = index;
+	this->latestTimeSteps.push_back(-1);
+	this->latestPositions.push_back(-1);
+	return index;
+}
+
+void Timeline::addTimeStep(const std::vector<PointCoordinates>& coordinates,
+                           std::vector<std::vector<float>> floatColumns,
+                           std::vector<std::vector<int>> integerColumns) {
+	int timeStepIndex = this->amountOfTimeSteps;
+
+	TimeStep timeStep;
+	timeStep.points.reserve(coordinates.size());
+
+	for (size_t i = 0; i < coordinates.size(); i++) {
+		int point = this->getPointIndex(coordinates[i], timeStep.points.size());
+
+		// Points occurring twice overwrite their earlier values, all others are appended
+		size_t position = timeStep.points.size();
+		if (this->latestTimeSteps[point] == timeStepIndex) {
+			position = this->latestPositions[point];
+		} else {
+			timeStep.points.push_back(point);
+			this->latestTimeSteps[point] = timeStepIndex;
+			this->latestPositions[point] = position;
+		}
+
+		for (size_t a = 0; a < floatColumns.size(); a++) {
+			floatColumns[a][position] = floatColumns[a][i];
+		}
+		for (size_t a = 0; a < integerColumns.size(); a++) {
+			integerColumns[a][position] = integerColumns[a][i];
+		}
+	}
+
+	for (size_t a = 0; a < floatColumns.size(); a++) {
+		floatColumns[a].resize(timeStep.points.size());
+	}
+	for (size_t a = 0; a < integerColumns.size(); a++) {
+		integerColumns[a].resize(timeStep.points.size());
+	}
+
+	timeStep.floatColumns = std::move(floatColumns);
+	timeStep.integerColumns = std::move(integerColumns);
+
+	this->timeSteps.push_back(std::move(timeStep));
+	this->amountOfTimeSteps++;
+}
+
+void Timeline::fill() {
+	int amountOfPoints = this->coordinates.size();
+	int amountOfTimeSteps = this->amountOfTimeSteps;
+	size_t matrixSize = (size_t) amountOfPoints * amountOfTimeSteps;
+
+	// Sort the points by their coordinates, which gives the order of the matrix columns
+	std::vector<int> order(amountOfPoints);
+	for (int i = 0; i < amountOfPoints; i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [this](int a, int b) {
+		return this->coordinates[a] < this->coordinates[b];
+	});
+
+	std::vector<int> columns(amountOfPoints);
+	std::vector<PointCoordinates> sortedCoordinates(amountOfPoints);
+	for (int i = 0; i < amountOfPoints; i++) {
+		columns[order[i]] = i;
+		sortedCoordinates[i] = this->coordinates[order[i]];
+	}
+
+	this->floatMatrices.assign(this->floatInterpolations.size(), std::vector<float>(matrixSize));
+	this->integerMatrices.assign(this->integerInterpolations.size(), std::vector<int>(matrixSize));
+
+	// Write each time step into the matrices, noting the next occurrence of each of its points
+	std::vector<std::vector<int>> nextTimeStepsOfPoints(amountOfTimeSteps);
+	std::vector<int> nextTimeSteps(amountOfPoints, -1);
+
+	for (int t = amountOfTimeSteps - 1; t >= 0; t--) {
+		TimeStep& timeStep = this->timeSteps[t];
+		size_t rowOffset = (size_t) t * amountOfPoints;
+		nextTimeStepsOfPoints[t].resize(timeStep.points.size());
+
+		for (size_t i = 0; i < timeStep.points.size(); i++) {
+			int column = columns[timeStep.points[i]];
+
+			for (size_t a = 0; a < this->floatMatrices.size(); a++) {
+				this->floatMatrices[a][rowOffset + column] = timeStep.floatColumns[a][i];
+			}
+			for (size_t a = 0; a < this->integerMatrices.size(); a++) {
+				this->integerMatrices[a][rowOffset + column] = timeStep.integerColumns[a][i];
+			}
+
+			nextTimeStepsOfPoints[t][i] = nextTimeSteps[column];
+			nextTimeSteps[column] = t;
+		}
+
+		// Release the values of each time step as soon as they are part of the matrices
+		std::vector<std::vector<float>>().swap(timeStep.floatColumns);
+		std::vector<std::vector<int>>().swap(timeStep.integerColumns);
+	}
+
+	// Fill the gaps row by row, so that the points missing from a time step are written in a
+	// single pass over the row with the factors shared by all attributes
+	std::vector<int> previousTimeSteps(amountOfPoints, -1);
+	Gaps gaps;
+	gaps.columns.reserve(amountOfPoints);
+	gaps.leftIndices.reserve(amountOfPoints);
+	gaps.rightIndices.reserve(amountOfPoints);
+	gaps.factors.reserve(amountOfPoints);
+
+	for (int t = 0; t < amountOfTimeSteps; t++) {
+		TimeStep& timeStep = this->timeSteps[t];
+		for (size_t i = 0; i < timeStep.points.size(); i++) {
+			int column = columns[timeStep.points[i]];
+			previousTimeSteps[column] = t;
+			nextTimeSteps[column] = nextTimeStepsOfPoints[t][i];
+		}
+		std::vector<int>().swap(timeStep.points);
+		std::vector<int>().swap(nextTimeStepsOfPoints[t]);
+
+		gaps.columns.clear();
+		gaps.leftIndices.clear();
+		gaps.rightIndices.clear();
+		gaps.factors.clear();
+
+		for (int column = 0; column < amountOfPoints; column++) {
+			int left = previousTimeSteps[column];
+			if (left == t) {
+				continue;
+			}
+
+			// Keep the first known values up to the first occurrence and the last known values
+			// after the last occurrence
+			int right = nextTimeSteps[column];
+			if (left < 0) {
+				left = right;
+			} else if (right < 0) {
+				right = left;
+			}
+
+			gaps.columns.push_back(column);
+			gaps.leftIndices.push_back((size_t) left * amountOfPoints + column);
+			gaps.rightIndices.push_back((size_t) right * amountOfPoints + column);
+			gaps.factors.push_back(left == right ? 0 : float(t - left) / float(right - left));
+		}
+
+		this->interpolateGaps(gaps, (size_t) t * amountOfPoints);
+	}
+
+	this->coordinates = std::move(sortedCoordinates);
+	this->timeSteps.clear();
+	std::unordered_map<PointCoordinates, int, PointCoordinatesHash>().swap(this->pointIndices);
+	std::vector<int>().swap(this->latestTimeSteps);
+	std::vector<int>().swap(this->latestPositions);
+}
+
+void Timeline::interpolateGaps(const Gaps& gaps, size_t rowOffset) {
+	size_t amountOfGaps = gaps.columns.size();
+	const int* columns = gaps.columns.data();
+	const size_t* leftIndices = gaps.leftIndices.data();
+	const size_t* rightIndices = gaps.rightIndices.data();
+	const float* factors = gaps.factors.data();
+
+	// A factor of 0 marks values copied from a single time step, which are kept exactly
+	for (size_t a = 0; a < this->floatMatrices.size(); a++) {
+		float* matrix = this->floatMatrices[a].data();
+		float* row = matrix + rowOffset;
+
+		if (this->floatInterpolations[a] == BEARING) {
+			for (size_t i = 0; i < amountOfGaps; i++) {
+				float left = matrix[leftIndices[i]];
+				float right = matrix[rightIndices[i]];
+				row[columns[i]] = factors[i] > 0
+				                  ? WindVectors::blendBearing(left, right, factors[i]) : left;
+			}
+		} else if (this->floatInterpolations[a] == NEAREST) {
+			for (size_t i = 0; i < amountOfGaps; i++) {
+				row[columns[i]] = factors[i] >= 0.5 ? matrix[rightIndices[i]]
+				                  : matrix[leftIndices[i]];
+			}
+		} else {
+			for (size_t i = 0; i < amountOfGaps; i++) {
+				float left = matrix[leftIndices[i]];
+				float right = matrix[rightIndices[i]];
+				float blended = (1 - factors[i]) * left + factors[i] * right;
+				row[columns[i]] = factors[i] > 0 ? blended : left;
+			}
+		}
+	}
+
+	for (size_t a = 0; a < this->integerMatrices.size(); a++) {
+		int* matrix = this->integerMatrices[a].data();
+		int* row = matrix + rowOffset;
+
+		if (this->integerInterpolations[a] == LINEAR) {
+			for (size_t i = 0; i < amountOfGaps; i++) {
+				int left = matrix[leftIndices[i]];
+				int right = matrix[rightIndices[i]];
+				int blended = int((1 - factors[i]) * left + factors[i] * right);
+				row[columns[i]] = factors[i] > 0 ? blended : left;
+			}
+		} else {
+			for (size_t i = 0; i < amountOfGaps; i++) {
+				row[columns[i]] = factors[i] >= 0.5 ? matrix[rightIndices[i]]
+				                  : matrix[leftIndices[i]];
+			}
+		}
+	}
+}
+
+int Timeline::getAmountOfTimeSteps() const {
+	return this->amountOfTimeSteps;
+}
+
+int Timeline::getAmountOfPoints() const {
+	return this->coordinates.size();
+}
+
+const std::vector<PointCoordinates>& Timeline::getCoordinates() const {
+	return this->coordinates;
+}
+
+const float* Timeline::getFloatValues(int attribute, int timeStep) const {
+	return this->floatMatrices[attribute].data() + (size_t) timeStep * this->coordinates.size();
+}
+
+const int* Timeline::getIntegerValues(int attribute, int timeStep) const {
+	return this->integerMatrices[attribute].data() + (size_t) timeStep * this->coordinates.size();
+}
+
+Timeline::Interpolation Timeline::getFloatInterpolation(int attribute) const {
+	return this->floatInterpolations[attribute];
+}
+
+Timeline::Interpolation Timeline::getIntegerInterpolation(int attribute) const {
+	return this->integerInterpolations[attribute];
+}
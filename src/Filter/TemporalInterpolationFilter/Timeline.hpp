@@ -0,0 +1,173 @@
+#ifndef KRONOS_TIMELINE_HPP
+#define KRONOS_TIMELINE_HPP
+
+#include <Utils/Misc/PointCoordinates.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Holds the attributes of a set of points over a series of time steps. Points are identified by
+ * their coordinates and given a stable index once, so that each attribute is stored as a dense
+ * matrix with one row per time step and one column per point.
+ *
+ * Time steps are added one after another, each containing any subset of the points. Once all of
+ * them have been added, `fill` completes the matrices: gaps between two time steps containing a
+ * point are interpolated, while before the first and after the last of them the nearest known
+ * values are kept.
+ */
+class Timeline {
+
+public:
+	/**
+	 * The ways attributes can be interpolated.
+	 */
+	enum Interpolation {
+		/**
+		 * Blend the adjacent known values linearly, truncating the result for integral attributes
+		 */
+		LINEAR,
+
+		/**
+		 * Take the nearer of the adjacent known values
+		 */
+		NEAREST,
+
+		/**
+		 * Blend the adjacent known values as bearings in degrees using `WindVectors`, only
+		 * available for float attributes
+		 */
+		BEARING
+	};
+
+	/**
+	 * Create a new, empty timeline.
+	 * @param floatInterpolations The interpolation of each float attribute of each point
+	 * @param integerInterpolations The interpolation of each integral attribute of each point
+	 */
+	Timeline(const std::vector<Interpolation>& floatInterpolations,
+	         const std::vector<Interpolation>& integerInterpolations);
+
+	/**
+	 * Add the next time step. Points occurring more than once keep their last values.
+	 * @param coordinates The coordinates of all points in this time step
+	 * @param floatColumns The values of each float attribute, one for each point
+	 * @param integerColumns The values of each integral attribute, one for each point
+	 */
+	void addTimeStep(const std::vector<PointCoordinates>& coordinates,
+	                 std::vector<std::vector<float>> floatColumns,
+	                 std::vector<std::vector<int>> integerColumns);
+
+	/**
+	 * Fill all gaps in the attribute matrices and sort the points by their coordinates. No more
+	 * time steps can be added afterwards.
+	 */
+	void fill();
+
+	/**
+	 * @return The amount of time steps added
+	 */
+	int getAmountOfTimeSteps() const;
+
+	/**
+	 * @return The amount of distinct points in all time steps
+	 */
+	int getAmountOfPoints() const;
+
+	/**
+	 * Get the coordinates of all points, sorted once `fill` has been called.
+	 * @return The coordinates of each point in the order of the matrix columns
+	 */
+	const std::vector<PointCoordinates>& getCoordinates() const;
+
+	/**
+	 * Get the values of a float attribute in a time step. Only available after `fill`.
+	 * @param attribute The index of the float attribute
+	 * @param timeStep The time step
+	 * @return The value of each point, in the order of `getCoordinates`
+	 */
+	const float* getFloatValues(int attribute, int timeStep) const;
+
+	/**
+	 * Get the values of an integral attribute in a time step. Only available after `fill`.
+	 * @param attribute The index of the integral attribute
+	 * @param timeStep The time step
+	 * @return The value of each point, in the order of `getCoordinates`
+	 */
+	const int* getIntegerValues(int attribute, int timeStep) const;
+
+	/**
+	 * @param attribute The index of a float attribute
+	 * @return The interpolation used for that attribute
+	 */
+	Interpolation getFloatInterpolation(int attribute) const;
+
+	/**
+	 * @param attribute The index of an integral attribute
+	 * @return The interpolation used for that attribute
+	 */
+	Interpolation getIntegerInterpolation(int attribute) const;
+
+private:
+	/**
+	 * The points of a single time step as added, before `fill` is called.
+	 */
+	struct TimeStep {
+		std::vector<int> points;
+		std::vector<std::vector<float>> floatColumns;
+		std::vector<std::vector<int>> integerColumns;
+	};
+
+	/**
+	 * Get the index of a point, adding it if it is new.
+	 * @param coordinates The coordinates of the point
+	 * @param position The position of the point in its time step, used to recognize points
+	 * appearing in the same order as in the previous time step without looking them up
+	 */
+	int getPointIndex(const PointCoordinates& coordinates, size_t position);
+
+	/**
+	 * The points missing from a time step along with the known values to fill them with.
+	 */
+	struct Gaps {
+		std::vector<int> columns;
+		std::vector<size_t> leftIndices;
+		std::vector<size_t> rightIndices;
+		std::vector<float> factors;
+	};
+
+	/**
+	 * Fill the gaps of a time step by blending the known values of each point.
+	 * @param gaps The columns of the missing points, the matrix indices of their known values before
+	 * and after the time step and the weight of the later one, which is 0 to copy the earlier one
+	 * @param rowOffset The matrix index of the first value of the time step
+	 */
+	void interpolateGaps(const Gaps& gaps, size_t rowOffset);
+
+	std::vector<Interpolation> floatInterpolations;
+	std::vector<Interpolation> integerInterpolations;
+
+	std::vector<PointCoordinates> coordinates;
+	std::unordered_map<PointCoordinates, int, PointCoordinatesHash> pointIndices;
+
+	/**
+	 * The latest time step containing each point and the point's position within it
+	 */
+	std::vector<int> latestTimeSteps;
+	std::vector<int> latestPositions;
+
+	/**
+	 * The time steps added so far, released by `fill`
+	 */
+	std::vector<TimeStep> timeSteps;
+	int amountOfTimeSteps;
+
+	/**
+	 * The matrices of all attributes, each holding one row of values for each time step
+	 */
+	std::vector<std::vector<float>> floatMatrices;
+	std::vector<std::vector<int>> integerMatrices;
+
+};
+
+#endif
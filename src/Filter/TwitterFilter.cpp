@@ -3,10 +3,11 @@
 #include <Reader/DataReader/Data.hpp>
 
 #include <vtkObjectFactory.h>
+#include <vtkFieldData.h>
 #include <vtkStringArray.h>
 #include <vtkIntArray.h>
 
-TwitterFilter::TwitterFilter() {
+TwitterFilter::TwitterFilter() : authorIds(nullptr) {
 	this->authorMatchingMode = CONTAINING;
 }
 TwitterFilter::~TwitterFilter() { }
@@ -17,74 +18,83 @@ QList<Data::Type> TwitterFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>() << Data::TWEETS);
 }
 
-bool TwitterFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-                                  vtkPointData* pointData) {
+void TwitterFilter::prepareAuthorVisibilities(vtkPointSet* inputData) {
+	this->authorIds = getValues<vtkIntArray>(inputData, "authorIds");
+	vtkSmartPointer<vtkStringArray> authorDictionary = vtkStringArray::SafeDownCast(
+	            inputData->GetFieldData()->GetAbstractArray("authorDictionary"));
 
-	vtkSmartPointer<vtkStringArray> authorData = vtkStringArray::SafeDownCast(
-	            pointData->GetAbstractArray("authors"));
-	vtkSmartPointer<vtkStringArray> contentData = vtkStringArray::SafeDownCast(
-	            pointData->GetAbstractArray("contents"));
-	vtkSmartPointer<vtkIntArray> numberOfRetweets = vtkIntArray::SafeDownCast(
-	            pointData->GetAbstractArray("numberOfRetweets"));
+	if (!this->authorIds || !authorDictionary) {
+		this->authorIds = nullptr;
+		return;
+	}
 
+	// Match each distinct author name only once instead of once per tweet
+	this->visibleAuthorIds.assign(authorDictionary->GetNumberOfValues(), false);
+	for (vtkIdType i = 0; i < authorDictionary->GetNumberOfValues(); i++) {
+		this->visibleAuthorIds[i] = this->isVisibleAuthor(authorDictionary->GetValue(i));
+	}
+}
 
-	if (!contentData || !authorData || !numberOfRetweets) {
-		return false;
+void TwitterFilter::evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection) {
+	vtkStringArray* contents = vtkStringArray::SafeDownCast(
+	                               inputData->GetPointData()->GetAbstractArray("contents"));
+	const int* numberOfRetweets = getValues<vtkIntArray>(inputData, "numberOfRetweets");
+
+	if (!contents || !numberOfRetweets) {
+		return;
 	}
 
-	// Extract the actual content and author of the tweet we are currently looking at
-	QString author = QString::fromStdString(authorData->GetValue(pointIndex));
-	author.remove(' ');
-	QString content = QString::fromStdString(contentData->GetValue(pointIndex));
-	int retweets = numberOfRetweets->GetValue(pointIndex);
+	this->prepareAuthorVisibilities(inputData);
+	vtkStringArray* authors = vtkStringArray::SafeDownCast(
+	                              inputData->GetPointData()->GetAbstractArray("authors"));
 
-	// First of all, check if the tweet is visible based on its number of retweets
-	if (!shouldDisplayBasedOnRetweets(retweets)) {
-		return false;
+	if (!this->authorIds && !authors) {
+		return;
 	}
 
-	// Check the visibility of this point based on the tweet's author and content
-	if (this->visibleAuthors.count() == 0) {
-		if (this->visibleKeywords.count() == 0) {
-			return true;
-		} else {
-			return this->shouldDisplayBasedOnTweetContent(content);
-		}
-	} else {
-		for (int i = 0; i < this->visibleAuthors.count(); i++) {
-			if (this->authorMatchingMode == CONTAINING) {
-				// Search for a contained author name
-				if (author.contains(this->visibleAuthors.at(i), Qt::CaseInsensitive)
-				        && this->shouldDisplayBasedOnTweetContent(content)) {
-					return true;
-				}
-			} else if (this->authorMatchingMode == MATCHING) {
-				// Search for an exact author name match
-				if (QString::compare(author, this->visibleAuthors.at(i), Qt::CaseInsensitive) == 0
-				        && shouldDisplayBasedOnTweetContent(content)) {
-					return true;
-				}
-			}
-		}
-		return false;
+	for (size_t i = 0; i < selection.size(); i++) {
+		// First of all, check if the tweet is visible based on its number of retweets, then check
+		// the visibility of this point based on the tweet's author and content
+		selection[i] = this->shouldDisplayBasedOnRetweets(numberOfRetweets[i])
+		               && this->shouldDisplayBasedOnAuthor(i, authors)
+		               && this->shouldDisplayBasedOnTweetContent(contents->GetValue(i));
+	}
+}
+
+bool TwitterFilter::shouldDisplayBasedOnAuthor(int pointIndex, vtkStringArray* authors) {
+	if (this->authorIds) {
+		int authorId = this->authorIds[pointIndex];
+		return authorId >= 0 && authorId < (int) this->visibleAuthorIds.size()
+		       && this->visibleAuthorIds[authorId];
 	}
+
+	return this->isVisibleAuthor(authors->GetValue(pointIndex));
 }
 
-bool TwitterFilter::shouldDisplayBasedOnTweetContent(QString content) {
-	if (this->visibleKeywords.count() == 0) {
+bool TwitterFilter::isVisibleAuthor(const std::string& author) {
+	if (this->visibleAuthors.isEmpty()) {
 		return true;
 	}
 
-	for (int i = 0; i < visibleKeywords.count(); i++) {
-		// Only filter for hashtags
-		if (content.contains(this->visibleKeywords.at(i), Qt::CaseInsensitive)) {
-			return true;
-		}
+	if (this->authorMatchingMode == CONTAINING) {
+		// Search for a contained author name
+		return this->visibleAuthors.isContainedIn(author);
+	} else if (this->authorMatchingMode == MATCHING) {
+		// Search for an exact author name match
+		return this->visibleAuthors.isEqualTo(author);
 	}
 
 	return false;
 }
 
+bool TwitterFilter::shouldDisplayBasedOnTweetContent(const std::string& content) {
+	if (this->visibleKeywords.isEmpty()) {
+		return true;
+	}
+
+	return this->visibleKeywords.isContainedIn(content);
+}
+
 bool TwitterFilter::shouldDisplayBasedOnRetweets(int retweetNumber) {
 	return this->lowerRetweetLimit <= retweetNumber && retweetNumber <= this->upperRetweetLimit;
 }
@@ -95,31 +105,33 @@ void TwitterFilter::setAuthorMatchingMode(int matchingMode) {
 }
 
 void TwitterFilter::setAuthors(const char* authors) {
-	if (QString::fromStdString(authors).trimmed() == "") {
-		this->visibleAuthors.clear();
-	} else {
+	QStringList visibleAuthors;
 
+	if (QString::fromStdString(authors).trimmed() != "") {
 		QString authorList = QString::fromStdString(authors).remove(" ");
 
-		this->visibleAuthors = authorList.split(",");
+		visibleAuthors = authorList.split(",");
 
-		for (int i = 0; i < this->visibleAuthors.size(); i++) {
+		for (int i = 0; i < visibleAuthors.size(); i++) {
 			// Remove trailing @ symbols if necessary
-			if (this->visibleAuthors[i].startsWith("@")) {
-				this->visibleAuthors[i] = this->visibleAuthors[i].remove(0, 1);
+			if (visibleAuthors[i].startsWith("@")) {
+				visibleAuthors[i] = visibleAuthors[i].remove(0, 1);
 			}
 		}
 	}
 
+	// Compile the names once here instead of matching each of them against every tweet
+	this->visibleAuthors.setKeywords(visibleAuthors, true);
 	this->Modified();
 }
 
 void TwitterFilter::setKeywords(const char* keywords) {
-	if (QString::fromStdString(keywords).replace("#", "").trimmed() == "") {
-		this->visibleKeywords.clear();
-	} else {
-		this->visibleKeywords = QString::fromStdString(keywords).split(",");
+	QStringList visibleKeywords;
+	if (QString::fromStdString(keywords).replace("#", "").trimmed() != "") {
+		visibleKeywords = QString::fromStdString(keywords).split(",");
 	}
+
+	this->visibleKeywords.setKeywords(visibleKeywords, false);
 	this->Modified();
 }
 
@@ -2,13 +2,20 @@
 #define KRONOS_TWITTER_FILTER_HPP
 
 #include <Filter/AbstractSelectionFilter.hpp>
+#include <Filter/TwitterFilter/KeywordMatcher.hpp>
 
 #include <vtkPoints.h>
 #include <vtkSmartPointer.h>
 
+#include <vtkIntArray.h>
+#include <vtkStringArray.h>
+
 #include <qmap.h>
 #include <qstringlist.h>
 
+#include <string>
+#include <vector>
+
 /**
  * This filter can extract data from Twitter point sets read by a Kronos reader depending on the tweet author and tweet content.
  */
@@ -69,12 +76,27 @@ private:
 	 */
 	TwitterFilter::Mode authorMatchingMode;
 
+	/**
+	 * Check whether a tweet should be displayed based on its author.
+	 * @param pointIndex The index of the tweet
+	 * @param authors The author name of each tweet, only used if the input holds no author IDs
+	 * @return True if it should be displayed, false otherwise
+	 */
+	bool shouldDisplayBasedOnAuthor(int pointIndex, vtkStringArray* authors);
+
+	/**
+	 * Check whether the tweets of an author should be displayed.
+	 * @param author The UTF-8 encoded name of the author
+	 * @return True if they should be displayed, false otherwise
+	 */
+	bool isVisibleAuthor(const std::string& author);
+
 	/**
 	 * Check whether a tweet should be displayed based on its content.
-	 * @param content The content of the tweet
+	 * @param content The UTF-8 encoded content of the tweet
 	 * @return True if it should be displayed, false otherwise
 	 */
-	bool shouldDisplayBasedOnTweetContent(QString content);
+	bool shouldDisplayBasedOnTweetContent(const std::string& content);
 
 	/**
 	 * Check whether a tweet should be displayed based on its number of retweets.
@@ -84,7 +106,14 @@ private:
 	bool shouldDisplayBasedOnRetweets(int retweetNumber);
 
 	QList<Data::Type> getCompatibleDataTypes();
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData);
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection);
+
+	/**
+	 * Look up the author IDs of the input and decide which of the authors in its dictionary are
+	 * visible.
+	 * @param inputData The data set whose tweets are about to be evaluated
+	 */
+	void prepareAuthorVisibilities(vtkPointSet* inputData);
 
 	/**
 	 * The lower limit of retweets whose tweets should still be displayed.
@@ -97,14 +126,26 @@ private:
 	double upperRetweetLimit;
 
 	/**
-	 * Contains all author names whose tweets should be extracted.
+	 * Matches the author names whose tweets should be extracted, ignoring spaces.
+	 */
+	KeywordMatcher visibleAuthors;
+
+	/**
+	 * Matches the keywords of visible tweets.
+	 */
+	KeywordMatcher visibleKeywords;
+
+	/**
+	 * The interned author ID of each tweet in the current input, or a null pointer if the input
+	 * only holds the author names
 	 */
-	QStringList visibleAuthors;
+	const int* authorIds;
 
 	/**
-	 * Contains all keywords of visible tweets.
+	 * Whether the tweets of each author in the current input's author dictionary are visible,
+	 * indexed by author ID
 	 */
-	QStringList visibleKeywords;
+	std::vector<bool> visibleAuthorIds;
 };
 
 #endif
@@ -0,0 +1,161 @@
+#include <Filter/TwitterFilter/KeywordMatcher.hpp>
+
+#include <qbytearray.h>
+
+#include <algorithm>
+#include <deque>
+
+KeywordMatcher::KeywordMatcher() : amountOfKeywords(0), ignoreSpaces(false),
+	containsEmptyKeyword(false), amountOfByteClasses(1), transitions(1, 0), acceptingStates(1, 0) {
+	std::fill(this->byteClasses, this->byteClasses + 256, 0);
+}
+
+KeywordMatcher::~KeywordMatcher() { }
+
+void KeywordMatcher::setKeywords(const QStringList& keywords, bool ignoreSpaces) {
+	this->amountOfKeywords = keywords.size();
+	this->ignoreSpaces = ignoreSpaces;
+	this->containsEmptyKeyword = false;
+	this->foldedKeywords.clear();
+
+	std::vector<std::string> foldedKeywords;
+	for (int i = 0; i < keywords.size(); i++) {
+		QString foldedKeyword = keywords.at(i).toCaseFolded();
+		if (ignoreSpaces) {
+			foldedKeyword.remove(' ');
+		}
+		QByteArray bytes = foldedKeyword.toUtf8();
+		foldedKeywords.push_back(std::string(bytes.constData(), bytes.size()));
+
+		this->foldedKeywords.insert(foldedKeywords.back());
+		this->containsEmptyKeyword |= foldedKeywords.back().empty();
+	}
+
+	// Give each byte occurring in any keyword its own class
+	std::fill(this->byteClasses, this->byteClasses + 256, 0);
+	this->amountOfByteClasses = 1;
+	for (size_t k = 0; k < foldedKeywords.size(); k++) {
+		for (size_t i = 0; i < foldedKeywords[k].size(); i++) {
+			unsigned char byte = foldedKeywords[k][i];
+			if (this->byteClasses[byte] == 0) {
+				this->byteClasses[byte] = this->amountOfByteClasses++;
+			}
+		}
+	}
+	int classes = this->amountOfByteClasses;
+
+	// Build a trie of all keywords, where -1 marks missing transitions
+	this->transitions.assign(classes, -1);
+	this->acceptingStates.assign(1, 0);
+	for (size_t k = 0; k < foldedKeywords.size(); k++) {
+		int state = 0;
+		for (size_t i = 0; i < foldedKeywords[k].size(); i++) {
+			int byteClass = this->byteClasses[(unsigned char) foldedKeywords[k][i]];
+			if (this->transitions[state * classes + byteClass] < 0) {
+				this->transitions[state * classes + byteClass] = this->acceptingStates.size();
+				this->transitions.resize(this->transitions.size() + classes, -1);
+				this->acceptingStates.push_back(0);
+			}
+			state = this->transitions[state * classes + byteClass];
+		}
+		this->acceptingStates[state] = 1;
+	}
+
+	// Replace the missing transitions by those of the longest proper suffix in the trie, visiting
+	// the states by their depth so that the suffix's transitions are complete already
+	std::vector<int> failures(this->acceptingStates.size(), 0);
+	std::deque<int> queue;
+	for (int byteClass = 0; byteClass < classes; byteClass++) {
+		int& next = this->transitions[byteClass];
+		if (next < 0) {
+			next = 0;
+		} else {
+			queue.push_back(next);
+		}
+	}
+	while (!queue.empty()) {
+		int state = queue.front();
+		queue.pop_front();
+
+		int failure = failures[state];
+		this->acceptingStates[state] |= this->acceptingStates[failure];
+		for (int byteClass = 0; byteClass < classes; byteClass++) {
+			int& next = this->transitions[state * classes + byteClass];
+			if (next < 0) {
+				next = this->transitions[failure * classes + byteClass];
+			} else {
+				failures[next] = this->transitions[failure * classes + byteClass];
+				queue.push_back(next);
+			}
+		}
+	}
+}
+
+bool KeywordMatcher::isEmpty() const {
+	return this->amountOfKeywords == 0;
+}
+
+bool KeywordMatcher::isContainedIn(const std::string& text) const {
+	if (this->containsEmptyKeyword) {
+		return true;
+	}
+	return this->scan(text, false);
+}
+
+bool KeywordMatcher::isEqualTo(const std::string& text) const {
+	return this->foldedKeywords.count(this->fold(text)) > 0;
+}
+
+std::string KeywordMatcher::fold(const std::string& text) const {
+	for (size_t i = 0; i < text.size(); i++) {
+		if ((unsigned char) text[i] >= 0x80) {
+			// Leave characters beyond ASCII to Qt
+			QString folded = QString::fromUtf8(text.data(), text.size()).toCaseFolded();
+			if (this->ignoreSpaces) {
+				folded.remove(' ');
+			}
+			QByteArray bytes = folded.toUtf8();
+			return std::string(bytes.constData(), bytes.size());
+		}
+	}
+
+	std::string folded;
+	folded.reserve(text.size());
+	for (size_t i = 0; i < text.size(); i++) {
+		char character = text[i];
+		if (this->ignoreSpaces && character == ' ') {
+			continue;
+		}
+		if (character >= 'A' && character <= 'Z') {
+			character += 'a' - 'A';
+		}
+		folded.push_back(character);
+	}
+	return folded;
+}
+
+bool KeywordMatcher::scan(const std::string& text, bool folded) const {
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+	int classes = this->amountOfByteClasses;
+	int state = 0;
+
+	for (size_t i = 0; i < text.size(); i++) {
+		unsigned char byte = bytes[i];
+		if (byte >= 0x80 && !folded) {
+			return this->scan(this->fold(text), true);
+		}
+		if (this->ignoreSpaces && byte == ' ') {
+			continue;
+		}
+		if (byte >= 'A' && byte <= 'Z') {
+			byte += 'a' - 'A';
+		}
+
+		state = this->transitions[state * classes + this->byteClasses[byte]];
+		if (this->acceptingStates[state]) {
+			return true;
+		}
+	}
+
+	return false;
+}
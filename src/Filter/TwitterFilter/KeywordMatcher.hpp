@@ -0,0 +1,114 @@
+#ifndef KRONOS_KEYWORD_MATCHER_HPP
+#define KRONOS_KEYWORD_MATCHER_HPP
+
+#include <qstringlist.h>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Finds a set of keywords in UTF-8 texts regardless of their case.
+ *
+ * The case-folded keywords are compiled into an Aho-Corasick automaton, so that a text is checked
+ * for all of them at once in a single pass over its bytes. The automaton only distinguishes the
+ * bytes occurring in any keyword, which keeps its transition table small. ASCII letters are folded
+ * while scanning, while texts with other characters are folded by Qt first, so that the matching
+ * agrees with Qt's case-insensitive comparisons.
+ */
+class KeywordMatcher {
+
+public:
+	/**
+	 * Create a new KeywordMatcher without any keywords.
+	 */
+	KeywordMatcher();
+	~KeywordMatcher();
+
+	/**
+	 * Compile a set of keywords, replacing the previous ones.
+	 * @param keywords The keywords
+	 * @param ignoreSpaces True if spaces are removed from the keywords and texts before matching
+	 */
+	void setKeywords(const QStringList& keywords, bool ignoreSpaces);
+
+	/**
+	 * Check whether there are no keywords.
+	 * @return True if no keywords have been set, false otherwise
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Check whether a text contains any of the keywords.
+	 * @param text The UTF-8 encoded text
+	 * @return True if any keyword is part of the text, false otherwise
+	 */
+	bool isContainedIn(const std::string& text) const;
+
+	/**
+	 * Check whether a text equals any of the keywords.
+	 * @param text The UTF-8 encoded text
+	 * @return True if the text is one of the keywords, false otherwise
+	 */
+	bool isEqualTo(const std::string& text) const;
+
+private:
+	/**
+	 * Fold the case of a text and remove its spaces if they are ignored.
+	 * @param text The UTF-8 encoded text
+	 * @return The folded UTF-8 encoded text
+	 */
+	std::string fold(const std::string& text) const;
+
+	/**
+	 * Run the automaton over a text.
+	 * @param text The UTF-8 encoded text
+	 * @param folded True if the text has been folded already, false if only ASCII letters may
+	 * need to be folded
+	 * @return True if any keyword is part of the text, false otherwise
+	 */
+	bool scan(const std::string& text, bool folded) const;
+
+	/**
+	 * The amount of keywords.
+	 */
+	int amountOfKeywords;
+
+	/**
+	 * True if spaces are removed from the keywords and texts.
+	 */
+	bool ignoreSpaces;
+
+	/**
+	 * True if a keyword is empty, which is contained in every text.
+	 */
+	bool containsEmptyKeyword;
+
+	/**
+	 * The folded keywords, for looking up whole texts.
+	 */
+	std::unordered_set<std::string> foldedKeywords;
+
+	/**
+	 * The class of each byte, which is 0 for all bytes not occurring in any keyword.
+	 */
+	unsigned short byteClasses[256];
+
+	/**
+	 * The amount of byte classes.
+	 */
+	int amountOfByteClasses;
+
+	/**
+	 * The state following each state for each byte class, i.e. the transitions of the automaton
+	 * with the failure links already resolved. State 0 is the initial one.
+	 */
+	std::vector<int> transitions;
+
+	/**
+	 * Whether reaching each state means that a keyword has been found.
+	 */
+	std::vector<unsigned char> acceptingStates;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include <Filter/WindSpeedThresholdFilter.h>
 
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
 #include <Reader/DataReader/Data.hpp>
 
 #include <vtkObjectFactory.h>
@@ -14,18 +15,18 @@ QList<Data::Type> WindSpeedThresholdFilter::getCompatibleDataTypes() {
 	return (QList<Data::Type>() << Data::WIND);
 }
 
-bool WindSpeedThresholdFilter::evaluatePoint(int pointIndex, Coordinate coordinate,
-        vtkPointData* pointData) {
-	vtkSmartPointer<vtkFloatArray> speedArray = vtkFloatArray::SafeDownCast(
-	            pointData->GetArray("speeds"));
+void WindSpeedThresholdFilter::evaluatePoints(vtkPointSet* inputData,
+        std::vector<unsigned char>& selection) {
+	const float* speeds = getValues<vtkFloatArray>(inputData, "speeds");
 
-	if (!speedArray) {
-		return false;
+	if (!speeds) {
+		return;
 	}
 
-	float speed = speedArray->GetTuple1(pointIndex);
-
-	return speed >= this->lowerLimit && speed <= this->upperLimit;
+	RangeSelection rangeSelection;
+	rangeSelection.addRange(speeds, this->lowerLimit, this->upperLimit,
+	                        this->getBlockSummaries(inputData, "speeds"));
+	rangeSelection.select(selection.data(), selection.size());
 }
 
 void WindSpeedThresholdFilter::SetInputConnection(vtkAlgorithmOutput* input) {
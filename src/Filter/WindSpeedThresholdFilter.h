@@ -38,7 +38,7 @@ private:
 	void operator=(const WindSpeedThresholdFilter&);  // Not implemented.
 
 	QList<Data::Type> getCompatibleDataTypes();
-	bool evaluatePoint(int pointIndex, Coordinate coordinate, vtkPointData* pointData);
+	void evaluatePoints(vtkPointSet* inputData, std::vector<unsigned char>& selection);
 
 	/**
 	 * Stores the lower wind speed limit for visible data points.
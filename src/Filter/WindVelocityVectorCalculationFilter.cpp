@@ -54,8 +54,9 @@ int WindVelocityVectorCalculationFilter::RequestData(vtkInformation* info,
 	vtkSmartPointer<vtkFloatArray> directionArray = vtkFloatArray::SafeDownCast(
 	            inputData->GetPointData()->GetArray(directionArrayName.toStdString().c_str()));
 
-	// Copy over all existing information since we only want to add an array
-	outputData->DeepCopy(inputData);
+	// Share all existing information since we only want to add an array. Adding it to the output
+	// does not change the input, so none of the input's arrays need to be duplicated.
+	outputData->ShallowCopy(inputData);
 
 	// Create the velocity array
 	vtkSmartPointer<vtkFloatArray> velocities = vtkSmartPointer<vtkFloatArray>::New();
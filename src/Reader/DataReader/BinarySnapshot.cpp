@@ -0,0 +1,390 @@
+#include <Reader/DataReader/BinarySnapshot.hpp>
+
+#include <Utils/Config/Configuration.hpp>
+#include <Utils/Misc/MakeUnique.hpp>
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#if QT_VERSION >= 0x050000
+#include <QStandardPaths>
+#else
+#include <QDesktopServices>
+#endif
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+const char BinarySnapshot::MAGIC[4] = { 'K', 'B', 'I', 'N' };
+const quint32 BinarySnapshot::VERSION = 2;
+
+/**
+ * Check whether all entries of an index refer to a data point.
+ * @param indices The data point indices
+ * @param size The amount of data points
+ * @return True if all indices are valid, false otherwise
+ */
+static bool areValidIndices(const std::vector<int>& indices, int size) {
+	for (size_t i = 0; i < indices.size(); i++) {
+		if (indices[i] < 0 || indices[i] >= size) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Appends raw values and columns to a file.
+ */
+class BinarySnapshot::Writer {
+public:
+	Writer(QFile& file) : file(file), ok(true) { }
+
+	template<typename T>
+	void value(const T& value) {
+		this->write(&value, sizeof(T));
+	}
+
+	template<typename T>
+	void column(const std::vector<T>& column) {
+		this->value((quint64) column.size());
+		this->write(column.data(), column.size() * sizeof(T));
+	}
+
+	/**
+	 * Write a string column as a table of end offsets followed by the concatenated characters.
+	 */
+	void column(const std::vector<std::string>& column) {
+		std::vector<quint64> offsets(column.size());
+		quint64 offset = 0;
+		for (size_t i = 0; i < column.size(); i++) {
+			offset += column[i].size();
+			offsets[i] = offset;
+		}
+
+		this->column(offsets);
+		for (size_t i = 0; i < column.size(); i++) {
+			this->write(column[i].data(), column[i].size());
+		}
+	}
+
+	void string(QString string) {
+		QByteArray bytes = string.toUtf8();
+		this->value((quint64) bytes.size());
+		this->write(bytes.constData(), bytes.size());
+	}
+
+	bool isOk() const {
+		return this->ok;
+	}
+
+private:
+	void write(const void* data, size_t size) {
+		if (size > 0 && this->file.write((const char*) data, size) != (qint64) size) {
+			this->ok = false;
+		}
+	}
+
+	QFile& file;
+	bool ok;
+};
+
+/**
+ * Reads raw values and columns from a memory-mapped file. Any attempt to read past the end of
+ * the file marks the reader as failed and yields empty values instead.
+ */
+class BinarySnapshot::Reader {
+public:
+	Reader(const uchar* data, quint64 size) : data(data), size(size), position(0), ok(true) { }
+
+	template<typename T>
+	T value() {
+		T value = T();
+		this->read(&value, sizeof(T));
+		return value;
+	}
+
+	template<typename T>
+	void column(std::vector<T>& column) {
+		quint64 length = this->value<quint64>();
+		if (!this->has(length, sizeof(T))) {
+			column.clear();
+			return;
+		}
+
+		column.resize(length);
+		this->read(column.data(), length * sizeof(T));
+	}
+
+	void column(std::vector<std::string>& column) {
+		std::vector<quint64> offsets;
+		this->column(offsets);
+
+		quint64 length = offsets.empty() ? 0 : offsets.back();
+		if (!this->has(length, 1)) {
+			column.clear();
+			return;
+		}
+
+		const char* characters = (const char*) this->data + this->position;
+		column.resize(offsets.size());
+
+		quint64 start = 0;
+		for (size_t i = 0; i < offsets.size(); i++) {
+			if (offsets[i] < start || offsets[i] > length) {
+				this->ok = false;
+				column.clear();
+				return;
+			}
+
+			column[i].assign(characters + start, offsets[i] - start);
+			start = offsets[i];
+		}
+
+		this->position += length;
+	}
+
+	QString string() {
+		quint64 length = this->value<quint64>();
+		if (!this->has(length, 1)) {
+			return QString();
+		}
+
+		QString string = QString::fromUtf8((const char*) this->data + this->position, length);
+		this->position += length;
+		return string;
+	}
+
+	bool isOk() const {
+		return this->ok;
+	}
+
+private:
+	/**
+	 * Check whether the file holds another `count` elements of `elementSize` bytes each.
+	 */
+	bool has(quint64 count, quint64 elementSize) {
+		if (!this->ok || count > (this->size - this->position) / elementSize) {
+			this->ok = false;
+		}
+		return this->ok;
+	}
+
+	void read(void* destination, quint64 length) {
+		if (this->has(length, 1)) {
+			std::memcpy(destination, this->data + this->position, length);
+			this->position += length;
+		}
+	}
+
+	const uchar* data;
+	quint64 size;
+	quint64 position;
+	bool ok;
+};
+
+template<typename Stream>
+void BinarySnapshot::transfer(Stream& stream, JsonReader& reader) {
+	PointDataSet& points = reader.pointDataSet;
+
+	stream.column(points.longitudes);
+	stream.column(points.latitudes);
+	stream.column(points.priorities);
+	stream.column(points.timestamps);
+
+	stream.column(points.names);
+
+	stream.column(points.destinationLongitudes);
+	stream.column(points.destinationLatitudes);
+	stream.column(points.airlineIds);
+	stream.column(points.originAirportCodeIds);
+	stream.column(points.destinationAirportCodeIds);
+	stream.column(points.flightLengths);
+	stream.column(points.airlineDictionary.strings);
+	stream.column(points.airportCodeDictionary.strings);
+
+	stream.column(points.authorIds);
+	stream.column(points.contents);
+	stream.column(points.numberOfRetweets);
+	stream.column(points.authorDictionary.strings);
+
+	stream.column(points.precipitationRates);
+	stream.column(points.precipitationTypes);
+	stream.column(points.temperatures);
+	stream.column(points.directions);
+	stream.column(points.speeds);
+	stream.column(points.cloudCovers);
+
+	PointDataIndex& index = reader.pointDataIndex;
+
+	stream.column(index.slices);
+	stream.column(index.sliceKeys);
+	stream.column(index.priorityOrder);
+	stream.column(index.priorityKeys);
+}
+
+bool BinarySnapshot::isEnabled() {
+	if (Configuration::getInstance().hasKey("dataReader.binarySnapshots")) {
+		return Configuration::getInstance().getBoolean("dataReader.binarySnapshots");
+	}
+
+	return false;
+}
+
+QString BinarySnapshot::getSnapshotPath(QString sourcePath) {
+	QString directory;
+	if (Configuration::getInstance().hasKey("dataReader.snapshotDirectory")) {
+		directory = Configuration::getInstance().getString("dataReader.snapshotDirectory");
+	} else {
+		// Default to the user's cache directory instead of the working directory
+#if QT_VERSION >= 0x050000
+		QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+#else
+		QString cacheLocation = QDesktopServices::storageLocation(QDesktopServices::CacheLocation);
+#endif
+		if (cacheLocation.isEmpty()) {
+			return QString();
+		}
+		directory = cacheLocation + "/snapshots";
+	}
+
+	QString hash = QString::fromLatin1(
+	                   QCryptographicHash::hash(sourcePath.toUtf8(), QCryptographicHash::Md5).toHex()
+	               );
+
+	return QString("%1/%2.kbin").arg(directory).arg(hash);
+}
+
+std::unique_ptr<JsonReader> BinarySnapshot::load(QString sourcePath) {
+	QFileInfo sourceInfo(sourcePath);
+	QString path = sourceInfo.absoluteFilePath();
+
+	QString snapshotPath = BinarySnapshot::getSnapshotPath(path);
+	if (snapshotPath.isEmpty()) {
+		return nullptr;
+	}
+
+	QFile file(snapshotPath);
+	if (!sourceInfo.exists() || !file.open(QIODevice::ReadOnly)) {
+		return nullptr;
+	}
+
+	uchar* data = file.map(0, file.size());
+	if (!data) {
+		return nullptr;
+	}
+
+	Reader stream(data, file.size());
+	std::unique_ptr<JsonReader> reader;
+
+	char magic[4];
+	for (int i = 0; i < 4; i++) {
+		magic[i] = stream.value<char>();
+	}
+
+	// Only use snapshots of the very same file in its current state
+	bool upToDate = std::memcmp(magic, BinarySnapshot::MAGIC, 4) == 0
+	                && stream.value<quint32>() == BinarySnapshot::VERSION
+	                && stream.value<qint64>() == sourceInfo.size()
+	                && stream.value<qint64>() == sourceInfo.lastModified().toMSecsSinceEpoch()
+	                && stream.string() == path;
+
+	if (upToDate && stream.isOk()) {
+		qint32 dataType = stream.value<qint32>();
+		bool temporal = stream.value<qint32>() != 0;
+		qint32 timeResolution = stream.value<qint32>();
+		qint32 startTime = stream.value<qint32>();
+		qint32 endTime = stream.value<qint32>();
+
+		// The time steps of temporal data are derived from these, so they need to make sense
+		bool validTimes = !temporal || (timeResolution > 0 && endTime >= startTime);
+
+		if (dataType < Data::CITIES || dataType > Data::CLOUD_COVERAGE || !validTimes) {
+			file.unmap(data);
+			return nullptr;
+		}
+
+		reader = makeUnique<JsonReader>(static_cast<Data::Type>(dataType), path, temporal,
+		                                timeResolution);
+		reader->startTime = startTime;
+		reader->endTime = endTime;
+
+		BinarySnapshot::transfer(stream, *reader);
+
+		reader->pointDataSet.airlineDictionary.rebuildLookup();
+		reader->pointDataSet.airportCodeDictionary.rebuildLookup();
+		reader->pointDataSet.authorDictionary.rebuildLookup();
+
+		// Every column and the index need an entry for each data point, and the index may only
+		// refer to existing data points
+		int size = reader->pointDataSet.size();
+		const PointDataIndex& index = reader->pointDataIndex;
+		bool consistent = reader->pointDataSet.isConsistent()
+		                  && index.slices.size() == (size_t) size
+		                  && index.sliceKeys.size() == (size_t) size
+		                  && (index.priorityOrder.empty()
+		                      || index.priorityOrder.size() == (size_t) size)
+		                  && index.priorityKeys.size() == index.priorityOrder.size()
+		                  && areValidIndices(index.slices, size)
+		                  && areValidIndices(index.priorityOrder, size);
+
+		if (!stream.isOk() || !consistent) {
+			reader.reset();
+		}
+	}
+
+	file.unmap(data);
+
+	return reader;
+}
+
+bool BinarySnapshot::save(JsonReader& reader, QString sourcePath) {
+	QFileInfo sourceInfo(sourcePath);
+	QString path = sourceInfo.absoluteFilePath();
+	QString snapshotPath = BinarySnapshot::getSnapshotPath(path);
+
+	if (snapshotPath.isEmpty() || !QDir().mkpath(QFileInfo(snapshotPath).absolutePath())) {
+		return false;
+	}
+
+	// Write to a temporary file first so that no incomplete snapshot is ever loaded
+	QString temporaryPath = snapshotPath + ".tmp";
+	QFile file(temporaryPath);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		return false;
+	}
+
+	Writer stream(file);
+
+	for (int i = 0; i < 4; i++) {
+		stream.value(BinarySnapshot::MAGIC[i]);
+	}
+	stream.value(BinarySnapshot::VERSION);
+	stream.value((qint64) sourceInfo.size());
+	stream.value((qint64) sourceInfo.lastModified().toMSecsSinceEpoch());
+	stream.string(path);
+
+	stream.value((qint32) reader.dataType);
+	stream.value((qint32) (reader.temporal ? 1 : 0));
+	stream.value((qint32) reader.timeResolution);
+	stream.value((qint32) reader.startTime);
+	stream.value((qint32) reader.endTime);
+
+	BinarySnapshot::transfer(stream, reader);
+
+	bool written = stream.isOk() && file.flush();
+	file.close();
+
+	if (!written) {
+		QFile::remove(temporaryPath);
+		return false;
+	}
+
+	QFile::remove(snapshotPath);
+	return QFile::rename(temporaryPath, snapshotPath);
+}
@@ -0,0 +1,84 @@
+#ifndef KRONOS_BINARYSNAPSHOT_HPP
+#define KRONOS_BINARYSNAPSHOT_HPP
+
+#include <QString>
+
+#include <Reader/DataReader/JsonReader.hpp>
+
+#include <memory>
+
+/**
+* Reads and writes binary snapshots (`.kbin` files) of data that has already been read from a
+* kJson file. A snapshot holds the columns of all data points, including the string tables, and
+* the index sorted by time step and priority, so loading it skips parsing and validation entirely.
+* Snapshots are memory-mapped while being loaded.
+*
+* Snapshots are stored in a cache directory and identified by the absolute path of the file they
+* were created from. They also record the size and modification time of that file and are ignored
+* once the file has changed. Since they are meant as a local cache, they are written in the
+* machine's native byte order.
+*/
+class BinarySnapshot {
+
+public:
+	/**
+	 * Check whether snapshots should be used as configured by `dataReader.binarySnapshots`.
+	 * @return True if snapshots should be loaded and saved, false otherwise
+	 */
+	static bool isEnabled();
+
+	/**
+	 * Load the snapshot of a kJson file.
+	 * @param sourcePath The path of the kJson file
+	 * @return A reader holding the data of the file or a null pointer if there is no snapshot of
+	 * the file, the snapshot is outdated or it could not be read
+	 */
+	static std::unique_ptr<JsonReader> load(QString sourcePath);
+
+	/**
+	 * Save the data of a reader as the snapshot of the kJson file it has been created from.
+	 * @param reader The reader holding the file's data
+	 * @param sourcePath The path of the kJson file
+	 * @return True if the snapshot has been written, false otherwise
+	 */
+	static bool save(JsonReader& reader, QString sourcePath);
+
+private:
+	class Writer;
+	class Reader;
+
+	/**
+	 * Write or read all columns and index arrays of a reader, depending on the stream used.
+	 * @param stream Either a `Writer` or a `Reader`
+	 * @param reader The reader whose data is transferred
+	 */
+	template<typename Stream>
+	static void transfer(Stream& stream, JsonReader& reader);
+
+	/**
+	 * Get the path of the snapshot belonging to a kJson file. Snapshots are stored in
+	 * `dataReader.snapshotDirectory` if configured and in the user's cache directory otherwise.
+	 * @param sourcePath The absolute path of the kJson file
+	 * @return The path of the snapshot or an empty string if there is no cache directory
+	 */
+	static QString getSnapshotPath(QString sourcePath);
+
+	/**
+	 * Identifies snapshot files, followed by the format version
+	 */
+	static const char MAGIC[4];
+
+	/**
+	 * Version of the snapshot format, to be increased whenever the layout changes
+	 */
+	static const quint32 VERSION;
+
+	/**
+	 * Hidden since this class only offers static utility methods.
+	 */
+	BinarySnapshot();
+	~BinarySnapshot();
+
+};
+
+#endif
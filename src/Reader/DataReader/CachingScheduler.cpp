@@ -0,0 +1,100 @@
+#include <Reader/DataReader/CachingScheduler.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+CachingScheduler::CachingScheduler(int maximumPriority, int amountOfTimeSteps)
+	: maximumPriority(std::max(maximumPriority, 0)), amountOfTimeSteps(std::max(amountOfTimeSteps, 1)),
+	  focusZoomLevel(0), focusTime(0), ringDistance(0), ringPosition(0), stopped(false) {
+	this->remaining = (this->maximumPriority + 1) * this->amountOfTimeSteps;
+	this->claimed.resize(this->remaining, false);
+	this->fillRing(0);
+}
+
+void CachingScheduler::setFocus(int zoomLevel, int time) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	// Keep the focus inside the data set so that every slice is reached eventually
+	zoomLevel = std::min(std::max(zoomLevel, 0), this->maximumPriority);
+	time = std::min(std::max(time, 0), this->amountOfTimeSteps - 1);
+
+	if (zoomLevel == this->focusZoomLevel && time == this->focusTime) {
+		return;
+	}
+
+	this->focusZoomLevel = zoomLevel;
+	this->focusTime = time;
+	this->ringDistance = 0;
+	this->fillRing(0);
+}
+
+bool CachingScheduler::next(int& zoomLevel, int& time) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	while (!this->stopped && this->remaining > 0) {
+		if (this->ringPosition == this->ring.size()) {
+			this->ringDistance++;
+			this->fillRing(this->ringDistance);
+			continue;
+		}
+
+		std::pair<int, int> slice = this->ring[this->ringPosition++];
+		std::vector<bool>::reference sliceClaimed = this->claimed[
+		            slice.second * (this->maximumPriority + 1) + slice.first];
+
+		if (!sliceClaimed) {
+			sliceClaimed = true;
+			this->remaining--;
+
+			zoomLevel = slice.first;
+			time = slice.second;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void CachingScheduler::stop() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	this->stopped = true;
+}
+
+void CachingScheduler::fillRing(int distance) {
+	this->ring.clear();
+	this->ringPosition = 0;
+
+	// Only zoom levels that exist are looked at since there are far fewer of them than time steps
+	int lowestZoomLevel = std::max(this->focusZoomLevel - distance, 0);
+	int highestZoomLevel = std::min(this->focusZoomLevel + distance, this->maximumPriority);
+
+	for (int zoomLevel = lowestZoomLevel; zoomLevel <= highestZoomLevel; zoomLevel++) {
+		// Only the border of the square around the focus belongs to this ring, so the whole time
+		// range is needed on its top and bottom edge and two time steps everywhere else
+		int timeOffsetStep = std::abs(zoomLevel - this->focusZoomLevel) == distance
+		                     ? 1 : std::max(2 * distance, 1);
+
+		for (int timeOffset = -distance; timeOffset <= distance; timeOffset += timeOffsetStep) {
+			int time = this->focusTime + timeOffset;
+
+			if (this->isValid(zoomLevel, time)) {
+				this->ring.push_back(std::make_pair(zoomLevel, time));
+			}
+		}
+	}
+
+	// Hand out the slices closest to the focus first
+	int focusZoomLevel = this->focusZoomLevel;
+	int focusTime = this->focusTime;
+	std::stable_sort(this->ring.begin(), this->ring.end(),
+	[focusZoomLevel, focusTime](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+		return std::abs(a.first - focusZoomLevel) + std::abs(a.second - focusTime)
+		       < std::abs(b.first - focusZoomLevel) + std::abs(b.second - focusTime);
+	});
+}
+
+bool CachingScheduler::isValid(int zoomLevel, int time) const {
+	return zoomLevel >= 0 && zoomLevel <= this->maximumPriority
+	       && time >= 0 && time < this->amountOfTimeSteps;
+}
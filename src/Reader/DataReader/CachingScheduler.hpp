@@ -0,0 +1,104 @@
+#ifndef KRONOS_CACHINGSCHEDULER_HPP
+#define KRONOS_CACHINGSCHEDULER_HPP
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+* Hands out the slices of a data set, each identified by a zoom level and a time step, to a pool
+* of threads caching them in the background. Slices are handed out in rings of growing distance
+* around a focus, which is the slice the user is currently looking at, so the slices most likely
+* to be requested next are cached first. Each slice is handed out only once. All methods are
+* thread-safe.
+*/
+class CachingScheduler {
+
+public:
+	/**
+	 * Create a new scheduler for all slices of a data set.
+	 * @param maximumPriority The highest zoom level to be cached
+	 * @param amountOfTimeSteps The amount of time steps to be cached, 1 for non-temporal data
+	 */
+	CachingScheduler(int maximumPriority, int amountOfTimeSteps);
+
+	/**
+	 * Move the focus to a slice. The slices around it will be handed out next.
+	 * @param zoomLevel The zoom level the user is currently looking at
+	 * @param time The time step the user is currently looking at
+	 */
+	void setFocus(int zoomLevel, int time);
+
+	/**
+	 * Claim the next slice to be cached.
+	 * @param zoomLevel Receives the zoom level of the slice
+	 * @param time Receives the time step of the slice
+	 * @return True if a slice has been claimed, false if all slices have been handed out or the
+	 * scheduler has been stopped
+	 */
+	bool next(int& zoomLevel, int& time);
+
+	/**
+	 * Stop handing out slices, making all subsequent calls to `next` fail.
+	 */
+	void stop();
+
+private:
+	/**
+	 * Collect all slices at a specified distance from the focus into `ring`, the nearest zoom
+	 * levels and time steps first. The mutex has to be held.
+	 * @param distance The distance of the ring, which is the larger of the zoom level and time
+	 * step distances
+	 */
+	void fillRing(int distance);
+
+	/**
+	 * Check whether a zoom level and time step denote an existing slice.
+	 */
+	bool isValid(int zoomLevel, int time) const;
+
+	int maximumPriority;
+	int amountOfTimeSteps;
+
+	int focusZoomLevel;
+	int focusTime;
+
+	/**
+	 * The distance of the ring currently being handed out
+	 */
+	int ringDistance;
+
+	/**
+	 * The slices of the current ring as pairs of zoom level and time step
+	 */
+	std::vector<std::pair<int, int>> ring;
+
+	/**
+	 * The position of the next slice in `ring`
+	 */
+	size_t ringPosition;
+
+	/**
+	 * Flag for each slice denoting whether it has been handed out already, indexed by
+	 * `time * (maximumPriority + 1) + zoomLevel`
+	 */
+	std::vector<bool> claimed;
+
+	/**
+	 * The amount of slices that have not been handed out yet
+	 */
+	int remaining;
+
+	/**
+	 * Boolean flag denoting whether the scheduler has been stopped
+	 */
+	bool stopped;
+
+	/**
+	 * Guards all members since slices are claimed by several threads
+	 */
+	std::mutex mutex;
+
+};
+
+#endif
@@ -6,6 +6,8 @@ vtkInformationKeyMacro(Data, VTK_DATA_TYPE, DataType)
 vtkInformationKeyMacro(Data, VTK_DATA_STATE, DataState)
 vtkInformationKeyMacro(Data, VTK_TIME_RESOLUTION, TimeResolution)
 vtkInformationKeyMacro(Data, VTK_DATA_TRANSFORMATION, DataTransformation)
+vtkInformationKeyMacro(Data, VTK_START_TIME, Integer)
+vtkInformationKeyMacro(Data, VTK_ALL_TIME_STEPS, AllTimeSteps)
 
 static QMap<Data::Type, QString> dataTypeNameMap() {
 	QMap<Data::Type, QString> map;
@@ -5,8 +5,10 @@
 #include <Reader/DataReader/MetaInformationKeys/vtkInformationTimeResolutionKey.hpp>
 #include <Reader/DataReader/MetaInformationKeys/vtkInformationDataStateKey.hpp>
 #include <Reader/DataReader/MetaInformationKeys/vtkInformationDataTransformationKey.hpp>
+#include <Reader/DataReader/MetaInformationKeys/vtkInformationAllTimeStepsKey.hpp>
 
 #include <vtkInformationDataObjectMetaDataKey.h>
+#include <vtkInformationIntegerKey.h>
 
 #include <QMap>
 #include <QString>
@@ -37,6 +39,21 @@ public:
 	 */
 	static vtkInformationDataTransformationKey* VTK_DATA_TRANSFORMATION();
 
+	/**
+	 * A VTK information key holding the timestamp of the earliest data point of temporal data. It
+	 * is not passed through the pipeline, so only filters connected directly to a Kronos reader
+	 * see it and may request the data points of all time steps at once using
+	 * `VTK_ALL_TIME_STEPS`.
+	 */
+	static vtkInformationIntegerKey* VTK_START_TIME();
+
+	/**
+	 * A VTK information key that can be set in the update request to a Kronos reader to receive the
+	 * data points of all time steps in a single data set, each carrying its timestamp. The reader
+	 * runs again for it if it has only produced a single time step so far.
+	 */
+	static vtkInformationAllTimeStepsKey* VTK_ALL_TIME_STEPS();
+
 	/**
 	 * Enum that denotes a data type. Do not assign values to these. Adding a new data type here
 	 * requires changes to the `JsonValidator` class.
@@ -59,6 +76,17 @@ public:
 		UNTRANSFORMED, CONDENSED, TRANSFORMED
 	};
 
+	/**
+	 * Enum that denotes a precipitation type.
+	 * Use caution when changing this enum or the integer values assigned to each entry. These will
+	 * be exported to an integer array for the data points to be passed through the ParaView
+	 * pipeline. Therefore, changing values may negatively impact the semantics of components that
+	 * take these integer values for granted.
+	 */
+	enum PrecipitationType {
+		NONE = 0, RAIN = 1, SNOW = 2, SLEET = 3, HAIL = 4
+	};
+
 	/**
 	 * Check whether a data type contains time information.
 	 * @param dataType Data type to be checked
@@ -1,4 +0,0 @@
-#include <Reader/DataReader/DataPoints/NonTemporalDataPoints/NonTemporalDataPoint.hpp>
-
-NonTemporalDataPoint::NonTemporalDataPoint(Data::Type dataType, Coordinate coordinate,
-        int priority) : DataPoint(dataType, coordinate, priority) { }
\ No newline at end of file
@@ -1,25 +1,19 @@
 #include <Reader/DataReader/JsonReader.hpp>
 
-#include <Reader/DataReader/DataPoints/NonTemporalDataPoints/CityDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/NonTemporalDataPoints/FlightDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/TemperatureDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/TweetDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/WindDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/CloudCoverageDataPoint.hpp>
+#include <Reader/DataReader/Data.hpp>
 #include <Reader/DataReader/JsonValidator.hpp>
 
 #include <Reader/DataReader/PolyDataSetHelper.hpp>
 #include <Utils/Config/Configuration.hpp>
 #include <Utils/Math/GeographicFunctions.hpp>
 
+#include <cstring>
+#include <utility>
+#include <vector>
+
 JsonReader::JsonReader(rapidjson::Value& jsonDocument, Data::Type dataType, QString path,
                        bool temporal,
-                       int timeResolution) : filePath(path), temporal(temporal), dataType(dataType),
-	timeResolution(timeResolution), cachingAbortRequested(false) {
-	this->cachingEnabled = true;
-	this->pointDataSet = PointDataSet();
-
+                       int timeResolution) : JsonReader(dataType, path, temporal, timeResolution) {
 	if (!jsonDocument.IsObject() || !jsonDocument.HasMember("children")) {
 		throw JsonReaderParseException(
 		    path,
@@ -27,8 +21,46 @@ JsonReader::JsonReader(rapidjson::Value& jsonDocument, Data::Type dataType, QStr
 		);
 	}
 
-	this->indexDataPoints(jsonDocument["children"], 0);
+	// Validate the whole hierarchy up front so that the data points can be read without any checks
+	JsonValidator::validateChildElements(jsonDocument["children"], this->dataType, this->filePath);
+
+	this->indexDataPoints(jsonDocument["children"]);
+	this->finishIndexing();
+}
+
+JsonReader::JsonReader(Data::Type dataType, QString path, bool temporal, int timeResolution)
+	: filePath(path), temporal(temporal), dataType(dataType), timeResolution(timeResolution),
+	  startTime(0), endTime(0), pointDataSet(dataType), cache(0), cachingEnabled(true),
+	  cachingAbortRequested(false), prefetchedTimeSteps(2), prefetchPending(false),
+	  prefetchStopRequested(false), prefetchZoomLevel(0), prefetchTime(0) {
+	// The cache size is configured in megabytes
+	size_t cacheSize = 1024;
+	if (Configuration::getInstance().hasKey("dataReader.cacheSize")) {
+		cacheSize = Configuration::getInstance().getInteger("dataReader.cacheSize");
+	}
+	this->cache.setBudget(cacheSize * 1024 * 1024);
+
+	if (Configuration::getInstance().hasKey("dataReader.prefetchedTimeSteps")) {
+		this->prefetchedTimeSteps = Configuration::getInstance()
+		                            .getInteger("dataReader.prefetchedTimeSteps");
+	}
+}
+
+JsonReader::~JsonReader() {
+	{
+		std::lock_guard<std::mutex> lock(this->prefetchMutex);
+		this->prefetchStopRequested = true;
+	}
+	this->prefetchCondition.notify_one();
 
+	if (this->prefetchThread.joinable()) {
+		this->prefetchThread.join();
+	}
+
+	this->clearCache();
+}
+
+void JsonReader::finishIndexing() {
 	// Get timestamps of the earliest and latest data point if the data is time-sensitive
 	if (this->hasTemporalData()) {
 		// Initialize minimum and maximum values as smallest and biggest possible UNIX timestamps
@@ -36,19 +68,13 @@ JsonReader::JsonReader(rapidjson::Value& jsonDocument, Data::Type dataType, QStr
 		int earliestTimestamp = 2147483647;
 		int latestTimestamp = 0;
 
-		QList<DataPoint*>::iterator i;
-		QList<DataPoint*> points = this->pointDataSet.getDataPoints();
-		for (i = points.begin(); i != points.end(); ++i) {
-			const TemporalDataPoint* dataPoint
-			    = dynamic_cast<const TemporalDataPoint*>((*i));
-
-			int timestamp = dataPoint->getTimestamp();
-
-			if (timestamp < earliestTimestamp) {
-				earliestTimestamp = timestamp;
+		const std::vector<int>& timestamps = this->pointDataSet.getTimestamps();
+		for (std::vector<int>::const_iterator i = timestamps.begin(); i != timestamps.end(); ++i) {
+			if (*i < earliestTimestamp) {
+				earliestTimestamp = *i;
 			}
-			if (timestamp > latestTimestamp) {
-				latestTimestamp = timestamp;
+			if (*i > latestTimestamp) {
+				latestTimestamp = *i;
 			}
 		}
 
@@ -56,128 +82,129 @@ JsonReader::JsonReader(rapidjson::Value& jsonDocument, Data::Type dataType, QStr
 		this->startTime = earliestTimestamp;
 		this->endTime = latestTimestamp;
 	}
-}
 
-JsonReader::~JsonReader() {
-	this->clearCache();
+	// Sort the data points by time step and priority for quick retrieval of single slices
+	this->pointDataIndex.build(this->pointDataSet, this->startTime, this->timeResolution);
 }
 
-void JsonReader::indexDataPoints(rapidjson::Value& jsonValue, int depth) {
-	for (rapidjson::SizeType i = 0; i < jsonValue.Size(); i++) {
-		// Validate the data point's content before using it
-		JsonValidator::validateChildElement(jsonValue[i], this->dataType, this->filePath);
-
-		DataPoint* dataPoint;
-
-		// Initialize the new data point depending on the data type
-		switch (this->dataType) {
-		case Data::CITIES:
-			dataPoint = new CityDataPoint(
-			    Coordinate(
-			        jsonValue[i]["latitude"].GetDouble(),
-			        jsonValue[i]["longitude"].GetDouble()
-			    ),
-			    depth,
-			    jsonValue[i]["name"].GetString()
-			);
-			break;
-		case Data::FLIGHTS: {
-			Coordinate startPosition(jsonValue[i]["startPosition"]["latitude"].GetDouble(),
-			                         jsonValue[i]["startPosition"]["longitude"].GetDouble());
-			Coordinate endPosition(jsonValue[i]["endPosition"]["latitude"].GetDouble(),
-			                       jsonValue[i]["endPosition"]["longitude"].GetDouble());
-			double flightLength = calculateDistance(startPosition, endPosition);
-
-			dataPoint = new FlightDataPoint(
-			    startPosition,
-			    depth,
-			    endPosition,
-			    jsonValue[i]["airline"].GetString(),
-			    jsonValue[i]["startPosition"]["airportCode"].GetString(),
-			    jsonValue[i]["endPosition"]["airportCode"].GetString(),
-			    flightLength
-			);
-			break;
+void JsonReader::indexDataPoints(rapidjson::Value& jsonValue) {
+	// Each entry holds a list of sibling elements and the position of the next one to be indexed,
+	// the position of an entry in the stack equals the depth of its elements
+	std::vector<std::pair<rapidjson::Value*, rapidjson::SizeType> > stack;
+	stack.push_back(std::make_pair(&jsonValue, 0));
+
+	while (!stack.empty()) {
+		std::pair<rapidjson::Value*, rapidjson::SizeType>& siblings = stack.back();
+		if (siblings.second >= siblings.first->Size()) {
+			stack.pop_back();
+			continue;
 		}
-		case Data::TWEETS:
-			dataPoint = new TweetDataPoint(
-			    Coordinate(
-			        jsonValue[i]["latitude"].GetDouble(),
-			        jsonValue[i]["longitude"].GetDouble()
-			    ),
-			    depth,
-			    jsonValue[i]["timestamp"].GetInt(),
-			    jsonValue[i]["author"].GetString(),
-			    jsonValue[i]["content"].GetString(),
-			    jsonValue[i]["numberOfRetweets"].GetInt()
-			);
-			break;
-		case Data::PRECIPITATION: {
-			PrecipitationDataPoint::PrecipitationType precipitationType
-			    = PrecipitationDataPoint::NONE;
-
-			if (QString(jsonValue[i]["precipitationType"].GetString()) == "rain") {
-				precipitationType = PrecipitationDataPoint::RAIN;
-			} else if (QString(jsonValue[i]["precipitationType"].GetString()) == "snow") {
-				precipitationType = PrecipitationDataPoint::SNOW;
-			} else if (QString(jsonValue[i]["precipitationType"].GetString()) == "sleet") {
-				precipitationType = PrecipitationDataPoint::SLEET;
-			} else if (QString(jsonValue[i]["precipitationType"].GetString()) == "hail") {
-				precipitationType = PrecipitationDataPoint::HAIL;
-			}
 
-			dataPoint = new PrecipitationDataPoint(
-			    Coordinate(
-			        jsonValue[i]["latitude"].GetDouble(),
-			        jsonValue[i]["longitude"].GetDouble()
-			    ),
-			    depth,
-			    jsonValue[i]["timestamp"].GetInt(),
-			    (float) jsonValue[i]["precipitationRate"].GetDouble(),
-			    precipitationType
-			);
-			break;
-		}
-		case Data::TEMPERATURE:
-			dataPoint = new TemperatureDataPoint(
-			    Coordinate(
-			        jsonValue[i]["latitude"].GetDouble(),
-			        jsonValue[i]["longitude"].GetDouble()
-			    ),
-			    depth,
-			    jsonValue[i]["timestamp"].GetInt(),
-			    (float) jsonValue[i]["temperature"].GetDouble()
-			);
-			break;
-		case Data::WIND:
-			dataPoint = new WindDataPoint(
-			    Coordinate(
-			        jsonValue[i]["latitude"].GetDouble(),
-			        jsonValue[i]["longitude"].GetDouble()
-			    ),
-			    depth,
-			    jsonValue[i]["timestamp"].GetInt(),
-			    (float) jsonValue[i]["direction"].GetDouble(),
-			    (float) jsonValue[i]["speed"].GetDouble()
-			);
-			break;
-		case Data::CLOUD_COVERAGE:
-			dataPoint = new CloudCoverageDataPoint(
-			    Coordinate(
-			        jsonValue[i]["latitude"].GetDouble(),
-			        jsonValue[i]["longitude"].GetDouble()
-			    ),
-			    depth,
-			    jsonValue[i]["timestamp"].GetInt(),
-			    (float) jsonValue[i]["cloudCover"].GetDouble()
-			);
-			break;
-		}
+		rapidjson::Value& element = (*siblings.first)[siblings.second++];
+		this->storeDataPoint(element, stack.size() - 1, this->reserveDataPoint());
+
+		// Continue with the children before the remaining siblings to keep the file's order
+		stack.push_back(std::make_pair(&element["children"], 0));
+	}
+}
+
+int JsonReader::reserveDataPoint() {
+	return this->pointDataSet.reservePoint();
+}
+
+void JsonReader::indexDataPoint(rapidjson::Value& jsonValue, int depth, int index) {
+	// Validate the data point's content before using it
+	JsonValidator::validateChildElement(jsonValue, this->dataType, this->filePath);
+
+	this->storeDataPoint(jsonValue, depth, index);
+}
 
-		this->pointDataSet.addPoint(dataPoint);
+void JsonReader::storeDataPoint(rapidjson::Value& jsonValue, int depth, int index) {
+	if (this->dataType == Data::FLIGHTS) {
+		rapidjson::Value& startPosition = jsonValue["startPosition"];
+		rapidjson::Value& endPosition = jsonValue["endPosition"];
+
+		Coordinate origin(startPosition["latitude"].GetDouble(),
+		                  startPosition["longitude"].GetDouble());
+		Coordinate destination(endPosition["latitude"].GetDouble(),
+		                       endPosition["longitude"].GetDouble());
+
+		this->pointDataSet.setPoint(index, origin.lon(), origin.lat(), depth);
+		this->pointDataSet.setFlight(
+		    index,
+		    destination.lon(),
+		    destination.lat(),
+		    jsonValue["airline"].GetString(),
+		    startPosition["airportCode"].GetString(),
+		    endPosition["airportCode"].GetString(),
+		    (float) calculateDistance(origin, destination)
+		);
+		return;
+	}
 
-		// Recursively iterate through the children data points
-		this->indexDataPoints(jsonValue[i]["children"], depth + 1);
+	// All other data types store their position directly inside the element
+	this->pointDataSet.setPoint(
+	    index,
+	    jsonValue["longitude"].GetDouble(),
+	    jsonValue["latitude"].GetDouble(),
+	    depth
+	);
+
+	// The timestamp column exists for all temporal data types, which the validator ensures to
+	// carry a timestamp
+	if (Data::isTemporal(this->dataType)) {
+		this->pointDataSet.setTimestamp(index, jsonValue["timestamp"].GetInt());
+	}
+
+	// Fill the columns specific to the data type
+	switch (this->dataType) {
+	case Data::CITIES:
+		this->pointDataSet.setCity(index, jsonValue["name"].GetString());
+		break;
+	case Data::FLIGHTS:
+		break;
+	case Data::TWEETS:
+		this->pointDataSet.setTweet(
+		    index,
+		    jsonValue["author"].GetString(),
+		    jsonValue["content"].GetString(),
+		    jsonValue["numberOfRetweets"].GetInt()
+		);
+		break;
+	case Data::PRECIPITATION: {
+		Data::PrecipitationType precipitationType = Data::NONE;
+		const char* typeName = jsonValue["precipitationType"].GetString();
+
+		if (std::strcmp(typeName, "rain") == 0) {
+			precipitationType = Data::RAIN;
+		} else if (std::strcmp(typeName, "snow") == 0) {
+			precipitationType = Data::SNOW;
+		} else if (std::strcmp(typeName, "sleet") == 0) {
+			precipitationType = Data::SLEET;
+		} else if (std::strcmp(typeName, "hail") == 0) {
+			precipitationType = Data::HAIL;
+		}
+
+		this->pointDataSet.setPrecipitation(
+		    index,
+		    (float) jsonValue["precipitationRate"].GetDouble(),
+		    precipitationType
+		);
+		break;
+	}
+	case Data::TEMPERATURE:
+		this->pointDataSet.setTemperature(index, (float) jsonValue["temperature"].GetDouble());
+		break;
+	case Data::WIND:
+		this->pointDataSet.setWind(
+		    index,
+		    (float) jsonValue["direction"].GetDouble(),
+		    (float) jsonValue["speed"].GetDouble()
+		);
+		break;
+	case Data::CLOUD_COVERAGE:
+		this->pointDataSet.setCloudCover(index, (float) jsonValue["cloudCover"].GetDouble());
+		break;
 	}
 }
 
@@ -201,6 +228,10 @@ int JsonReader::getTimeResolution() const {
 	}
 }
 
+int JsonReader::getStartTime() const {
+	return this->startTime;
+}
+
 void JsonReader::setCachingEnabled(bool cachingEnabled) {
 	this->cachingEnabled = cachingEnabled;
 }
@@ -212,27 +243,32 @@ bool JsonReader::isCachingEnabled() const {
 void JsonReader::cacheAllData() {
 	this->setCachingEnabled(true);
 
+	int maximumPriority = Configuration::getInstance().getInteger("dataReader.maximumPriority");
+
 	if (this->hasTemporalData()) {
 		for (int currentTime = 0; currentTime < this->getAmountOfTimeSteps(); currentTime++) {
-			for (int i = 0; i <= Configuration::getInstance().getInteger("dataReader.maximumPriority");
-			        i++) {
+			for (int i = 0; i <= maximumPriority; i++) {
 				if (this->cachingAbortRequested) {
 					this->cachingAbortRequested = false;
 					return;
 				}
 
-				this->getVtkDataSet(i, currentTime);
+				// Caching any further would only displace the data cached so far
+				if (!this->cacheVtkDataSet(i, currentTime)) {
+					return;
+				}
 			}
 		}
 	} else {
-		for (int i = 0; i <= Configuration::getInstance().getInteger("dataReader.maximumPriority");
-		        i++) {
+		for (int i = 0; i <= maximumPriority; i++) {
 			if (this->cachingAbortRequested) {
 				this->cachingAbortRequested = false;
 				return;
 			}
 
-			this->getVtkDataSet(i);
+			if (!this->cacheVtkDataSet(i, 0)) {
+				return;
+			}
 		}
 	}
 }
@@ -242,8 +278,7 @@ void JsonReader::abortCaching() {
 }
 
 void JsonReader::clearCache() {
-	this->nonTemporalCache.clear();
-	this->temporalCache.clear();
+	this->cache.clear();
 }
 
 vtkSmartPointer<vtkPolyData> JsonReader::getVtkDataSet(int zoomLevel) {
@@ -251,7 +286,14 @@ vtkSmartPointer<vtkPolyData> JsonReader::getVtkDataSet(int zoomLevel) {
 }
 
 vtkSmartPointer<vtkPolyData> JsonReader::getVtkDataSet(int zoomLevel, int time) {
-	return this->getVtkDataSet(zoomLevel, time, true);
+	vtkSmartPointer<vtkPolyData> dataSet = this->getVtkDataSet(zoomLevel, time, true);
+
+	// Have the time steps the user is likely to request next ready in advance
+	if (this->cachingEnabled && this->hasTemporalData()) {
+		this->requestPrefetch(zoomLevel, time);
+	}
+
+	return dataSet;
 }
 
 vtkSmartPointer<vtkPolyData> JsonReader::getVtkDataSet(int zoomLevel, int time, bool temporal) {
@@ -259,51 +301,108 @@ vtkSmartPointer<vtkPolyData> JsonReader::getVtkDataSet(int zoomLevel, int time,
 
 	// If possible, retrieve the data set from the cache
 	if (this->cachingEnabled) {
-		if (verifiedTemporal) {
-			if (this->temporalCache.contains(zoomLevel)) {
-				if (this->temporalCache.value(zoomLevel).contains(time)) {
-					return this->temporalCache.value(zoomLevel).value(time);
-				}
-			}
-		} else {
-			if (this->nonTemporalCache.contains(zoomLevel)) {
-				return this->nonTemporalCache.value(zoomLevel);
-			}
+		vtkSmartPointer<vtkPolyData> cachedDataSet = this->cache.get(zoomLevel, time,
+		        verifiedTemporal);
+		if (cachedDataSet) {
+			return cachedDataSet;
 		}
 	}
 
-	vtkSmartPointer<vtkPolyData> dataSet;
-
-	if (verifiedTemporal) {
-		dataSet = PolyDataSetHelper::getPolyDataFromDataPoints(
-		              this->pointDataSet,
-		              zoomLevel,
-		              this->dataType,
-		              this->timeResolution,
-		              time,
-		              this->startTime
-		          );
-	} else {
-		dataSet = PolyDataSetHelper::getPolyDataFromDataPoints(
-		              this->pointDataSet,
-		              zoomLevel,
-		              this->dataType
-		          );
-	}
+	vtkSmartPointer<vtkPolyData> dataSet = this->createVtkDataSet(zoomLevel, time,
+	                                       verifiedTemporal);
 
 	// Save the data set to the cache if desired
 	if (this->cachingEnabled) {
-		if (verifiedTemporal) {
-			if (!this->temporalCache.contains(zoomLevel)) {
-				QMap<int, vtkSmartPointer<vtkPolyData>> zoomLevelCache;
-				this->temporalCache[zoomLevel] = zoomLevelCache;
+		this->cache.put(zoomLevel, time, verifiedTemporal, dataSet);
+	}
+
+	return dataSet;
+}
+
+bool JsonReader::cacheVtkDataSet(int zoomLevel, int time) {
+	bool verifiedTemporal = this->hasTemporalData();
+
+	if (this->cache.contains(zoomLevel, time, verifiedTemporal)) {
+		return true;
+	}
+
+	return this->cache.put(zoomLevel, time, verifiedTemporal,
+	                       this->createVtkDataSet(zoomLevel, time, verifiedTemporal));
+}
+
+vtkSmartPointer<vtkPolyData> JsonReader::createVtkDataSet(int zoomLevel, int time, bool temporal) {
+	if (temporal) {
+		return PolyDataSetHelper::getPolyDataFromDataPoints(
+		           this->pointDataSet,
+		           this->pointDataIndex,
+		           zoomLevel,
+		           this->dataType,
+		           time
+		       );
+	} else {
+		return PolyDataSetHelper::getPolyDataFromDataPoints(
+		           this->pointDataSet,
+		           this->pointDataIndex,
+		           zoomLevel,
+		           this->dataType
+		       );
+	}
+}
+
+void JsonReader::requestPrefetch(int zoomLevel, int time) {
+	if (this->prefetchedTimeSteps <= 0) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->prefetchMutex);
+
+		this->prefetchZoomLevel = zoomLevel;
+		this->prefetchTime = time;
+		this->prefetchPending = true;
+
+		if (!this->prefetchThread.joinable()) {
+			this->prefetchThread = std::thread(&JsonReader::prefetchLoop, this);
+		}
+	}
+
+	this->prefetchCondition.notify_one();
+}
+
+void JsonReader::prefetchLoop() {
+	while (true) {
+		int zoomLevel;
+		int time;
+
+		{
+			std::unique_lock<std::mutex> lock(this->prefetchMutex);
+			this->prefetchCondition.wait(lock, [this] {
+				return this->prefetchPending || this->prefetchStopRequested;
+			});
+
+			if (this->prefetchStopRequested) {
+				return;
 			}
 
-			this->temporalCache[zoomLevel][time] = dataSet;
-		} else {
-			this->nonTemporalCache[zoomLevel] = dataSet;
+			zoomLevel = this->prefetchZoomLevel;
+			time = this->prefetchTime;
+			this->prefetchPending = false;
+		}
+
+		// Cache the neighbouring time steps from the closest to the farthest one, starting over as
+		// soon as the user has moved on to another time step
+		for (int i = 0; i < 2 * this->prefetchedTimeSteps && !this->isPrefetchOutdated(); i++) {
+			int distance = i / 2 + 1;
+			int neighbour = i % 2 == 0 ? time + distance : time - distance;
+
+			if (neighbour >= 0 && neighbour < this->getAmountOfTimeSteps()) {
+				this->cacheVtkDataSet(zoomLevel, neighbour);
+			}
 		}
 	}
+}
 
-	return dataSet;
-}
\ No newline at end of file
+bool JsonReader::isPrefetchOutdated() {
+	std::lock_guard<std::mutex> lock(this->prefetchMutex);
+	return this->prefetchPending || this->prefetchStopRequested;
+}
@@ -3,18 +3,28 @@
 
 #include <Utils/Misc/Macros.hpp>
 #include <QString>
-#include <QMap>
 
 #include <vtkSmartPointer.h>
 #include <rapidjson/document.h>
 #include <vtkPolyData.h>
 #include <Reader/DataReader/PointDataSet.hpp>
+#include <Reader/DataReader/PointDataIndex.hpp>
+#include <Reader/DataReader/PolyDataCache.hpp>
 #include <Reader/DataReader/Data.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 class JsonReader {
 
 	KRONOS_FRIEND_TEST(TestJsonReader, ReadCityData);
 	KRONOS_FRIEND_TEST(TestJsonReader, ReadTwitterData);
+	KRONOS_FRIEND_TEST(TestJsonReader, StreamingEqualsDocumentIngestion);
+
+	friend class JsonStreamHandler;
+	friend class BinarySnapshot;
 
 public:
 	/**
@@ -27,6 +37,16 @@ public:
 	 */
 	JsonReader(rapidjson::Value& jsonDocument, Data::Type dataType, QString path, bool temporal,
 	           int timeResolution);
+
+	/**
+	 * Create a new JsonReader without any data points. The data points are added one by one while
+	 * a file is being streamed through a `JsonStreamHandler`.
+	 * @param dataType The type of data this reader should expect
+	 * @param path The absolute file path of the file read to be used with error messages
+	 * @param temporal True if the data is time-sensitive, false otherwise
+	 * @param timeResolution The amount of seconds in a time step
+	 */
+	JsonReader(Data::Type dataType, QString path, bool temporal, int timeResolution);
 	virtual ~JsonReader();
 
 	/**
@@ -53,23 +73,33 @@ public:
 	 */
 	int getTimeResolution() const;
 
+	/**
+	 * Get the timestamp of the earliest data point, which starts the first time step. This will
+	 * return 0 for non-temporal data.
+	 * @return The timestamp of the first time step
+	 */
+	int getStartTime() const;
+
 	/**
 	 * Get all data stored in the file this reader uses, pruned by a specified zoom level.
 	 * @param zoomLevel The zoom level of the data set. Every data point with a higher zoom level
 	 * will be discarded while creating the vtkPolyData.
 	 * @return All data relevant to the specified zoom level, formatted as vtkPolyData with each
-	 * point's data stored in the data point's scalar values.
+	 * point's data stored in the data point's scalar values. The data set may be shared with
+	 * the cache and has to be copied before being modified.
 	 */
 	vtkSmartPointer<vtkPolyData> getVtkDataSet(int zoomLevel);
 
 	/**
 	 * Get all data stored in the file this reader uses, pruned by a specified zoom level and time
-	 * range.
+	 * range. If caching is enabled, the neighbouring time steps are cached in the background
+	 * afterwards.
 	 * @param zoomLevel The zoom level of the data set. Every data point with a higher zoom level
 	 * will be discarded while creating the vtkPolyData.
 	 * @param time The current time step to be retrieved as used by ParaView
 	 * @return All data relevant to the specified zoom level, formatted as vtkPolyData with each
-	 * point's data stored in the data point's scalar values.
+	 * point's data stored in the data point's scalar values. The data set may be shared with
+	 * the cache and has to be copied before being modified.
 	 */
 	vtkSmartPointer<vtkPolyData> getVtkDataSet(int zoomLevel, int time);
 
@@ -89,10 +119,20 @@ public:
 
 	/**
 	 * Cache vtkPolyData for all possible zoom levels. This will take some time for once but enable
-	 * quick retrieval for future method calls.
+	 * quick retrieval for future method calls. Stops early once the cache's memory budget has been
+	 * reached.
 	 */
 	void cacheAllData();
 
+	/**
+	 * Create vtkPolyData for a zoom level and time step and put it into the cache unless it is
+	 * cached already. May be called from several threads at once.
+	 * @param zoomLevel The zoom level of the data set
+	 * @param time The time step of the data set, ignored for non-temporal data
+	 * @return False if the cache had to evict older data to make room, true otherwise
+	 */
+	bool cacheVtkDataSet(int zoomLevel, int time);
+
 	/**
 	 * Clear all cached vtkPolyData.
 	 */
@@ -140,26 +180,68 @@ private:
 	PointDataSet pointDataSet;
 
 	/**
-	 * A map with cached non-temporal vtkPolyData for specified zoom levels
+	 * An index over `pointDataSet` sorted by time step and priority, used to retrieve the points
+	 * relevant to a zoom level and time step without scanning the whole set
 	 */
-	QMap<int, vtkSmartPointer<vtkPolyData>> nonTemporalCache;
+	PointDataIndex pointDataIndex;
 
 	/**
-	 * A map with cached temporal vtkPolyData for specified zoom levels and time steps for each
-	 * zoom level
+	 * A memory-bounded cache of temporal and non-temporal vtkPolyData for specified zoom levels
+	 * and time steps, shared by all threads using this reader
 	 */
-	QMap<int, QMap<int, vtkSmartPointer<vtkPolyData>>> temporalCache;
+	PolyDataCache cache;
 
 	/**
 	 * Boolean flag denoting whether a cache should be used
 	 */
-	bool cachingEnabled;
+	std::atomic<bool> cachingEnabled;
 
 	/**
 	 * Boolean flag denoting whether a caching process in progress should be aborted.
 	 * To be used when caching is done in a different thread.
 	 */
-	bool cachingAbortRequested;
+	std::atomic<bool> cachingAbortRequested;
+
+	/**
+	 * The amount of time steps before and after the current one that are cached in the background
+	 */
+	int prefetchedTimeSteps;
+
+	/**
+	 * This thread caches the time steps next to the most recently requested one. It is started
+	 * with the first prefetch request.
+	 */
+	std::thread prefetchThread;
+
+	/**
+	 * Guards the prefetch request members below
+	 */
+	std::mutex prefetchMutex;
+
+	/**
+	 * Wakes up the prefetch thread when a new request is made or the reader is destroyed
+	 */
+	std::condition_variable prefetchCondition;
+
+	/**
+	 * Boolean flag denoting whether there is a prefetch request the thread has not picked up yet
+	 */
+	bool prefetchPending;
+
+	/**
+	 * Boolean flag denoting whether the prefetch thread should exit
+	 */
+	bool prefetchStopRequested;
+
+	/**
+	 * The zoom level of the most recent prefetch request
+	 */
+	int prefetchZoomLevel;
+
+	/**
+	 * The time step of the most recent prefetch request
+	 */
+	int prefetchTime;
 
 	/**
 	 * Get all data stored in the file this reader uses, pruned by a specified zoom level and time
@@ -174,12 +256,73 @@ private:
 	vtkSmartPointer<vtkPolyData> getVtkDataSet(int zoomLevel, int time, bool temporal);
 
 	/**
-	 * Iterate through a JSON representation of data points and save them to the PointDataSet this
-	 * reader holds.
-	 * @param jsonValue JSON object to be used
-	 * @param depth Current recursion depth
+	 * Create vtkPolyData for a zoom level and time step without consulting the cache.
+	 * @param zoomLevel The zoom level of the data set
+	 * @param time The time step of the data set
+	 * @param temporal True if the data set is a time slice of temporal data, false otherwise
+	 * @return All data relevant to the specified zoom level and time step
+	 */
+	vtkSmartPointer<vtkPolyData> createVtkDataSet(int zoomLevel, int time, bool temporal);
+
+	/**
+	 * Ask the prefetch thread to cache the time steps next to a specified one, replacing any
+	 * request it has not started working on yet.
+	 * @param zoomLevel The zoom level of the requested data set
+	 * @param time The time step of the requested data set
+	 */
+	void requestPrefetch(int zoomLevel, int time);
+
+	/**
+	 * Main loop of the prefetch thread.
+	 */
+	void prefetchLoop();
+
+	/**
+	 * Check whether the prefetch thread should abandon its current request.
+	 * @return True if a newer request has been made or the reader is being destroyed
+	 */
+	bool isPrefetchOutdated();
+
+	/**
+	 * Iterate through a JSON representation of data points and all of their descendants and save
+	 * them to the PointDataSet this reader holds. The data points have to be validated beforehand.
+	 * @param jsonValue JSON array holding the top-level data points
+	 */
+	void indexDataPoints(rapidjson::Value& jsonValue);
+
+	/**
+	 * Reserve a place for a data point that will be indexed later on using `indexDataPoint`. Used
+	 * while streaming so that the order of the data points matches the order in the file even
+	 * though a parent element is only complete after all of its children have been read.
+	 * @return The index of the reserved place
+	 */
+	int reserveDataPoint();
+
+	/**
+	 * Validate a single JSON data element and save the information of the data point it describes
+	 * to a place in the PointDataSet previously reserved using `reserveDataPoint`. The element's
+	 * children are not taken into account.
+	 * @param jsonValue JSON object describing the data point
+	 * @param depth Depth of the data point in the data hierarchy
+	 * @param index The index returned by `reserveDataPoint`
+	 */
+	void indexDataPoint(rapidjson::Value& jsonValue, int depth, int index);
+
+	/**
+	 * Save the information of an already validated JSON data element to a place in the
+	 * PointDataSet previously reserved using `reserveDataPoint`.
+	 * @param jsonValue JSON object describing the data point
+	 * @param depth Depth of the data point in the data hierarchy
+	 * @param index The index returned by `reserveDataPoint`
+	 */
+	void storeDataPoint(rapidjson::Value& jsonValue, int depth, int index);
+
+	/**
+	 * Determine the timestamps of the earliest and latest data point if the data is
+	 * time-sensitive and sort all data points into the slice index. To be called once all data
+	 * points have been indexed.
 	 */
-	void indexDataPoints(rapidjson::Value& jsonValue, int depth);
+	void finishIndexing();
 };
 
 #endif
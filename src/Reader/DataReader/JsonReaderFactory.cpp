@@ -2,11 +2,20 @@
 
 #include <QFile>
 #include <QFileInfo>
-#include <QTextStream>
+#include <QByteArray>
 #include <QPair>
 #include <Utils/Misc/MakeUnique.hpp>
 #include <Reader/DataReader/JsonValidator.hpp>
+#include <Reader/DataReader/JsonStreamHandler.hpp>
+#include <Utils/Config/Configuration.hpp>
 #include <rapidjson/error/en.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
 
 // Workaround to make static initialization possible in the IDE we all love -- Visual Studio.
 static QMap<QString, Data::Type> dataTypeMap() {
@@ -26,27 +35,49 @@ static QMap<QString, Data::Type> dataTypeMap() {
 const QMap<QString, Data::Type> JsonReaderFactory::DATA_TYPES = dataTypeMap();
 
 std::unique_ptr<JsonReader> JsonReaderFactory::createReader(const QString filename) {
+	bool streaming = true;
+
+	if (Configuration::getInstance().hasKey("dataReader.streamingIngestion")) {
+		streaming = Configuration::getInstance().getBoolean("dataReader.streamingIngestion");
+	}
+
+	return JsonReaderFactory::createReader(filename, streaming);
+}
+
+std::unique_ptr<JsonReader> JsonReaderFactory::createReader(const QString filename,
+        bool streaming) {
+	QString path = QFileInfo(filename).absoluteFilePath();
+
+	if (streaming) {
+		return JsonReaderFactory::createStreamingReader(path);
+	} else {
+		return JsonReaderFactory::createDocumentReader(path);
+	}
+}
+
+std::unique_ptr<JsonReader> JsonReaderFactory::createDocumentReader(const QString path) {
 	// Open the JSON file while checking for potential errors
-	QFile jsonFile(filename);
-	QFileInfo jsonFileInfo(filename);
+	QFile jsonFile(path);
 
 	if (!jsonFile.open(QIODevice::ReadOnly)) {
-		throw JsonReaderFileOpenException(jsonFileInfo.absoluteFilePath(), jsonFile.errorString());
+		throw JsonReaderFileOpenException(path, jsonFile.errorString());
 	}
 
-	// Read from the opened stream and save the file's contents in a string
-	QTextStream in(&jsonFile);
-	QString configText = in.readAll();
+	// Read the file's raw UTF-8 contents, avoiding a detour through a QString
+	QByteArray jsonContent = jsonFile.readAll();
 	jsonFile.close();
 
 	// Parse the file's content and construct a representation inside the memory
 	// using a `rapidjson::Document`
 	rapidjson::Document jsonDocument;
-	jsonDocument.Parse(configText.toStdString().c_str());
+	jsonDocument.Parse(jsonContent.constData());
+
+	// The document holds copies of all strings, so the raw content is not needed anymore
+	jsonContent.clear();
 
 	if (jsonDocument.HasParseError()) {
 		throw JsonReaderParseException(
-		    jsonFileInfo.absoluteFilePath(),
+		    path,
 		    QString("The file's JSON content is invalid. At position %1: %2")
 		    .arg(
 		        QString::number(jsonDocument.GetErrorOffset()),
@@ -58,7 +89,7 @@ std::unique_ptr<JsonReader> JsonReaderFactory::createReader(const QString filena
 	// Check if there is a root
 	if (!jsonDocument.HasMember("root")) {
 		throw JsonReaderParseException(
-		    jsonFileInfo.absoluteFilePath(),
+		    path,
 		    "The file does not contain a root data tag."
 		);
 	}
@@ -66,37 +97,81 @@ std::unique_ptr<JsonReader> JsonReaderFactory::createReader(const QString filena
 	// Extract meta data and create a new JSON reader
 	if (!jsonDocument.HasMember("meta")) {
 		throw JsonReaderParseException(
-		    jsonFileInfo.absoluteFilePath(),
+		    path,
 		    "The file does not contain meta information."
 		);
 	}
 
-	rapidjson::Value& metaData = jsonDocument["meta"];
+	return JsonReaderFactory::createReaderFromMetaData(jsonDocument["meta"], &jsonDocument["root"],
+	        path);
+}
+
+std::unique_ptr<JsonReader> JsonReaderFactory::createStreamingReader(const QString path) {
+	// Check whether the file can be opened first to get a meaningful error description
+	QFile jsonFile(path);
+
+	if (!jsonFile.open(QIODevice::ReadOnly)) {
+		throw JsonReaderFileOpenException(path, jsonFile.errorString());
+	}
+
+	jsonFile.close();
+
+	std::FILE* file = std::fopen(QFile::encodeName(path).constData(), "rb");
+
+	if (file == nullptr) {
+		throw JsonReaderFileOpenException(path, QString(std::strerror(errno)));
+	}
+
+	// Only a small window of the file is held in memory at any time
+	std::vector<char> buffer(STREAMING_BUFFER_SIZE);
+	rapidjson::FileReadStream stream(file, &buffer[0], buffer.size());
+
+	// Iterative parsing keeps the call stack flat, no matter how deep the data hierarchy is
+	JsonStreamHandler handler(path);
+	rapidjson::Reader reader;
+	rapidjson::ParseResult result;
+
+	try {
+		result = reader.Parse<rapidjson::kParseIterativeFlag>(stream, handler);
+	} catch (...) {
+		std::fclose(file);
+		throw;
+	}
+
+	std::fclose(file);
+
+	if (handler.isMetaDataMissing()) {
+		// The data type is needed before the data points can be read, so the file has to be
+		// read as a whole
+		return JsonReaderFactory::createDocumentReader(path);
+	}
+
+	if (result.IsError()) {
+		throw JsonReaderParseException(
+		    path,
+		    QString("The file's JSON content is invalid. At position %1: %2")
+		    .arg(
+		        QString::number(result.Offset()),
+		        QString(rapidjson::GetParseError_En(result.Code()))
+		    )
+		);
+	}
+
+	return handler.takeReader();
+}
 
+std::unique_ptr<JsonReader> JsonReaderFactory::createReaderFromMetaData(
+    rapidjson::Value& metaData, rapidjson::Value* rootData, const QString path) {
 	// Now that we know it exists, check the meta tag for validity
-	JsonValidator::validateMetaData(metaData, jsonFileInfo.absoluteFilePath());
+	JsonValidator::validateMetaData(metaData, path);
 
+	Data::Type dataType = JsonReaderFactory::DATA_TYPES.value(QString(metaData["dataType"].GetString()));
 	bool temporal = metaData["temporal"].GetBool();
+	int timeResolution = temporal ? metaData["timeResolution"].GetInt() : 0;
 
-	std::unique_ptr<JsonReader> jsonReader;
-
-	if (temporal) {
-		jsonReader = makeUnique<JsonReader>(
-		                 jsonDocument["root"],
-		                 JsonReaderFactory::DATA_TYPES.value(QString(metaData["dataType"].GetString())),
-		                 jsonFileInfo.absoluteFilePath(),
-		                 true,
-		                 metaData["timeResolution"].GetInt()
-		             );
+	if (rootData) {
+		return makeUnique<JsonReader>(*rootData, dataType, path, temporal, timeResolution);
 	} else {
-		jsonReader = makeUnique<JsonReader>(
-		                 jsonDocument["root"],
-		                 JsonReaderFactory::DATA_TYPES.value(QString(metaData["dataType"].GetString())),
-		                 jsonFileInfo.absoluteFilePath(),
-		                 false,
-		                 0
-		             );
+		return makeUnique<JsonReader>(dataType, path, temporal, timeResolution);
 	}
-
-	return std::move(jsonReader);
 }
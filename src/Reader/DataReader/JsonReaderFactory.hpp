@@ -42,20 +42,67 @@ struct JsonReaderParseException : public ReaderException {
 };
 
 class JsonReaderFactory {
+
+	friend class JsonStreamHandler;
+
 public:
 	/**
-	 * Create a JSON reader from a JSON file.
+	 * Create a JSON reader from a JSON file. Whether the file is streamed or read as a whole is
+	 * specified by the configuration value `dataReader.streamingIngestion`, streaming being the
+	 * default.
 	 * @param filename The JSON file's path
 	 * @return A JSON reader for the given file that will handle the file's contents with respect
 	 * to its meta information
 	 */
 	static std::unique_ptr<JsonReader> createReader(const QString filename);
+
+	/**
+	 * Create a JSON reader from a JSON file.
+	 * @param filename The JSON file's path
+	 * @param streaming True if the file should be streamed, validating and indexing each data
+	 * element as soon as it has been read, false if the whole file should be parsed into a JSON
+	 * document first
+	 * @return A JSON reader for the given file that will handle the file's contents with respect
+	 * to its meta information
+	 */
+	static std::unique_ptr<JsonReader> createReader(const QString filename, bool streaming);
 private:
+	/**
+	 * Parse a whole JSON file into a document and create a JSON reader from it.
+	 * @param path The JSON file's absolute path
+	 * @return A JSON reader for the given file
+	 */
+	static std::unique_ptr<JsonReader> createDocumentReader(const QString path);
+
+	/**
+	 * Stream a JSON file through a `JsonStreamHandler` and create a JSON reader from it. Falls back
+	 * to `createDocumentReader` if the file's meta header does not precede its data.
+	 * @param path The JSON file's absolute path
+	 * @return A JSON reader for the given file
+	 */
+	static std::unique_ptr<JsonReader> createStreamingReader(const QString path);
+
+	/**
+	 * Check a meta header for validity and create a JSON reader matching it.
+	 * @param metaData The file's meta header
+	 * @param rootData The file's root data tag whose data points the reader should hold, or a null
+	 * pointer if the data points will be added to the reader later on
+	 * @param path The JSON file's absolute path
+	 * @return A JSON reader for the data type described by the meta header
+	 */
+	static std::unique_ptr<JsonReader> createReaderFromMetaData(rapidjson::Value& metaData,
+	        rapidjson::Value* rootData, const QString path);
+
 	/**
 	 * This QMap maps the string notation of a data type (e.g. 'cities') as present in a JSON file's
 	 * meta header to the respective type's enum value (e.g. `Data::CITIES`).
 	 */
 	static const QMap<QString, Data::Type> DATA_TYPES;
+
+	/**
+	 * The amount of bytes of a file held in memory at once while streaming it.
+	 */
+	static const size_t STREAMING_BUFFER_SIZE = 1 << 16;
 };
 
 #endif
@@ -0,0 +1,375 @@
+#include <Reader/DataReader/JsonStreamHandler.hpp>
+
+#include <Reader/DataReader/JsonReaderFactory.hpp>
+#include <Utils/Misc/MakeUnique.hpp>
+
+#include <cstring>
+
+JsonStreamHandler::ValueBuilder::ValueBuilder()
+	: buffer(new char[BUFFER_SIZE]), allocator(buffer.get(), BUFFER_SIZE) { }
+
+void JsonStreamHandler::ValueBuilder::reset() {
+	this->root.SetNull();
+	this->key.SetNull();
+	this->containers.clear();
+
+	// Frees all memory except for the buffer, which is reused by the next value
+	this->allocator.Clear();
+}
+
+void JsonStreamHandler::ValueBuilder::setKey(const char* str, rapidjson::SizeType length) {
+	this->key.SetString(str, length, this->allocator);
+}
+
+void JsonStreamHandler::ValueBuilder::add(rapidjson::Value& value) {
+	if (this->containers.empty()) {
+		this->root = value;
+	} else if (this->containers.back()->IsObject()) {
+		this->containers.back()->AddMember(this->key, value, this->allocator);
+	} else {
+		this->containers.back()->PushBack(value, this->allocator);
+	}
+}
+
+void JsonStreamHandler::ValueBuilder::addString(const char* str, rapidjson::SizeType length) {
+	rapidjson::Value value(str, length, this->allocator);
+	this->add(value);
+}
+
+void JsonStreamHandler::ValueBuilder::open(rapidjson::Type type) {
+	rapidjson::Value container(type);
+
+	if (this->containers.empty()) {
+		this->root = container;
+		this->containers.push_back(&this->root);
+		return;
+	}
+
+	// Remember the location of the container that has just been added. This stays valid while the
+	// container is open since its parent does not receive any new values in the meantime.
+	rapidjson::Value* parent = this->containers.back();
+	if (parent->IsObject()) {
+		parent->AddMember(this->key, container, this->allocator);
+		this->containers.push_back(&(parent->MemberEnd() - 1)->value);
+	} else {
+		parent->PushBack(container, this->allocator);
+		this->containers.push_back(&(*parent)[parent->Size() - 1]);
+	}
+}
+
+void JsonStreamHandler::ValueBuilder::close() {
+	this->containers.pop_back();
+}
+
+size_t JsonStreamHandler::ValueBuilder::getDepth() const {
+	return this->containers.size();
+}
+
+rapidjson::Value& JsonStreamHandler::ValueBuilder::getValue() {
+	return this->root;
+}
+
+JsonStreamHandler::JsonStreamHandler(QString path) : filePath(path), activeFrames(0),
+	target(NONE), rootRead(false), rootChildrenRead(false), metaDataMissing(false) { }
+
+bool JsonStreamHandler::isMetaDataMissing() const {
+	return this->metaDataMissing;
+}
+
+std::unique_ptr<JsonReader> JsonStreamHandler::takeReader() {
+	if (!this->rootRead) {
+		this->fail("The file does not contain a root data tag.");
+	}
+
+	if (!this->reader) {
+		this->fail("The file does not contain meta information.");
+	}
+
+	this->reader->finishIndexing();
+
+	return std::move(this->reader);
+}
+
+void JsonStreamHandler::fail(QString errorDescription) {
+	throw JsonReaderParseException(this->filePath, errorDescription);
+}
+
+JsonStreamHandler::ValueBuilder* JsonStreamHandler::getBuilder() {
+	if (this->scopes.empty()) {
+		return nullptr;
+	}
+
+	switch (this->scopes.back()) {
+	case META:
+		return &this->metaData;
+	case ELEMENT:
+		return &this->frames[this->activeFrames - 1]->builder;
+	default:
+		return nullptr;
+	}
+}
+
+bool JsonStreamHandler::beginValue(rapidjson::Type type) {
+	bool container = type == rapidjson::kObjectType || type == rapidjson::kArrayType;
+
+	if (this->scopes.empty()) {
+		if (type != rapidjson::kObjectType) {
+			this->fail("The file does not contain a root data tag.");
+		}
+
+		this->scopes.push_back(DOCUMENT);
+		return false;
+	}
+
+	switch (this->scopes.back()) {
+	case META:
+		return true;
+	case SKIPPED:
+		if (container) {
+			this->scopes.push_back(SKIPPED);
+		}
+		return false;
+	case CHILDREN: {
+		if (type != rapidjson::kObjectType) {
+			this->fail("Error in a data element: The data point is not a JSON object.");
+		}
+
+		// Start a new data element one level below the current one, reusing an old frame if possible
+		if (this->activeFrames == this->frames.size()) {
+			this->frames.push_back(makeUnique<ElementFrame>());
+		}
+
+		ElementFrame& frame = *this->frames[this->activeFrames];
+		frame.builder.reset();
+		frame.index = this->reader->reserveDataPoint();
+		this->activeFrames++;
+
+		this->scopes.push_back(ELEMENT);
+		return true;
+	}
+	default:
+		break;
+	}
+
+	// The handler is directly inside the document, the root tag or a data element
+	Target currentTarget = this->target;
+	this->target = NONE;
+
+	switch (currentTarget) {
+	case META_VALUE:
+		if (type != rapidjson::kObjectType) {
+			this->fail("The file does not contain meta information.");
+		}
+
+		this->metaData.reset();
+		this->scopes.push_back(META);
+		return true;
+	case ROOT_VALUE:
+		if (!this->reader) {
+			// The data type is unknown at this point, so the data elements cannot be read
+			this->metaDataMissing = true;
+			return false;
+		}
+
+		if (type != rapidjson::kObjectType) {
+			this->fail("The file is missing the children list that should be directly inside the "
+			           "root tag.");
+		}
+
+		this->scopes.push_back(ROOT);
+		return false;
+	case CHILDREN_VALUE:
+		if (this->scopes.back() == ROOT) {
+			if (type != rapidjson::kArrayType) {
+				this->fail("The file is missing the children list that should be directly inside "
+				           "the root tag.");
+			}
+
+			this->rootChildrenRead = true;
+			this->scopes.push_back(CHILDREN);
+			return false;
+		}
+
+		// The children of a data element are read as data elements of their own, so the element
+		// itself only receives an empty list to pass validation
+		this->getBuilder()->setKey("children", 8);
+		if (type == rapidjson::kArrayType) {
+			this->getBuilder()->open(rapidjson::kArrayType);
+			this->getBuilder()->close();
+			this->scopes.push_back(CHILDREN);
+			return false;
+		}
+		return true;
+	case SKIPPED_VALUE:
+		if (container) {
+			this->scopes.push_back(SKIPPED);
+		}
+		return false;
+	default:
+		// Values nested inside a data element's members
+		return this->scopes.back() == ELEMENT;
+	}
+}
+
+bool JsonStreamHandler::addValue(rapidjson::Value& value) {
+	if (this->beginValue(value.GetType())) {
+		this->getBuilder()->add(value);
+	}
+
+	return !this->metaDataMissing;
+}
+
+bool JsonStreamHandler::Null() {
+	rapidjson::Value value;
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::Bool(bool b) {
+	rapidjson::Value value(b);
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::Int(int i) {
+	rapidjson::Value value(i);
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::Uint(unsigned i) {
+	rapidjson::Value value(i);
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::Int64(int64_t i) {
+	rapidjson::Value value(i);
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::Uint64(uint64_t i) {
+	rapidjson::Value value(i);
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::Double(double d) {
+	rapidjson::Value value(d);
+	return this->addValue(value);
+}
+
+bool JsonStreamHandler::String(const char* str, rapidjson::SizeType length, bool) {
+	if (this->beginValue(rapidjson::kStringType)) {
+		this->getBuilder()->addString(str, length);
+	}
+
+	return !this->metaDataMissing;
+}
+
+bool JsonStreamHandler::StartObject() {
+	if (this->beginValue(rapidjson::kObjectType)) {
+		this->getBuilder()->open(rapidjson::kObjectType);
+	}
+
+	return !this->metaDataMissing;
+}
+
+bool JsonStreamHandler::StartArray() {
+	if (this->beginValue(rapidjson::kArrayType)) {
+		this->getBuilder()->open(rapidjson::kArrayType);
+	}
+
+	return !this->metaDataMissing;
+}
+
+bool JsonStreamHandler::Key(const char* str, rapidjson::SizeType length, bool) {
+	switch (this->scopes.back()) {
+	case DOCUMENT:
+		if (std::strcmp(str, "meta") == 0 && !this->reader) {
+			this->target = META_VALUE;
+		} else if (std::strcmp(str, "root") == 0 && !this->rootRead) {
+			this->target = ROOT_VALUE;
+		} else {
+			this->target = SKIPPED_VALUE;
+		}
+		break;
+	case ROOT:
+		this->target = std::strcmp(str, "children") == 0 && !this->rootChildrenRead
+		               ? CHILDREN_VALUE : SKIPPED_VALUE;
+		break;
+	case ELEMENT:
+		// Only the element's own list of children is handled separately, nested members are part
+		// of the element
+		if (this->getBuilder()->getDepth() == 1 && std::strcmp(str, "children") == 0) {
+			this->target = CHILDREN_VALUE;
+		} else {
+			this->getBuilder()->setKey(str, length);
+		}
+		break;
+	case META:
+		this->metaData.setKey(str, length);
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
+bool JsonStreamHandler::EndObject(rapidjson::SizeType) {
+	switch (this->scopes.back()) {
+	case META:
+		this->metaData.close();
+		if (this->metaData.getDepth() == 0) {
+			this->scopes.pop_back();
+			this->finishMetaData();
+		}
+		break;
+	case ELEMENT:
+		this->getBuilder()->close();
+		if (this->getBuilder()->getDepth() == 0) {
+			this->finishElement();
+		}
+		break;
+	case ROOT:
+		if (!this->rootChildrenRead) {
+			this->fail("The file is missing the children list that should be directly inside the "
+			           "root tag.");
+		}
+
+		this->rootRead = true;
+		this->scopes.pop_back();
+		break;
+	default:
+		this->scopes.pop_back();
+		break;
+	}
+
+	return true;
+}
+
+bool JsonStreamHandler::EndArray(rapidjson::SizeType) {
+	switch (this->scopes.back()) {
+	case META:
+	case ELEMENT:
+		this->getBuilder()->close();
+		break;
+	default:
+		this->scopes.pop_back();
+		break;
+	}
+
+	return true;
+}
+
+void JsonStreamHandler::finishMetaData() {
+	this->reader = JsonReaderFactory::createReaderFromMetaData(this->metaData.getValue(), nullptr,
+	               this->filePath);
+	this->metaData.reset();
+}
+
+void JsonStreamHandler::finishElement() {
+	ElementFrame& frame = *this->frames[this->activeFrames - 1];
+
+	// The depth of an element equals the amount of elements it is nested in
+	this->reader->indexDataPoint(frame.builder.getValue(), this->activeFrames - 1, frame.index);
+
+	this->activeFrames--;
+	this->scopes.pop_back();
+}
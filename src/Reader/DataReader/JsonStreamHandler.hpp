@@ -0,0 +1,235 @@
+#ifndef KRONOS_JSON_STREAM_HANDLER_HPP
+#define KRONOS_JSON_STREAM_HANDLER_HPP
+
+#include <QString>
+
+#include <Reader/DataReader/JsonReader.hpp>
+
+#include <rapidjson/reader.h>
+#include <rapidjson/document.h>
+
+#include <memory>
+#include <vector>
+
+/**
+ * SAX handler for rapidjson's `Reader` that turns a stream of JSON events into a `JsonReader`
+ * without ever holding the whole file in memory. Only the meta header and the data element that
+ * is currently being read (without its children) are kept as small JSON values, which are
+ * validated and converted into data points as soon as they are complete.
+ */
+class JsonStreamHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JsonStreamHandler> {
+public:
+	/**
+	 * Create a new handler for a file that is about to be streamed.
+	 * @param path The absolute file path of the file read to be used with error messages
+	 */
+	JsonStreamHandler(QString path);
+
+	/**
+	 * Check whether the data elements were encountered before the meta header. Streaming is
+	 * impossible in that case since the type of the data is unknown while the elements are read,
+	 * so the handler stops the parsing process and sets this flag instead.
+	 * @return True if the root data tag precedes the meta header in the file, false otherwise
+	 */
+	bool isMetaDataMissing() const;
+
+	/**
+	 * Get the reader created from the events received by this handler. To be called once the
+	 * parsing process finished successfully. Throws a `JsonReaderParseException` if the file
+	 * lacked the root data tag or the meta header.
+	 * @return A JSON reader holding all data points of the file
+	 */
+	std::unique_ptr<JsonReader> takeReader();
+
+	// Implementation of rapidjson's handler concept
+	bool Null();
+	bool Bool(bool b);
+	bool Int(int i);
+	bool Uint(unsigned i);
+	bool Int64(int64_t i);
+	bool Uint64(uint64_t i);
+	bool Double(double d);
+	bool String(const char* str, rapidjson::SizeType length, bool copy);
+	bool StartObject();
+	bool Key(const char* str, rapidjson::SizeType length, bool copy);
+	bool EndObject(rapidjson::SizeType memberCount);
+	bool StartArray();
+	bool EndArray(rapidjson::SizeType elementCount);
+
+private:
+	/**
+	 * Builds a single JSON value out of SAX events. The memory of the value is taken from a small
+	 * buffer that is reused after each `reset`, so building millions of elements does not require
+	 * any further allocations as long as each of them fits into the buffer.
+	 */
+	class ValueBuilder {
+	public:
+		ValueBuilder();
+
+		/**
+		 * Discard the value built so far and release its memory.
+		 */
+		void reset();
+
+		/**
+		 * Set the name of the member the next value will be added as.
+		 */
+		void setKey(const char* str, rapidjson::SizeType length);
+
+		/**
+		 * Add a primitive value to the innermost open container or make it the root value.
+		 */
+		void add(rapidjson::Value& value);
+
+		/**
+		 * Add a string value by copying it into the builder's memory.
+		 */
+		void addString(const char* str, rapidjson::SizeType length);
+
+		/**
+		 * Add an empty object or array and make it the innermost open container.
+		 */
+		void open(rapidjson::Type type);
+
+		/**
+		 * Close the innermost open container.
+		 */
+		void close();
+
+		/**
+		 * Get the amount of currently open containers.
+		 */
+		size_t getDepth() const;
+
+		/**
+		 * Get the value built so far.
+		 */
+		rapidjson::Value& getValue();
+
+	private:
+		static const size_t BUFFER_SIZE = 4096;
+
+		std::unique_ptr<char[]> buffer;
+		rapidjson::MemoryPoolAllocator<> allocator;
+		rapidjson::Value root;
+		rapidjson::Value key;
+		std::vector<rapidjson::Value*> containers;
+	};
+
+	/**
+	 * A data element that is currently being read.
+	 */
+	struct ElementFrame {
+		ValueBuilder builder;
+
+		/**
+		 * The place reserved for the element's data point in the reader.
+		 */
+		int index;
+	};
+
+	/**
+	 * Enum that denotes the structure of the file the handler is currently in.
+	 */
+	enum Scope {
+		DOCUMENT, META, ROOT, CHILDREN, ELEMENT, SKIPPED
+	};
+
+	/**
+	 * Enum that denotes what the value following the last key is used for.
+	 */
+	enum Target {
+		NONE, META_VALUE, ROOT_VALUE, CHILDREN_VALUE, SKIPPED_VALUE
+	};
+
+	/**
+	 * Handle the beginning of any value, which is either a primitive value or the start of an
+	 * object or array.
+	 * @param type The JSON type of the value
+	 * @return True if the value should be passed on to a value builder, false if it has been
+	 * consumed by the handler itself
+	 */
+	bool beginValue(rapidjson::Type type);
+
+	/**
+	 * Pass a primitive value on to the builder that is currently in use, if any.
+	 * @param value The value to be added
+	 * @return True since the parsing process should always continue
+	 */
+	bool addValue(rapidjson::Value& value);
+
+	/**
+	 * Get the builder that receives values at the handler's current position or a null pointer if
+	 * values should be discarded.
+	 */
+	ValueBuilder* getBuilder();
+
+	/**
+	 * Validate the meta header that has just been read and create the reader from it.
+	 */
+	void finishMetaData();
+
+	/**
+	 * Convert the innermost data element that has just been read into a data point.
+	 */
+	void finishElement();
+
+	/**
+	 * Throw an exception describing a structural error in the file.
+	 * @param errorDescription The description of the error
+	 */
+	void fail(QString errorDescription);
+
+	/**
+	 * The absolute path of the file read, used for error messages
+	 */
+	QString filePath;
+
+	/**
+	 * The reader that will hold all data points, created once the meta header has been read
+	 */
+	std::unique_ptr<JsonReader> reader;
+
+	/**
+	 * Builder used for the meta header
+	 */
+	ValueBuilder metaData;
+
+	/**
+	 * Builders for the data elements that are currently being read, one for each hierarchy level.
+	 * They are kept after use so their memory can be reused by the next element on the same level.
+	 */
+	std::vector<std::unique_ptr<ElementFrame>> frames;
+
+	/**
+	 * The amount of entries in `frames` that are currently in use
+	 */
+	size_t activeFrames;
+
+	/**
+	 * Stack of the nested structures the handler is currently in
+	 */
+	std::vector<Scope> scopes;
+
+	/**
+	 * What the value following the last key is used for
+	 */
+	Target target;
+
+	/**
+	 * Boolean flag denoting whether the root data tag has been read completely
+	 */
+	bool rootRead;
+
+	/**
+	 * Boolean flag denoting whether the root data tag contained a list of children
+	 */
+	bool rootChildrenRead;
+
+	/**
+	 * Boolean flag denoting whether the root data tag was encountered before the meta header
+	 */
+	bool metaDataMissing;
+};
+
+#endif
@@ -1,5 +1,13 @@
 #include <Reader/DataReader/JsonValidator.hpp>
 
+#include <Utils/Misc/Threads.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <vector>
+
 #define kJsonTypeNull 0
 #define kJsonTypeBoolean 1
 #define kJsonTypeObject 2
@@ -33,6 +41,74 @@ static QMap<QString, int> nonTemporalTagsMap() {
 }
 const QMap<QString, int> JsonValidator::NON_TEMPORAL_TAGS = nonTemporalTagsMap();
 
+// Validating a few top-level children is not worth starting threads for
+static const int MINIMUM_CHILDREN_PER_THREAD = 16;
+
+/**
+ * All tags that may be checked in a child element or in one of its position objects
+ */
+enum ChildTag {
+	TAG_TIMESTAMP, TAG_LONGITUDE, TAG_LATITUDE, TAG_CHILDREN, TAG_NAME, TAG_START_POSITION,
+	TAG_END_POSITION, TAG_AIRPORT_CODE, TAG_AIRLINE, TAG_AUTHOR, TAG_CONTENT,
+	TAG_NUMBER_OF_RETWEETS, TAG_PRECIPITATION_TYPE, TAG_PRECIPITATION_RATE, TAG_TEMPERATURE,
+	TAG_DIRECTION, TAG_SPEED, TAG_CLOUD_COVER, TAG_COUNT
+};
+
+/**
+ * The name of a tag along with its length, which is known at compile time.
+ */
+struct ChildTagName {
+	const char* name;
+	rapidjson::SizeType length;
+};
+
+#define KRONOS_CHILD_TAG_NAME(name) { name, sizeof(name) - 1 }
+
+static const ChildTagName CHILD_TAG_NAMES[TAG_COUNT] = {
+	KRONOS_CHILD_TAG_NAME("timestamp"), KRONOS_CHILD_TAG_NAME("longitude"),
+	KRONOS_CHILD_TAG_NAME("latitude"), KRONOS_CHILD_TAG_NAME("children"),
+	KRONOS_CHILD_TAG_NAME("name"), KRONOS_CHILD_TAG_NAME("startPosition"),
+	KRONOS_CHILD_TAG_NAME("endPosition"), KRONOS_CHILD_TAG_NAME("airportCode"),
+	KRONOS_CHILD_TAG_NAME("airline"), KRONOS_CHILD_TAG_NAME("author"),
+	KRONOS_CHILD_TAG_NAME("content"), KRONOS_CHILD_TAG_NAME("numberOfRetweets"),
+	KRONOS_CHILD_TAG_NAME("precipitationType"), KRONOS_CHILD_TAG_NAME("precipitationRate"),
+	KRONOS_CHILD_TAG_NAME("temperature"), KRONOS_CHILD_TAG_NAME("direction"),
+	KRONOS_CHILD_TAG_NAME("speed"), KRONOS_CHILD_TAG_NAME("cloudCover")
+};
+
+#undef KRONOS_CHILD_TAG_NAME
+
+/**
+ * Look up all known tags of a JSON object in a single pass over its members. Like rapidjson's own
+ * lookup, the first occurrence of a tag wins.
+ * @param jsonValue The object whose members are looked up
+ * @param members Receives the value of each tag in `ChildTag` order or a null pointer if the
+ * object does not have the tag
+ */
+static void resolveMembers(rapidjson::Value& jsonValue, rapidjson::Value* members[TAG_COUNT]) {
+	std::fill(members, members + TAG_COUNT, nullptr);
+
+	if (!jsonValue.IsObject()) {
+		return;
+	}
+
+	for (rapidjson::Value::MemberIterator member = jsonValue.MemberBegin();
+	        member != jsonValue.MemberEnd(); ++member) {
+		const char* name = member->name.GetString();
+		rapidjson::SizeType length = member->name.GetStringLength();
+
+		for (int tag = 0; tag < TAG_COUNT; tag++) {
+			if (CHILD_TAG_NAMES[tag].length == length
+			        && std::memcmp(CHILD_TAG_NAMES[tag].name, name, length) == 0) {
+				if (!members[tag]) {
+					members[tag] = &member->value;
+				}
+				break;
+			}
+		}
+	}
+}
+
 int JsonValidator::getType(rapidjson::Value& jsonValue) {
 	if (jsonValue.IsNull()) {
 		return kJsonTypeNull;
@@ -101,9 +177,9 @@ void JsonValidator::validateMetaData(rapidjson::Value& metaDocument, QString pat
 	}
 }
 
-void JsonValidator::checkChildTag(rapidjson::Value& jsonValue, QString memberName, int dataType,
-                                  QString path) {
-	if (!jsonValue.HasMember(memberName.toStdString().c_str())) {
+void JsonValidator::checkChildTag(rapidjson::Value* memberValue, const char* memberName,
+                                  int dataType, QString path) {
+	if (!memberValue) {
 		throw JsonReaderParseException(
 		    path,
 		    QString("Error in a data element: The data point is missing its \"%1\" tag.")
@@ -111,7 +187,7 @@ void JsonValidator::checkChildTag(rapidjson::Value& jsonValue, QString memberNam
 		);
 	}
 
-	int actualDataType = JsonValidator::getType(jsonValue[memberName.toStdString().c_str()]);
+	int actualDataType = JsonValidator::getType(*memberValue);
 	bool expectedEqualsActual = false;
 
 	if (dataType == kJsonTypeDouble) {
@@ -134,9 +210,7 @@ void JsonValidator::checkChildTag(rapidjson::Value& jsonValue, QString memberNam
 		    .arg(
 		        memberName,
 		        JsonValidator::TYPE_NAMES.value(dataType),
-		        JsonValidator::TYPE_NAMES.value(
-		            JsonValidator::getType(jsonValue[memberName.toStdString().c_str()])
-		        )
+		        JsonValidator::TYPE_NAMES.value(actualDataType)
 		    )
 		);
 	}
@@ -144,8 +218,23 @@ void JsonValidator::checkChildTag(rapidjson::Value& jsonValue, QString memberNam
 
 void JsonValidator::validateChildElement(rapidjson::Value& childDocument, Data::Type dataType,
         QString path) {
+	JsonValidator::validateElement(childDocument, dataType, path);
+}
+
+rapidjson::Value& JsonValidator::validateElement(rapidjson::Value& childDocument,
+        Data::Type dataType, QString path) {
+	if (!childDocument.IsObject()) {
+		throw JsonReaderParseException(
+		    path,
+		    QString("Error in a data element: The data point is not an object.")
+		);
+	}
+
+	rapidjson::Value* members[TAG_COUNT];
+	resolveMembers(childDocument, members);
+
 	if (Data::isTemporal(dataType)) {
-		if (!childDocument.HasMember("timestamp")) {
+		if (!members[TAG_TIMESTAMP]) {
 			throw JsonReaderParseException(
 			    path,
 			    QString("Error in a data element: The data point is temporal but does not contain "
@@ -153,14 +242,14 @@ void JsonValidator::validateChildElement(rapidjson::Value& childDocument, Data::
 			);
 		}
 
-		if (JsonValidator::getType(childDocument["timestamp"]) != kJsonTypeInteger) {
+		if (JsonValidator::getType(*members[TAG_TIMESTAMP]) != kJsonTypeInteger) {
 			throw JsonReaderParseException(
 			    path,
 			    QString("Error in a data element: The tag \"timestamp\" should be of type "
 			            "Integer but is of type %1.")
 			    .arg(
 			        JsonValidator::TYPE_NAMES.value(
-			            JsonValidator::getType(childDocument["timestamp"])
+			            JsonValidator::getType(*members[TAG_TIMESTAMP])
 			        )
 			    )
 			);
@@ -168,7 +257,7 @@ void JsonValidator::validateChildElement(rapidjson::Value& childDocument, Data::
 	}
 
 	if (dataType != Data::FLIGHTS) {
-		if (!childDocument.HasMember("longitude") || !childDocument.HasMember("latitude")) {
+		if (!members[TAG_LONGITUDE] || !members[TAG_LATITUDE]) {
 			throw JsonReaderParseException(
 			    path,
 			    QString("Error in a data element: The data point is missing its \"longitude\" or "
@@ -176,8 +265,8 @@ void JsonValidator::validateChildElement(rapidjson::Value& childDocument, Data::
 			);
 		}
 
-		if (JsonValidator::getType(childDocument["longitude"]) != kJsonTypeDouble ||
-		        JsonValidator::getType(childDocument["latitude"]) != kJsonTypeDouble) {
+		if (JsonValidator::getType(*members[TAG_LONGITUDE]) != kJsonTypeDouble ||
+		        JsonValidator::getType(*members[TAG_LATITUDE]) != kJsonTypeDouble) {
 			throw JsonReaderParseException(
 			    path,
 			    QString("Error in a data element: The tags \"longitude\" and \"latitude\" should "
@@ -186,48 +275,137 @@ void JsonValidator::validateChildElement(rapidjson::Value& childDocument, Data::
 		}
 	}
 
-	JsonValidator::checkChildTag(childDocument, "children", kJsonTypeArray, path);
+	JsonValidator::checkChildTag(members[TAG_CHILDREN], "children", kJsonTypeArray, path);
 
 	switch (dataType) {
 	case Data::CITIES: {
-		JsonValidator::checkChildTag(childDocument, "name", kJsonTypeString, path);
+		JsonValidator::checkChildTag(members[TAG_NAME], "name", kJsonTypeString, path);
 		break;
 	}
 	case Data::FLIGHTS: {
-		JsonValidator::checkChildTag(childDocument, "startPosition", kJsonTypeObject, path);
-		JsonValidator::checkChildTag(childDocument, "endPosition", kJsonTypeObject, path);
-		JsonValidator::checkChildTag(childDocument["startPosition"], "latitude", kJsonTypeDouble, path);
-		JsonValidator::checkChildTag(childDocument["startPosition"], "longitude", kJsonTypeDouble, path);
-		JsonValidator::checkChildTag(childDocument["endPosition"], "latitude", kJsonTypeDouble, path);
-		JsonValidator::checkChildTag(childDocument["endPosition"], "longitude", kJsonTypeDouble, path);
-		JsonValidator::checkChildTag(childDocument["startPosition"], "airportCode", kJsonTypeString, path);
-		JsonValidator::checkChildTag(childDocument["endPosition"], "airportCode", kJsonTypeString, path);
-		JsonValidator::checkChildTag(childDocument, "airline", kJsonTypeString, path);
+		JsonValidator::checkChildTag(members[TAG_START_POSITION], "startPosition", kJsonTypeObject,
+		                             path);
+		JsonValidator::checkChildTag(members[TAG_END_POSITION], "endPosition", kJsonTypeObject,
+		                             path);
+
+		rapidjson::Value* startMembers[TAG_COUNT];
+		rapidjson::Value* endMembers[TAG_COUNT];
+		resolveMembers(*members[TAG_START_POSITION], startMembers);
+		resolveMembers(*members[TAG_END_POSITION], endMembers);
+
+		JsonValidator::checkChildTag(startMembers[TAG_LATITUDE], "latitude", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(startMembers[TAG_LONGITUDE], "longitude", kJsonTypeDouble,
+		                             path);
+		JsonValidator::checkChildTag(endMembers[TAG_LATITUDE], "latitude", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(endMembers[TAG_LONGITUDE], "longitude", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(startMembers[TAG_AIRPORT_CODE], "airportCode",
+		                             kJsonTypeString, path);
+		JsonValidator::checkChildTag(endMembers[TAG_AIRPORT_CODE], "airportCode", kJsonTypeString,
+		                             path);
+		JsonValidator::checkChildTag(members[TAG_AIRLINE], "airline", kJsonTypeString, path);
 		break;
 	}
 	case Data::TWEETS: {
-		JsonValidator::checkChildTag(childDocument, "author", kJsonTypeString, path);
-		JsonValidator::checkChildTag(childDocument, "content", kJsonTypeString, path);
-		JsonValidator::checkChildTag(childDocument, "numberOfRetweets", kJsonTypeInteger, path);
+		JsonValidator::checkChildTag(members[TAG_AUTHOR], "author", kJsonTypeString, path);
+		JsonValidator::checkChildTag(members[TAG_CONTENT], "content", kJsonTypeString, path);
+		JsonValidator::checkChildTag(members[TAG_NUMBER_OF_RETWEETS], "numberOfRetweets",
+		                             kJsonTypeInteger, path);
 		break;
 	}
 	case Data::PRECIPITATION: {
-		JsonValidator::checkChildTag(childDocument, "precipitationType", kJsonTypeString, path);
-		JsonValidator::checkChildTag(childDocument, "precipitationRate", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(members[TAG_PRECIPITATION_TYPE], "precipitationType",
+		                             kJsonTypeString, path);
+		JsonValidator::checkChildTag(members[TAG_PRECIPITATION_RATE], "precipitationRate",
+		                             kJsonTypeDouble, path);
 		break;
 	}
 	case Data::TEMPERATURE: {
-		JsonValidator::checkChildTag(childDocument, "temperature", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(members[TAG_TEMPERATURE], "temperature", kJsonTypeDouble,
+		                             path);
 		break;
 	}
 	case Data::WIND: {
-		JsonValidator::checkChildTag(childDocument, "direction", kJsonTypeDouble, path);
-		JsonValidator::checkChildTag(childDocument, "speed", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(members[TAG_DIRECTION], "direction", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(members[TAG_SPEED], "speed", kJsonTypeDouble, path);
 		break;
 	}
 	case Data::CLOUD_COVERAGE: {
-		JsonValidator::checkChildTag(childDocument, "cloudCover", kJsonTypeDouble, path);
+		JsonValidator::checkChildTag(members[TAG_CLOUD_COVER], "cloudCover", kJsonTypeDouble,
+		                             path);
 		break;
 	}
 	}
-}
\ No newline at end of file
+
+	return *members[TAG_CHILDREN];
+}
+
+void JsonValidator::validateSubtree(rapidjson::Value& childDocument, Data::Type dataType,
+                                    QString path) {
+	std::vector<rapidjson::Value*> pending;
+	pending.push_back(&childDocument);
+
+	while (!pending.empty()) {
+		rapidjson::Value* element = pending.back();
+		pending.pop_back();
+
+		rapidjson::Value& children = JsonValidator::validateElement(*element, dataType, path);
+
+		// Push the children in reverse so that they are checked in document order
+		for (rapidjson::SizeType i = children.Size(); i > 0; i--) {
+			pending.push_back(&children[i - 1]);
+		}
+	}
+}
+
+void JsonValidator::validateChildElements(rapidjson::Value& children, Data::Type dataType,
+        QString path) {
+	if (!children.IsArray()) {
+		throw JsonReaderParseException(
+		    path,
+		    QString("The children list directly inside the root tag should be of type Array.")
+		);
+	}
+
+	rapidjson::SizeType amountOfChildren = children.Size();
+	int amountOfThreads = Threads::getAmountOfThreads(amountOfChildren,
+	                      MINIMUM_CHILDREN_PER_THREAD);
+
+	if (amountOfThreads <= 1) {
+		for (rapidjson::SizeType i = 0; i < amountOfChildren; i++) {
+			JsonValidator::validateSubtree(children[i], dataType, path);
+		}
+		return;
+	}
+
+	// Subtrees differ greatly in size, so the threads take one top-level child at a time. Only the
+	// error of the first invalid child in document order is kept, independent of thread timing.
+	std::atomic<rapidjson::SizeType> nextChild(0);
+	std::atomic<rapidjson::SizeType> errorChild(amountOfChildren);
+	std::exception_ptr error;
+	std::mutex errorMutex;
+
+	Threads::run(amountOfThreads, [&](int) {
+		while (true) {
+			rapidjson::SizeType child = nextChild++;
+			// Children after an invalid one cannot change the reported error
+			if (child >= errorChild) {
+				return;
+			}
+
+			try {
+				JsonValidator::validateSubtree(children[child], dataType, path);
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (child < errorChild) {
+					error = std::current_exception();
+					errorChild = child;
+				}
+				return;
+			}
+		}
+	});
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
@@ -31,7 +31,37 @@ public:
 	 */
 	static void validateChildElement(rapidjson::Value& childDocument, Data::Type dataType,
 	                                 QString path);
+
+	/**
+	 * Check a whole list of child elements including all of their descendants, throw a
+	 * `JsonReaderParseException` if any of them is invalid. The hierarchy is traversed without
+	 * recursion and the subtrees of the given elements are checked in parallel.
+	 * @param children The JSON array holding the child elements to be checked
+	 * @param dataType The data type the JSON elements should be checked for
+	 * @param path The file path so it can be included in the exception description
+	 */
+	static void validateChildElements(rapidjson::Value& children, Data::Type dataType,
+	                                  QString path);
 private:
+	/**
+	 * Check a single child element as described for `validateChildElement`.
+	 * @param childDocument The JSON document to be checked
+	 * @param dataType The data type the JSON document should be checked for
+	 * @param path The file path so it can be included in the exception description
+	 * @return The element's list of children
+	 */
+	static rapidjson::Value& validateElement(rapidjson::Value& childDocument, Data::Type dataType,
+	        QString path);
+
+	/**
+	 * Check a child element and all of its descendants one after another.
+	 * @param childDocument The JSON document at the root of the subtree to be checked
+	 * @param dataType The data type the JSON documents should be checked for
+	 * @param path The file path so it can be included in the exception description
+	 */
+	static void validateSubtree(rapidjson::Value& childDocument, Data::Type dataType,
+	                            QString path);
+
 	/**
 	 * Get the type of a JSON value in integer notation.
 	 * @param jsonValue The value to be checked
@@ -41,12 +71,12 @@ private:
 
 	/**
 	 * Check a tag of a child element for existence and JSON data type.
-	 * @param jsonValue The child element to be checked
+	 * @param memberValue The value of the tag or a null pointer if the element does not have it
 	 * @param memberName The name of the tag to be checked for
 	 * @param The JSON data type the member should be of, refer to `JsonValidator::TYPE_NAMES`
 	 * @param path The file path so it can be included in the exception description
 	 */
-	static void checkChildTag(rapidjson::Value& jsonValue, QString memberName, int dataType,
+	static void checkChildTag(rapidjson::Value* memberValue, const char* memberName, int dataType,
 	                          QString path);
 
 	/**
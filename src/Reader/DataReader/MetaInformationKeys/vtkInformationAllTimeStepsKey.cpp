@@ -0,0 +1,19 @@
+#include <Reader/DataReader/MetaInformationKeys/vtkInformationAllTimeStepsKey.hpp>
+
+#include <vtkDataObject.h>
+#include <vtkInformation.h>
+
+vtkInformationAllTimeStepsKey::vtkInformationAllTimeStepsKey(const char* name,
+        const char* location) : vtkInformationIntegerKey(name, location) { }
+
+vtkInformationAllTimeStepsKey::~vtkInformationAllTimeStepsKey() { }
+
+bool vtkInformationAllTimeStepsKey::NeedToExecute(vtkInformation* pipelineInfo,
+        vtkInformation* dobjInfo) {
+	return pipelineInfo->Has(this) && pipelineInfo->Get(this) != 0
+	       && dobjInfo->Has(vtkDataObject::DATA_TIME_STEP());
+}
+
+void vtkInformationAllTimeStepsKey::PrintSelf(ostream& os, vtkIndent indent) {
+	this->Superclass::PrintSelf(os, indent);
+}
@@ -0,0 +1,36 @@
+#ifndef KRONOS_VTK_INFORMATION_ALL_TIME_STEPS_KEY_HPP
+#define KRONOS_VTK_INFORMATION_ALL_TIME_STEPS_KEY_HPP
+
+#include <vtkCommonExecutionModelModule.h>
+#include <vtkInformationIntegerKey.h>
+#include <vtkCommonInformationKeyManager.h>
+
+/**
+ * A key set in the update request to a Kronos reader to receive the data points of all time steps
+ * at once. Unlike a plain integer key, it makes the pipeline run the reader again if its current
+ * output only holds a single time step.
+ * This class needs to have this name to work with VTK's information key macro.
+ */
+class vtkInformationAllTimeStepsKey : public vtkInformationIntegerKey {
+public:
+	vtkTypeMacro(vtkInformationAllTimeStepsKey, vtkInformationIntegerKey)
+	void PrintSelf(ostream& os, vtkIndent indent);
+
+	vtkInformationAllTimeStepsKey(const char* name, const char* location);
+	~vtkInformationAllTimeStepsKey();
+
+	/**
+	 * Check whether the data object needs to be produced anew for the request.
+	 * @param pipelineInfo The output information holding the request
+	 * @param dobjInfo The information of the current data object
+	 * @return True if all time steps are requested but the data object is marked with a single
+	 * time step, false otherwise
+	 */
+	virtual bool NeedToExecute(vtkInformation* pipelineInfo, vtkInformation* dobjInfo);
+
+private:
+	vtkInformationAllTimeStepsKey(const vtkInformationAllTimeStepsKey&); // Not implemented.
+	void operator=(const vtkInformationAllTimeStepsKey&); // Not implemented.
+};
+
+#endif // KRONOS_VTK_INFORMATION_ALL_TIME_STEPS_KEY_HPP
@@ -0,0 +1,88 @@
+#include <Reader/DataReader/PointDataIndex.hpp>
+
+#include <algorithm>
+
+PointDataIndex::PointDataIndex() { }
+
+int64_t PointDataIndex::makeKey(int timeStep, int priority) {
+	// Priorities are never negative, so they fit into the lower 32 bits of the key
+	return (int64_t) timeStep * ((int64_t) 1 << 32) + priority;
+}
+
+void PointDataIndex::build(const PointDataSet& points, int startTime, int timeResolution) {
+	const std::vector<int>& priorities = points.getPriorities();
+	const std::vector<int>& timestamps = points.getTimestamps();
+	bool temporal = Data::isTemporal(points.getDataType());
+
+	// Compute each point's key once instead of in every comparison while sorting
+	std::vector<int64_t> keys(points.size());
+	for (int i = 0; i < points.size(); i++) {
+		int timeStep = 0;
+		if (temporal && timeResolution > 0) {
+			timeStep = (timestamps[i] - startTime) / timeResolution;
+		}
+		keys[i] = PointDataIndex::makeKey(timeStep, priorities[i]);
+	}
+
+	this->slices.resize(points.size());
+	for (int i = 0; i < points.size(); i++) {
+		this->slices[i] = i;
+	}
+	std::stable_sort(this->slices.begin(), this->slices.end(), [&keys](int a, int b) {
+		return keys[a] < keys[b];
+	});
+
+	this->sliceKeys.resize(points.size());
+	for (int i = 0; i < points.size(); i++) {
+		this->sliceKeys[i] = keys[this->slices[i]];
+	}
+
+	this->priorityOrder.clear();
+	this->priorityKeys.clear();
+
+	if (temporal) {
+		this->priorityOrder.resize(points.size());
+		for (int i = 0; i < points.size(); i++) {
+			this->priorityOrder[i] = i;
+		}
+		std::stable_sort(this->priorityOrder.begin(), this->priorityOrder.end(),
+		[&priorities](int a, int b) {
+			return priorities[a] < priorities[b];
+		});
+
+		this->priorityKeys.resize(points.size());
+		for (int i = 0; i < points.size(); i++) {
+			this->priorityKeys[i] = priorities[this->priorityOrder[i]];
+		}
+	}
+}
+
+std::vector<int> PointDataIndex::getSlice(int zoomLevel) const {
+	if (this->priorityOrder.empty()) {
+		// All points share the same time step, so the slice is a prefix of the main order
+		return this->getSlice(zoomLevel, 0);
+	}
+
+	size_t end = std::upper_bound(this->priorityKeys.begin(), this->priorityKeys.end(), zoomLevel)
+	             - this->priorityKeys.begin();
+
+	return PointDataIndex::copyRange(this->priorityOrder, 0, end);
+}
+
+std::vector<int> PointDataIndex::getSlice(int zoomLevel, int timeStep) const {
+	if (zoomLevel < 0) {
+		return std::vector<int>();
+	}
+
+	size_t begin = std::lower_bound(this->sliceKeys.begin(), this->sliceKeys.end(),
+	                                PointDataIndex::makeKey(timeStep, 0)) - this->sliceKeys.begin();
+	size_t end = std::upper_bound(this->sliceKeys.begin() + begin, this->sliceKeys.end(),
+	                              PointDataIndex::makeKey(timeStep, zoomLevel)) - this->sliceKeys.begin();
+
+	return PointDataIndex::copyRange(this->slices, begin, end);
+}
+
+std::vector<int> PointDataIndex::copyRange(const std::vector<int>& order, size_t begin,
+        size_t end) {
+	return std::vector<int>(order.begin() + begin, order.begin() + end);
+}
@@ -0,0 +1,87 @@
+#ifndef KRONOS_POINTDATAINDEX_HPP
+#define KRONOS_POINTDATAINDEX_HPP
+
+#include <Reader/DataReader/PointDataSet.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/**
+* Sorted index over the data points of a `PointDataSet` that allows retrieving all points
+* relevant to a zoom level and time step without looking at any other point. The indices of the
+* data points are ordered by time step first and priority second, so each such slice is a
+* contiguous range that is found using two binary searches.
+*/
+class PointDataIndex {
+
+	friend class BinarySnapshot;
+
+public:
+	/**
+	 * Create a new, empty index. Use `build` to fill it.
+	 */
+	PointDataIndex();
+
+	/**
+	 * Sort all data points of a set into this index, replacing any previous content. The order of
+	 * data points sharing the same time step and priority is kept.
+	 * @param points The data points to be indexed
+	 * @param startTime Timestamp of the earliest data point, only used for temporal data
+	 * @param timeResolution Amount of seconds a single time step contains, only used for temporal
+	 * data
+	 */
+	void build(const PointDataSet& points, int startTime, int timeResolution);
+
+	/**
+	 * Get all data points relevant to a zoom level regardless of their time information, ordered
+	 * by priority.
+	 * @param zoomLevel The current zoom level
+	 * @return The indices of all data points with a priority not higher than the zoom level
+	 */
+	std::vector<int> getSlice(int zoomLevel) const;
+
+	/**
+	 * Get all temporal data points relevant to a zoom level and time step, ordered by priority.
+	 * @param zoomLevel The current zoom level
+	 * @param timeStep The current time step
+	 * @return The indices of all data points in the time step with a priority not higher than the
+	 * zoom level
+	 */
+	std::vector<int> getSlice(int zoomLevel, int timeStep) const;
+
+private:
+	/**
+	 * Combine a time step and a priority into a single key whose natural order equals the order of
+	 * this index.
+	 */
+	static int64_t makeKey(int timeStep, int priority);
+
+	/**
+	 * Copy a range of the given order into a new list of data point indices.
+	 */
+	static std::vector<int> copyRange(const std::vector<int>& order, size_t begin, size_t end);
+
+	/**
+	 * Data point indices ordered by time step and priority
+	 */
+	std::vector<int> slices;
+
+	/**
+	 * The key of each entry in `slices` in the same order
+	 */
+	std::vector<int64_t> sliceKeys;
+
+	/**
+	 * Data point indices ordered by priority only. Left empty for non-temporal data, where all
+	 * points share a single time step and `slices` already has this order.
+	 */
+	std::vector<int> priorityOrder;
+
+	/**
+	 * The priority of each entry in `priorityOrder` in the same order
+	 */
+	std::vector<int> priorityKeys;
+
+};
+
+#endif
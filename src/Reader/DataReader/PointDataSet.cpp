@@ -1,15 +1,260 @@
 #include "PointDataSet.hpp"
 
-PointDataSet::PointDataSet() {
-	points = QList<DataPoint*>();
+/**
+ * Check whether all IDs of a column refer to an entry of a dictionary.
+ * @param ids The column of IDs
+ * @param dictionary The dictionary the IDs refer to
+ * @return True if all IDs are valid, false otherwise
+ */
+static bool areValidIds(const std::vector<int>& ids, const StringDictionary& dictionary) {
+	for (size_t i = 0; i < ids.size(); i++) {
+		if (ids[i] < 0 || ids[i] >= dictionary.size()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+PointDataSet::PointDataSet(Data::Type dataType) : dataType(dataType) { }
+
+Data::Type PointDataSet::getDataType() const {
+	return this->dataType;
+}
+
+int PointDataSet::size() const {
+	return this->longitudes.size();
+}
+
+bool PointDataSet::isConsistent() const {
+	size_t size = this->longitudes.size();
+
+	if (this->latitudes.size() != size || this->priorities.size() != size) {
+		return false;
+	}
+
+	if (Data::isTemporal(this->dataType) && this->timestamps.size() != size) {
+		return false;
+	}
+
+	switch (this->dataType) {
+	case Data::CITIES:
+		return this->names.size() == size;
+	case Data::FLIGHTS:
+		return this->destinationLongitudes.size() == size
+		       && this->destinationLatitudes.size() == size
+		       && this->airlineIds.size() == size
+		       && this->originAirportCodeIds.size() == size
+		       && this->destinationAirportCodeIds.size() == size
+		       && this->flightLengths.size() == size
+		       && areValidIds(this->airlineIds, this->airlineDictionary)
+		       && areValidIds(this->originAirportCodeIds, this->airportCodeDictionary)
+		       && areValidIds(this->destinationAirportCodeIds, this->airportCodeDictionary);
+	case Data::TWEETS:
+		return this->authorIds.size() == size
+		       && this->contents.size() == size
+		       && this->numberOfRetweets.size() == size
+		       && areValidIds(this->authorIds, this->authorDictionary);
+	case Data::PRECIPITATION:
+		return this->precipitationRates.size() == size
+		       && this->precipitationTypes.size() == size;
+	case Data::TEMPERATURE:
+		return this->temperatures.size() == size;
+	case Data::WIND:
+		return this->directions.size() == size && this->speeds.size() == size;
+	case Data::CLOUD_COVERAGE:
+		return this->cloudCovers.size() == size;
+	}
+
+	return false;
+}
+
+int PointDataSet::reservePoint() {
+	this->longitudes.push_back(0);
+	this->latitudes.push_back(0);
+	this->priorities.push_back(0);
+
+	if (Data::isTemporal(this->dataType)) {
+		this->timestamps.push_back(0);
+	}
+
+	// Only grow the columns relevant to this set's data type. IDs stay invalid until the point's
+	// strings are stored, so that no empty string ends up in the dictionaries.
+	switch (this->dataType) {
+	case Data::CITIES:
+		this->names.push_back(std::string());
+		break;
+	case Data::FLIGHTS:
+		this->destinationLongitudes.push_back(0);
+		this->destinationLatitudes.push_back(0);
+		this->airlineIds.push_back(-1);
+		this->originAirportCodeIds.push_back(-1);
+		this->destinationAirportCodeIds.push_back(-1);
+		this->flightLengths.push_back(0);
+		break;
+	case Data::TWEETS:
+		this->authorIds.push_back(-1);
+		this->contents.push_back(std::string());
+		this->numberOfRetweets.push_back(0);
+		break;
+	case Data::PRECIPITATION:
+		this->precipitationRates.push_back(0);
+		this->precipitationTypes.push_back(0);
+		break;
+	case Data::TEMPERATURE:
+		this->temperatures.push_back(0);
+		break;
+	case Data::WIND:
+		this->directions.push_back(0);
+		this->speeds.push_back(0);
+		break;
+	case Data::CLOUD_COVERAGE:
+		this->cloudCovers.push_back(0);
+		break;
+	}
+
+	return this->longitudes.size() - 1;
+}
+
+void PointDataSet::setPoint(int index, double longitude, double latitude, int priority) {
+	this->longitudes[index] = longitude;
+	this->latitudes[index] = latitude;
+	this->priorities[index] = priority;
 }
 
-void PointDataSet::addPoint(DataPoint* datapoint) {
-	points.append(datapoint);
+void PointDataSet::setTimestamp(int index, int timestamp) {
+	this->timestamps[index] = timestamp;
 }
 
-QList<DataPoint*> PointDataSet::getDataPoints() {
-	return this->points;
+void PointDataSet::setCity(int index, const std::string& name) {
+	this->names[index] = name;
 }
 
+void PointDataSet::setFlight(int index, double destinationLongitude, double destinationLatitude,
+                             const std::string& airline, const std::string& originAirportCode,
+                             const std::string& destinationAirportCode, float flightLength) {
+	this->destinationLongitudes[index] = destinationLongitude;
+	this->destinationLatitudes[index] = destinationLatitude;
+	this->airlineIds[index] = this->airlineDictionary.intern(airline);
+	this->originAirportCodeIds[index] = this->airportCodeDictionary.intern(originAirportCode);
+	this->destinationAirportCodeIds[index] = this->airportCodeDictionary.intern(
+	            destinationAirportCode);
+	this->flightLengths[index] = flightLength;
+}
+
+void PointDataSet::setTweet(int index, const std::string& author, const std::string& content,
+                            int numberOfRetweets) {
+	this->authorIds[index] = this->authorDictionary.intern(author);
+	this->contents[index] = content;
+	this->numberOfRetweets[index] = numberOfRetweets;
+}
+
+void PointDataSet::setPrecipitation(int index, float precipitationRate, int precipitationType) {
+	this->precipitationRates[index] = precipitationRate;
+	this->precipitationTypes[index] = precipitationType;
+}
+
+void PointDataSet::setTemperature(int index, float temperature) {
+	this->temperatures[index] = temperature;
+}
+
+void PointDataSet::setWind(int index, float direction, float speed) {
+	this->directions[index] = direction;
+	this->speeds[index] = speed;
+}
+
+void PointDataSet::setCloudCover(int index, float cloudCover) {
+	this->cloudCovers[index] = cloudCover;
+}
+
+const std::vector<float>& PointDataSet::getLongitudes() const {
+	return this->longitudes;
+}
+
+const std::vector<float>& PointDataSet::getLatitudes() const {
+	return this->latitudes;
+}
+
+const std::vector<int>& PointDataSet::getPriorities() const {
+	return this->priorities;
+}
+
+const std::vector<int>& PointDataSet::getTimestamps() const {
+	return this->timestamps;
+}
 
+const std::vector<std::string>& PointDataSet::getNames() const {
+	return this->names;
+}
+
+const std::vector<float>& PointDataSet::getDestinationLongitudes() const {
+	return this->destinationLongitudes;
+}
+
+const std::vector<float>& PointDataSet::getDestinationLatitudes() const {
+	return this->destinationLatitudes;
+}
+
+const std::vector<int>& PointDataSet::getAirlineIds() const {
+	return this->airlineIds;
+}
+
+const std::vector<int>& PointDataSet::getOriginAirportCodeIds() const {
+	return this->originAirportCodeIds;
+}
+
+const std::vector<int>& PointDataSet::getDestinationAirportCodeIds() const {
+	return this->destinationAirportCodeIds;
+}
+
+const std::vector<float>& PointDataSet::getFlightLengths() const {
+	return this->flightLengths;
+}
+
+const StringDictionary& PointDataSet::getAirlineDictionary() const {
+	return this->airlineDictionary;
+}
+
+const StringDictionary& PointDataSet::getAirportCodeDictionary() const {
+	return this->airportCodeDictionary;
+}
+
+const std::vector<int>& PointDataSet::getAuthorIds() const {
+	return this->authorIds;
+}
+
+const std::vector<std::string>& PointDataSet::getContents() const {
+	return this->contents;
+}
+
+const std::vector<int>& PointDataSet::getNumberOfRetweets() const {
+	return this->numberOfRetweets;
+}
+
+const StringDictionary& PointDataSet::getAuthorDictionary() const {
+	return this->authorDictionary;
+}
+
+const std::vector<float>& PointDataSet::getPrecipitationRates() const {
+	return this->precipitationRates;
+}
+
+const std::vector<int>& PointDataSet::getPrecipitationTypes() const {
+	return this->precipitationTypes;
+}
+
+const std::vector<float>& PointDataSet::getTemperatures() const {
+	return this->temperatures;
+}
+
+const std::vector<float>& PointDataSet::getDirections() const {
+	return this->directions;
+}
+
+const std::vector<float>& PointDataSet::getSpeeds() const {
+	return this->speeds;
+}
+
+const std::vector<float>& PointDataSet::getCloudCovers() const {
+	return this->cloudCovers;
+}
@@ -1,35 +1,215 @@
 #ifndef KRONOS_POINTDATASET_HPP
 #define KRONOS_POINTDATASET_HPP
 
-#include <QList>
-#include <Reader/DataReader/DataPoints/DataPoint.hpp>
+#include <Reader/DataReader/Data.hpp>
+#include <Reader/DataReader/StringDictionary.hpp>
+
+#include <string>
+#include <vector>
 
 /**
-* Stores a set of data points of one type in a list
+* Stores a set of data points of one type as a struct of arrays. Each piece of information a data
+* point holds is kept in its own contiguous column, with the i-th entry of every column belonging
+* to the i-th data point. Only the columns relevant to the set's data type are filled, all other
+* columns stay empty.
+*
+* Airlines, airport codes and tweet authors repeat a lot, so their columns hold IDs into a
+* `StringDictionary` instead of the strings themselves. Origin and destination airport codes share
+* a single dictionary.
 */
 class PointDataSet {
 
+	friend class BinarySnapshot;
+
 public:
 	/**
 	 * Create a new PointDataSet which will store a set of points.
+	 * @param dataType The type of the data points this set will store
+	 */
+	PointDataSet(Data::Type dataType = Data::CITIES);
+
+	/**
+	 * Get the type of the data points in this set.
+	 * @return The type of the data points in this set
+	 */
+	Data::Type getDataType() const;
+
+	/**
+	 * Get the amount of data points in this set.
+	 * @return The amount of data points in this set
+	 */
+	int size() const;
+
+	/**
+	 * Check whether every column relevant to this set's data type holds exactly one entry for each
+	 * data point and every interned ID refers to an entry of its dictionary.
+	 * @return True if all relevant columns have the same size and valid IDs, false otherwise
+	 */
+	bool isConsistent() const;
+
+	/**
+	 * Append a new data point with default values to this set. Its values are filled in later on
+	 * using the setters of this class. This keeps the order of the set intact when a point is only
+	 * known completely after some of its successors. The point's string IDs are -1 until its
+	 * strings are set.
+	 * @return The index of the new data point
 	 */
-	PointDataSet();
+	int reservePoint();
 
 	/**
-	 * Add a new point of data to this set.
-	 * @param dataPoint A pointer to the data point to be added
+	 * Set the information all data points have in common.
+	 * @param index The index of the data point
+	 * @param longitude The point's longitude
+	 * @param latitude The point's latitude
+	 * @param priority The point's zoom level priority
 	 */
-	void addPoint(DataPoint* dataPoint);
+	void setPoint(int index, double longitude, double latitude, int priority);
 
 	/**
-	 * Get a list of all data points in this set.
-	 * @return A list of data point pointers this set stores
+	 * Set the timestamp of a temporal data point.
+	 * @param index The index of the data point
+	 * @param timestamp The point's timestamp in UNIX GMT format
 	 */
-	QList<DataPoint*> getDataPoints();
+	void setTimestamp(int index, int timestamp);
+
+	/**
+	 * Set the information specific to a city data point.
+	 * @param index The index of the data point
+	 * @param name The city's name
+	 */
+	void setCity(int index, const std::string& name);
+
+	/**
+	 * Set the information specific to a flight data point.
+	 * @param index The index of the data point
+	 * @param destinationLongitude The longitude of the flight's destination
+	 * @param destinationLatitude The latitude of the flight's destination
+	 * @param airline The name of the airline operating this flight
+	 * @param originAirportCode The code of the airport that is the origin of this flight
+	 * @param destinationAirportCode The code of the airport that is the destination of this flight
+	 * @param flightLength The length of this flight in kilometres
+	 */
+	void setFlight(int index, double destinationLongitude, double destinationLatitude,
+	               const std::string& airline, const std::string& originAirportCode,
+	               const std::string& destinationAirportCode, float flightLength);
+
+	/**
+	 * Set the information specific to a tweet data point.
+	 * @param index The index of the data point
+	 * @param author The tweet's author
+	 * @param content The tweet's content
+	 * @param numberOfRetweets The number of retweets for this tweet
+	 */
+	void setTweet(int index, const std::string& author, const std::string& content,
+	              int numberOfRetweets);
+
+	/**
+	 * Set the information specific to a precipitation data point.
+	 * @param index The index of the data point
+	 * @param precipitationRate The point's precipitation rate
+	 * @param precipitationType The point's precipitation type as defined in
+	 * `Data::PrecipitationType`
+	 */
+	void setPrecipitation(int index, float precipitationRate, int precipitationType);
+
+	/**
+	 * Set the information specific to a temperature data point.
+	 * @param index The index of the data point
+	 * @param temperature The point's temperature
+	 */
+	void setTemperature(int index, float temperature);
+
+	/**
+	 * Set the information specific to a wind data point.
+	 * @param index The index of the data point
+	 * @param direction The point's wind direction
+	 * @param speed The point's wind speed
+	 */
+	void setWind(int index, float direction, float speed);
+
+	/**
+	 * Set the information specific to a cloud coverage data point.
+	 * @param index The index of the data point
+	 * @param cloudCover The point's cloud coverage
+	 */
+	void setCloudCover(int index, float cloudCover);
+
+	// Columns all data types have in common
+	const std::vector<float>& getLongitudes() const;
+	const std::vector<float>& getLatitudes() const;
+	const std::vector<int>& getPriorities() const;
+
+	// Column of temporal data types
+	const std::vector<int>& getTimestamps() const;
+
+	// Columns of city data
+	const std::vector<std::string>& getNames() const;
+
+	// Columns of flight data
+	const std::vector<float>& getDestinationLongitudes() const;
+	const std::vector<float>& getDestinationLatitudes() const;
+	const std::vector<int>& getAirlineIds() const;
+	const std::vector<int>& getOriginAirportCodeIds() const;
+	const std::vector<int>& getDestinationAirportCodeIds() const;
+	const std::vector<float>& getFlightLengths() const;
+	const StringDictionary& getAirlineDictionary() const;
+	const StringDictionary& getAirportCodeDictionary() const;
+
+	// Columns of tweet data
+	const std::vector<int>& getAuthorIds() const;
+	const std::vector<std::string>& getContents() const;
+	const std::vector<int>& getNumberOfRetweets() const;
+	const StringDictionary& getAuthorDictionary() const;
+
+	// Columns of precipitation data
+	const std::vector<float>& getPrecipitationRates() const;
+	const std::vector<int>& getPrecipitationTypes() const;
+
+	// Column of temperature data
+	const std::vector<float>& getTemperatures() const;
+
+	// Columns of wind data
+	const std::vector<float>& getDirections() const;
+	const std::vector<float>& getSpeeds() const;
+
+	// Column of cloud coverage data
+	const std::vector<float>& getCloudCovers() const;
 
 private:
-	QList<DataPoint*> points;
+	Data::Type dataType;
+
+	std::vector<float> longitudes;
+	std::vector<float> latitudes;
+	std::vector<int> priorities;
+
+	std::vector<int> timestamps;
+
+	std::vector<std::string> names;
+
+	std::vector<float> destinationLongitudes;
+	std::vector<float> destinationLatitudes;
+	std::vector<int> airlineIds;
+	std::vector<int> originAirportCodeIds;
+	std::vector<int> destinationAirportCodeIds;
+	std::vector<float> flightLengths;
+	StringDictionary airlineDictionary;
+	StringDictionary airportCodeDictionary;
+
+	std::vector<int> authorIds;
+	std::vector<std::string> contents;
+	std::vector<int> numberOfRetweets;
+	StringDictionary authorDictionary;
+
+	std::vector<float> precipitationRates;
+	std::vector<int> precipitationTypes;
+
+	std::vector<float> temperatures;
+
+	std::vector<float> directions;
+	std::vector<float> speeds;
+
+	std::vector<float> cloudCovers;
 
 };
 
-#endif
\ No newline at end of file
+#endif
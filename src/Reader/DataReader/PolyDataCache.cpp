@@ -0,0 +1,115 @@
+#include <Reader/DataReader/PolyDataCache.hpp>
+
+PolyDataCache::PolyDataCache(size_t budget) : budget(budget), size(0) { }
+
+PolyDataCache::Key PolyDataCache::makeKey(int zoomLevel, int time, bool temporal) {
+	return Key(temporal, zoomLevel, temporal ? time : 0);
+}
+
+vtkSmartPointer<vtkPolyData> PolyDataCache::get(int zoomLevel, int time, bool temporal) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	std::map<Key, std::list<Entry>::iterator>::iterator position = this->positions.find(
+	            PolyDataCache::makeKey(zoomLevel, time, temporal)
+	        );
+	if (position == this->positions.end()) {
+		return nullptr;
+	}
+
+	// Never hand out a slice a consumer has written to
+	if (position->second->dataSet->GetMTime() != position->second->modifiedTime) {
+		this->remove(position);
+		return nullptr;
+	}
+
+	// Move the slice to the front of the eviction order
+	this->entries.splice(this->entries.begin(), this->entries, position->second);
+
+	return position->second->dataSet;
+}
+
+bool PolyDataCache::contains(int zoomLevel, int time, bool temporal) const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	return this->positions.count(PolyDataCache::makeKey(zoomLevel, time, temporal)) > 0;
+}
+
+bool PolyDataCache::put(int zoomLevel, int time, bool temporal,
+                        vtkSmartPointer<vtkPolyData> dataSet) {
+	// vtkPolyData reports its memory size in kibibytes
+	size_t dataSetSize = (size_t) dataSet->GetActualMemorySize() * 1024;
+	Key key = PolyDataCache::makeKey(zoomLevel, time, temporal);
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	// Replace a slice that another thread may have cached in the meantime
+	std::map<Key, std::list<Entry>::iterator>::iterator position = this->positions.find(key);
+	if (position != this->positions.end()) {
+		this->remove(position);
+	}
+
+	if (dataSetSize > this->budget) {
+		return false;
+	}
+
+	Entry entry;
+	entry.key = key;
+	entry.dataSet = dataSet;
+	entry.size = dataSetSize;
+	entry.modifiedTime = dataSet->GetMTime();
+
+	this->entries.push_front(entry);
+	this->positions[key] = this->entries.begin();
+	this->size += dataSetSize;
+
+	return !this->evict();
+}
+
+void PolyDataCache::clear() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	this->entries.clear();
+	this->positions.clear();
+	this->size = 0;
+}
+
+void PolyDataCache::setBudget(size_t budget) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	this->budget = budget;
+	this->evict();
+}
+
+size_t PolyDataCache::getBudget() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	return this->budget;
+}
+
+size_t PolyDataCache::getSize() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	return this->size;
+}
+
+void PolyDataCache::remove(std::map<Key, std::list<Entry>::iterator>::iterator position) {
+	this->size -= position->second->size;
+	this->entries.erase(position->second);
+	this->positions.erase(position);
+}
+
+bool PolyDataCache::evict() {
+	bool evicted = false;
+
+	while (this->size > this->budget && !this->entries.empty()) {
+		Entry& leastRecentlyUsed = this->entries.back();
+
+		this->size -= leastRecentlyUsed.size;
+		this->positions.erase(leastRecentlyUsed.key);
+		this->entries.pop_back();
+
+		evicted = true;
+	}
+
+	return evicted;
+}
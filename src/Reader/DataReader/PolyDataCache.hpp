@@ -0,0 +1,145 @@
+#ifndef KRONOS_POLYDATACACHE_HPP
+#define KRONOS_POLYDATACACHE_HPP
+
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+/**
+* Thread-safe cache for the vtkPolyData slices created by a `JsonReader`. Each slice is identified
+* by its zoom level and time step. The cache holds at most a fixed amount of bytes and evicts the
+* least recently used slices once this budget is exceeded.
+*
+* Cached slices are handed out without being copied, so their arrays end up shared with the
+* outputs of the pipeline. Consumers have to copy a slice before modifying it. As a safeguard, a
+* slice whose modification time has changed since it was cached is treated as missing, so the
+* reader builds a fresh one instead of handing out modified data.
+*/
+class PolyDataCache {
+
+public:
+	/**
+	 * Create a new, empty cache.
+	 * @param budget The maximum amount of bytes the cached slices may occupy
+	 */
+	PolyDataCache(size_t budget);
+
+	/**
+	 * Retrieve a slice from the cache and mark it as the most recently used one. Slices that have
+	 * been modified since they were cached are removed instead.
+	 * @param zoomLevel The zoom level of the slice
+	 * @param time The time step of the slice, ignored for non-temporal slices
+	 * @param temporal True if the slice is restricted to a time step, false otherwise
+	 * @return The cached slice or a null pointer if it has not been cached
+	 */
+	vtkSmartPointer<vtkPolyData> get(int zoomLevel, int time, bool temporal);
+
+	/**
+	 * Check whether a slice is cached without changing its position in the eviction order.
+	 * @param zoomLevel The zoom level of the slice
+	 * @param time The time step of the slice, ignored for non-temporal slices
+	 * @param temporal True if the slice is restricted to a time step, false otherwise
+	 * @return True if the slice is cached, false otherwise
+	 */
+	bool contains(int zoomLevel, int time, bool temporal) const;
+
+	/**
+	 * Add a slice to the cache as the most recently used one, replacing a slice with the same key.
+	 * Slices larger than the whole budget are not cached at all.
+	 * @param zoomLevel The zoom level of the slice
+	 * @param time The time step of the slice, ignored for non-temporal slices
+	 * @param temporal True if the slice is restricted to a time step, false otherwise
+	 * @param dataSet The slice to be cached
+	 * @return True if the slice fit into the budget without evicting other slices, false otherwise
+	 */
+	bool put(int zoomLevel, int time, bool temporal, vtkSmartPointer<vtkPolyData> dataSet);
+
+	/**
+	 * Remove all slices from the cache.
+	 */
+	void clear();
+
+	/**
+	 * Change the maximum amount of bytes the cached slices may occupy, evicting slices if needed.
+	 * @param budget The new budget in bytes
+	 */
+	void setBudget(size_t budget);
+
+	/**
+	 * Get the maximum amount of bytes the cached slices may occupy.
+	 * @return The budget in bytes
+	 */
+	size_t getBudget() const;
+
+	/**
+	 * Get the amount of bytes the cached slices currently occupy.
+	 * @return The size of all cached slices in bytes
+	 */
+	size_t getSize() const;
+
+private:
+	typedef std::tuple<bool, int, int> Key;
+
+	/**
+	 * A cached slice together with its key and size
+	 */
+	struct Entry {
+		Key key;
+		vtkSmartPointer<vtkPolyData> dataSet;
+		size_t size;
+
+		/**
+		 * The slice's modification time when it was cached
+		 */
+		unsigned long modifiedTime;
+	};
+
+	/**
+	 * Build the key of a slice. Non-temporal slices share the time step 0.
+	 */
+	static Key makeKey(int zoomLevel, int time, bool temporal);
+
+	/**
+	 * Remove a single slice. The mutex has to be held.
+	 */
+	void remove(std::map<Key, std::list<Entry>::iterator>::iterator position);
+
+	/**
+	 * Remove least recently used slices until the budget is met. The mutex has to be held.
+	 * @return True if at least one slice has been removed, false otherwise
+	 */
+	bool evict();
+
+	/**
+	 * All cached slices, ordered from the most to the least recently used one
+	 */
+	std::list<Entry> entries;
+
+	/**
+	 * The position of each cached slice in `entries`
+	 */
+	std::map<Key, std::list<Entry>::iterator> positions;
+
+	/**
+	 * The maximum amount of bytes the cached slices may occupy
+	 */
+	size_t budget;
+
+	/**
+	 * The amount of bytes the cached slices currently occupy
+	 */
+	size_t size;
+
+	/**
+	 * Guards all members since slices are cached and retrieved from several threads
+	 */
+	mutable std::mutex mutex;
+
+};
+
+#endif
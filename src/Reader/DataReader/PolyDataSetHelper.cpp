@@ -1,468 +1,337 @@
 #include <Reader/DataReader/PolyDataSetHelper.hpp>
 
-#include <vtkDataArray.h>
 #include <vtkPointData.h>
-#include <vtkPointSource.h>
-#include <vtkDataArray.h>
+#include <vtkFieldData.h>
 #include <vtkStringArray.h>
 #include <vtkIntArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkFloatArray.h>
 #include <vtkDoubleArray.h>
 #include <vtkPoints.h>
 #include <vtkCellArray.h>
 
-#include <Reader/DataReader/DataPoints/NonTemporalDataPoints/CityDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/NonTemporalDataPoints/FlightDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/TemperatureDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/TweetDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/WindDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/CloudCoverageDataPoint.hpp>
-
-#include <math.h>
-#include <iostream>
-
 #include <Utils/Config/Configuration.hpp>
-#include <Utils/Math/Functions.hpp>
 
-vtkSmartPointer<vtkPolyData> PolyDataSetHelper::getPolyDataFromDataPoints(
-    PointDataSet dataPoints,
-    int zoomLevel,
-    Data::Type dataType
-) {
-	return PolyDataSetHelper::getPolyDataFromDataPoints(
-	           dataPoints,
-	           zoomLevel,
-	           dataType,
-	           0,
-	           0,
-	           0,
-	           false
-	       );
-}
+/**
+ * Create a single-component array holding the values of a column for the given data points.
+ * The values are written directly into the array's memory.
+ * @param name The name of the array
+ * @param column The column the values are taken from
+ * @param indices The indices of the data points whose values should be put into the array
+ * @return The new array with one tuple for each index
+ */
+template<typename ArrayType, typename ValueType>
+static vtkSmartPointer<ArrayType> gatherColumn(const char* name,
+        const std::vector<ValueType>& column, const std::vector<int>& indices) {
+	vtkSmartPointer<ArrayType> array = vtkSmartPointer<ArrayType>::New();
+	array->SetName(name);
+	array->SetNumberOfComponents(1);
+	array->SetNumberOfTuples(indices.size());
+
+	typename ArrayType::ValueType* values = array->GetPointer(0);
+	for (size_t i = 0; i < indices.size(); i++) {
+		values[i] = column[indices[i]];
+	}
 
-vtkSmartPointer<vtkPolyData> PolyDataSetHelper::getPolyDataFromDataPoints(
-    PointDataSet dataPoints,
-    int zoomLevel,
-    Data::Type dataType,
-    int timeResolution,
-    int timeStep,
-    int startTime
-) {
-	return PolyDataSetHelper::getPolyDataFromDataPoints(
-	           dataPoints,
-	           zoomLevel,
-	           dataType,
-	           timeResolution,
-	           timeStep,
-	           startTime,
-	           true
-	       );
+	return array;
 }
 
-vtkSmartPointer<vtkPolyData> PolyDataSetHelper::getPolyDataFromDataPoints(
-    PointDataSet dataPoints,
-    int zoomLevel,
-    Data::Type dataType,
-    int timeResolution,
-    int timeStep,
-    int startTime,
-    bool temporal
-) {
-	QList<DataPoint*> relevantDataPoints;
-
-	if (temporal) {
-		relevantDataPoints = PolyDataSetHelper::extractRelevantDataPoints(
-		                         dataPoints,
-		                         zoomLevel,
-		                         timeResolution,
-		                         timeStep,
-		                         startTime
-		                     );
-	} else {
-		relevantDataPoints = PolyDataSetHelper::extractRelevantDataPoints(
-		                         dataPoints,
-		                         zoomLevel
-		                     );
+/**
+ * Create a string array holding the values of a column for the given data points.
+ * @param name The name of the array
+ * @param column The column the values are taken from
+ * @param indices The indices of the data points whose values should be put into the array
+ * @return The new array with one value for each index
+ */
+static vtkSmartPointer<vtkStringArray> gatherStringColumn(const char* name,
+        const std::vector<std::string>& column, const std::vector<int>& indices) {
+	vtkSmartPointer<vtkStringArray> array = vtkSmartPointer<vtkStringArray>::New();
+	array->SetName(name);
+	array->SetNumberOfComponents(1);
+	array->SetNumberOfValues(indices.size());
+
+	for (size_t i = 0; i < indices.size(); i++) {
+		array->SetValue(i, column[indices[i]]);
 	}
 
-	return PolyDataSetHelper::createPolyDataSet(
-	           relevantDataPoints, dataType
-	       );
+	return array;
 }
 
-QList<DataPoint*> PolyDataSetHelper::extractRelevantDataPoints(
-    PointDataSet points,
-    int zoomLevel
-) {
-	QList<DataPoint*> relevantDataPoints = QList<DataPoint*>();
+/**
+ * Translates the global IDs of interned strings into IDs that are only valid within a single data
+ * set. The strings used by the data set are collected in a dictionary array which is added to the
+ * data set's field data, so only the strings actually present in the data set are copied.
+ */
+class SliceDictionary {
+public:
+	/**
+	 * @param name The name of the dictionary array
+	 * @param dictionary The dictionary holding the global IDs
+	 */
+	SliceDictionary(const char* name, const StringDictionary& dictionary)
+		: dictionary(dictionary), localIds(dictionary.size(), -1),
+		  strings(vtkSmartPointer<vtkStringArray>::New()) {
+		this->strings->SetName(name);
+	}
 
-	for (int i = 0; i < points.getDataPoints().size(); i++) {
-		DataPoint* point = points.getDataPoints().at(i);
-		if (point->getPriority() <= zoomLevel) {
-			relevantDataPoints.append(point);
+	/**
+	 * Create an array holding the local IDs of a column's values for the given data points.
+	 * @param name The name of the array
+	 * @param column The column of global IDs the values are taken from
+	 * @param indices The indices of the data points whose values should be put into the array
+	 * @return The new array with one ID for each index
+	 */
+	vtkSmartPointer<vtkIntArray> gatherIds(const char* name, const std::vector<int>& column,
+	                                       const std::vector<int>& indices) {
+		vtkSmartPointer<vtkIntArray> array = vtkSmartPointer<vtkIntArray>::New();
+		array->SetName(name);
+		array->SetNumberOfComponents(1);
+		array->SetNumberOfTuples(indices.size());
+
+		int* values = array->GetPointer(0);
+		for (size_t i = 0; i < indices.size(); i++) {
+			int id = column[indices[i]];
+			if (this->localIds[id] < 0) {
+				this->localIds[id] = this->strings->InsertNextValue(this->dictionary.getString(id));
+			}
+			values[i] = this->localIds[id];
 		}
-	}
 
-	return relevantDataPoints;
-}
+		return array;
+	}
 
-QList<DataPoint*> PolyDataSetHelper::extractRelevantDataPoints(
-    PointDataSet points,
-    int zoomLevel,
-    int timeResolution,
-    int timeStep,
-    int startTime
-) {
-	QList<DataPoint*> relevantDataPoints = QList<DataPoint*>();
+	/**
+	 * Create a string array holding the values of a column for the given data points.
+	 * @param name The name of the array
+	 * @param column The column of global IDs the values are taken from
+	 * @param indices The indices of the data points whose values should be put into the array
+	 * @return The new array with one value for each index
+	 */
+	vtkSmartPointer<vtkStringArray> gatherStrings(const char* name, const std::vector<int>& column,
+	        const std::vector<int>& indices) const {
+		vtkSmartPointer<vtkStringArray> array = vtkSmartPointer<vtkStringArray>::New();
+		array->SetName(name);
+		array->SetNumberOfComponents(1);
+		array->SetNumberOfValues(indices.size());
+
+		for (size_t i = 0; i < indices.size(); i++) {
+			array->SetValue(i, this->dictionary.getString(column[indices[i]]));
+		}
 
-	int timeSpanStart = startTime + (timeStep * timeResolution);
-	int timeSpanEnd = timeSpanStart + timeResolution;
+		return array;
+	}
 
-	for (int i = 0; i < points.getDataPoints().size(); i++) {
-		DataPoint* point = points.getDataPoints().at(i);
+	/**
+	 * Get the array of all strings referenced by the local IDs handed out so far.
+	 * @return The dictionary array, the position of each string being its local ID
+	 */
+	vtkSmartPointer<vtkStringArray> getStrings() const {
+		return this->strings;
+	}
 
-		if (point->getPriority() <= zoomLevel) {
-			const TemporalDataPoint* dataPoint
-			    = dynamic_cast<const TemporalDataPoint*>(point);
+private:
+	const StringDictionary& dictionary;
+	std::vector<int> localIds;
+	vtkSmartPointer<vtkStringArray> strings;
+};
 
-			if (
-			    dataPoint->getTimestamp() >= timeSpanStart &&
-			    dataPoint->getTimestamp() < timeSpanEnd
-			) {
-				relevantDataPoints.append(point);
-			}
-		}
-	}
+vtkSmartPointer<vtkPolyData> PolyDataSetHelper::getPolyDataFromDataPoints(
+    const PointDataSet& dataPoints,
+    const PointDataIndex& index,
+    int zoomLevel,
+    Data::Type dataType
+) {
+	return PolyDataSetHelper::createPolyDataSet(
+	           dataPoints, index.getSlice(zoomLevel), dataType
+	       );
+}
 
-	return relevantDataPoints;
+vtkSmartPointer<vtkPolyData> PolyDataSetHelper::getPolyDataFromDataPoints(
+    const PointDataSet& dataPoints,
+    const PointDataIndex& index,
+    int zoomLevel,
+    Data::Type dataType,
+    int timeStep
+) {
+	return PolyDataSetHelper::createPolyDataSet(
+	           dataPoints, index.getSlice(zoomLevel, timeStep), dataType
+	       );
 }
 
 vtkSmartPointer<vtkPolyData> PolyDataSetHelper::createPolyDataSet(
-    QList<DataPoint*> relevantDataPoints,
+    const PointDataSet& dataPoints,
+    const std::vector<int>& relevantDataPoints,
     Data::Type dataType
 ) {
-	// Create an empty data set and a point array the data set will contain
+	vtkIdType numberOfPoints = relevantDataPoints.size();
+
+	// Read the configuration once instead of for every data point
+	int maximumPriority = Configuration::getInstance().getInteger("dataReader.maximumPriority");
+
+	// Create an empty data set and a point array of the final size the data set will contain
 	vtkSmartPointer<vtkPolyData> dataSet = vtkSmartPointer<vtkPolyData>::New();
 	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+	points->SetDataTypeToFloat();
+	points->SetNumberOfPoints(numberOfPoints);
+
+	// Write each point's longitude, latitude and a height of zero directly into the point array
+	float* coordinates = vtkFloatArray::SafeDownCast(points->GetData())->GetPointer(0);
+	const std::vector<float>& longitudes = dataPoints.getLongitudes();
+	const std::vector<float>& latitudes = dataPoints.getLatitudes();
+
+	for (vtkIdType i = 0; i < numberOfPoints; i++) {
+		coordinates[3 * i] = longitudes[relevantDataPoints[i]];
+		coordinates[3 * i + 1] = latitudes[relevantDataPoints[i]];
+		coordinates[3 * i + 2] = 0;
+	}
 
-	// Check whether the data type is time-sensitive
-	bool temporal = Data::isTemporal(dataType);
+	// Create a single vert cell containing all points, stored as the amount of points followed by
+	// their indices
+	vtkSmartPointer<vtkIdTypeArray> connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+	connectivity->SetNumberOfValues(numberOfPoints + 1);
 
-	// Create an empty vert data set
-	vtkCellArray* verts = vtkCellArray::New();
+	vtkIdType* pointIds = connectivity->GetPointer(0);
+	pointIds[0] = numberOfPoints;
+	for (vtkIdType i = 0; i < numberOfPoints; i++) {
+		pointIds[i + 1] = i;
+	}
 
-	// Add a cell containing all points
-	verts->Allocate(verts->EstimateSize(1, relevantDataPoints.size()));
-	verts->InsertNextCell(relevantDataPoints.size());
+	vtkSmartPointer<vtkCellArray> verts = vtkSmartPointer<vtkCellArray>::New();
+	verts->SetCells(1, connectivity);
 
-	// Create some data arrays all temporal data sets have in common. The timestamp array will not
-	// be used if the data set is non-temporal.
-	vtkIdType numberOfTuples[1];
-	numberOfTuples[0] = relevantDataPoints.size();
+	// Assign points and vertices to the output data set
+	dataSet->SetPoints(points);
+	dataSet->SetVerts(verts);
 
 	// An integer array containing the priority of each data point. This is added as a convenience
 	// measure for potentially using it later on with `vtkPointSetToLabelHierarchy`.
 	vtkSmartPointer<vtkIntArray> priorities = vtkSmartPointer<vtkIntArray>::New();
 	priorities->SetName("priorities");
 	priorities->SetNumberOfComponents(1);
-	priorities->SetNumberOfTuples(*numberOfTuples);
-
-	// An integer array containing the timestamp of each data point. 32-bit integers are sufficient
-	// since UNIX timestamps are being used.
-	vtkSmartPointer<vtkIntArray> timestamps = vtkSmartPointer<vtkIntArray>::New();
-	timestamps->SetName("timestamps");
-	timestamps->SetNumberOfComponents(1);
-	timestamps->SetNumberOfTuples(*numberOfTuples);
-
-	// The current tuple index in the iteration
-	int tupleNumber = 0;
-
-	// Iterate through all relevant data points, add their coordinates as new points and fill the
-	// array of priority values.
-	for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-	        iterator != relevantDataPoints.end(); ++iterator) {
-		// Insert the new point with its longitude, latitude and a height of zero
-		// and add point to verts
-		verts->InsertCellPoint(points->InsertNextPoint(
-		                           (*iterator)->getCoordinate().lon(),
-		                           (*iterator)->getCoordinate().lat(),
-		                           0
-		                       ));
-
-		// Invert the priority before adding it since with `vtkPointSetToLabelHierarchy`,
-		// higher priority values are more visible, which is the other way around than
-		// the definition in these `DataReader` classes.
-		double priority[1] = {
-			(double) Configuration::getInstance().getInteger("dataReader.maximumPriority")
-			- (*iterator)->getPriority()
-		};
-		priorities->SetTuple(tupleNumber, priority);
-
-		// Add timestamps if they exist
-		if (temporal) {
-			const TemporalDataPoint* temporalDataPoint = dynamic_cast<const TemporalDataPoint*>(
-			            (*iterator)
-			        );
-
-			double timestamp[1] = {
-				(double) temporalDataPoint->getTimestamp()
-			};
-			timestamps->SetTuple(tupleNumber, timestamp);
-		}
+	priorities->SetNumberOfTuples(numberOfPoints);
 
-		tupleNumber++;
-	}
+	// Invert the priority before adding it since with `vtkPointSetToLabelHierarchy`, higher
+	// priority values are more visible, which is the other way around than the definition in
+	// these `DataReader` classes.
+	int* priorityValues = priorities->GetPointer(0);
+	const std::vector<int>& priorityColumn = dataPoints.getPriorities();
 
-	// Assign points and vertices to the output data set
-	dataSet->GetPoints();
-	dataSet->SetPoints(points);
-	dataSet->SetVerts(verts);
+	for (vtkIdType i = 0; i < numberOfPoints; i++) {
+		priorityValues[i] = maximumPriority - priorityColumn[relevantDataPoints[i]];
+	}
 
 	// Add relevant data arrays depending on the data type
 	switch (dataType) {
 	case Data::CITIES: {
-		vtkSmartPointer<vtkStringArray> cityNames = vtkSmartPointer<vtkStringArray>::New();
-		cityNames->SetNumberOfComponents(relevantDataPoints.size());
-		cityNames->SetName("names");
-
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const CityDataPoint* dataPoint = dynamic_cast<const CityDataPoint*>(
-			                                     (*iterator)
-			                                 );
-
-			cityNames->InsertNextValue(dataPoint->getName().toStdString());
-		}
-
-
-
-		dataSet->GetPointData()->AddArray(cityNames);
+		dataSet->GetPointData()->AddArray(gatherStringColumn(
+		                                      "names", dataPoints.getNames(), relevantDataPoints));
 		break;
 	}
 
 	case Data::FLIGHTS: {
-		vtkSmartPointer<vtkStringArray> airlines = vtkSmartPointer<vtkStringArray>::New();
-		airlines->SetNumberOfComponents(relevantDataPoints.size());
-		airlines->SetName("airlines");
-
-		vtkSmartPointer<vtkStringArray> originAirportCodes = vtkSmartPointer<vtkStringArray>::New();
-		originAirportCodes->SetNumberOfComponents(relevantDataPoints.size());
-		originAirportCodes->SetName("originAirportCodes");
-
-		vtkSmartPointer<vtkStringArray> destinationAirportCodes = vtkSmartPointer<vtkStringArray>::New();
-		destinationAirportCodes->SetNumberOfComponents(relevantDataPoints.size());
-		destinationAirportCodes->SetName("destinationAirportCodes");
-
-		vtkSmartPointer<vtkFloatArray> flightLengths
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		flightLengths->SetNumberOfComponents(1);
-		flightLengths->SetNumberOfTuples(relevantDataPoints.size());
-		flightLengths->SetName("flightLengths");
-
 		vtkSmartPointer<vtkDoubleArray> destinations = vtkSmartPointer<vtkDoubleArray>::New();
-		vtkIdType numberOfTuples[1];
-		numberOfTuples[0] = relevantDataPoints.size();
 		destinations->SetNumberOfComponents(2);
-		destinations->SetNumberOfTuples(*numberOfTuples);
+		destinations->SetNumberOfTuples(numberOfPoints);
 		destinations->SetName("destinations");
 
-		int tupleNumber = 0;
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const FlightDataPoint* dataPoint = dynamic_cast<const FlightDataPoint*>(
-			                                       (*iterator)
-			                                   );
-
-			// Insert the new destination as a new tuple of latitude and longitude
-			double coordinates[2] = {
-				dataPoint->getDestination().lon(),
-				dataPoint->getDestination().lat()
-			};
-			destinations->SetTuple(tupleNumber, coordinates);
-
-			double flightLength[1] = {
-				(double) dataPoint->getFlightLength()
-			};
-			flightLengths->SetTuple(tupleNumber, flightLength);
-
-			airlines->InsertNextValue(dataPoint->getAirlineName().toStdString());
-			originAirportCodes->InsertNextValue(dataPoint->getOriginAirportCode().toStdString());
-			destinationAirportCodes->InsertNextValue(dataPoint->getDestinationAirportCode().toStdString());
-
-			tupleNumber++;
+		// Insert each destination as a tuple of longitude and latitude
+		double* destinationValues = destinations->GetPointer(0);
+		const std::vector<float>& destinationLongitudes = dataPoints.getDestinationLongitudes();
+		const std::vector<float>& destinationLatitudes = dataPoints.getDestinationLatitudes();
+
+		for (vtkIdType i = 0; i < numberOfPoints; i++) {
+			destinationValues[2 * i] = destinationLongitudes[relevantDataPoints[i]];
+			destinationValues[2 * i + 1] = destinationLatitudes[relevantDataPoints[i]];
 		}
 
 		dataSet->GetPointData()->AddArray(destinations);
-		dataSet->GetPointData()->AddArray(airlines);
-		dataSet->GetPointData()->AddArray(originAirportCodes);
-		dataSet->GetPointData()->AddArray(destinationAirportCodes);
-		dataSet->GetPointData()->AddArray(flightLengths);
-
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkFloatArray>(
+		                                      "flightLengths", dataPoints.getFlightLengths(),
+		                                      relevantDataPoints));
+
+		// Add the interned strings both as readable values and as IDs for quick filtering
+		SliceDictionary airlines("airlineDictionary", dataPoints.getAirlineDictionary());
+		SliceDictionary airportCodes("airportCodeDictionary", dataPoints.getAirportCodeDictionary());
+
+		dataSet->GetPointData()->AddArray(airlines.gatherStrings(
+		                                      "airlines", dataPoints.getAirlineIds(), relevantDataPoints));
+		dataSet->GetPointData()->AddArray(airportCodes.gatherStrings(
+		                                      "originAirportCodes", dataPoints.getOriginAirportCodeIds(),
+		                                      relevantDataPoints));
+		dataSet->GetPointData()->AddArray(airportCodes.gatherStrings(
+		                                      "destinationAirportCodes",
+		                                      dataPoints.getDestinationAirportCodeIds(),
+		                                      relevantDataPoints));
+		dataSet->GetPointData()->AddArray(airlines.gatherIds(
+		                                      "airlineIds", dataPoints.getAirlineIds(), relevantDataPoints));
+		dataSet->GetPointData()->AddArray(airportCodes.gatherIds(
+		                                      "originAirportCodeIds", dataPoints.getOriginAirportCodeIds(),
+		                                      relevantDataPoints));
+		dataSet->GetPointData()->AddArray(airportCodes.gatherIds(
+		                                      "destinationAirportCodeIds",
+		                                      dataPoints.getDestinationAirportCodeIds(),
+		                                      relevantDataPoints));
+		dataSet->GetFieldData()->AddArray(airlines.getStrings());
+		dataSet->GetFieldData()->AddArray(airportCodes.getStrings());
 		break;
 	}
 
 	case Data::TWEETS: {
-		vtkSmartPointer<vtkStringArray> authors = vtkSmartPointer<vtkStringArray>::New();
-		authors->SetNumberOfComponents(relevantDataPoints.size());
-		authors->SetName("authors");
-
-		vtkSmartPointer<vtkStringArray> contents = vtkSmartPointer<vtkStringArray>::New();
-		contents->SetNumberOfComponents(relevantDataPoints.size());
-		contents->SetName("contents");
-
-		vtkSmartPointer<vtkIntArray> numberOfRetweets = vtkSmartPointer<vtkIntArray>::New();
-		numberOfRetweets->SetNumberOfComponents(1);
-		numberOfRetweets->SetNumberOfValues(relevantDataPoints.size());
-		numberOfRetweets->SetName("numberOfRetweets");
-
-		int i = 0;
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const TweetDataPoint* dataPoint = dynamic_cast<const TweetDataPoint*>(
-			                                      (*iterator)
-			                                  );
-
-			authors->InsertNextValue(dataPoint->getAuthor().toStdString());
-			contents->InsertNextValue(dataPoint->getContent().toStdString());
-			numberOfRetweets->InsertValue(i, (int) dataPoint->getNumberOfRetweets());
-			i++;
-		}
-
-		dataSet->GetPointData()->AddArray(authors);
-		dataSet->GetPointData()->AddArray(contents);
-		dataSet->GetPointData()->AddArray(numberOfRetweets);
+		SliceDictionary authors("authorDictionary", dataPoints.getAuthorDictionary());
+
+		dataSet->GetPointData()->AddArray(authors.gatherStrings(
+		                                      "authors", dataPoints.getAuthorIds(), relevantDataPoints));
+		dataSet->GetPointData()->AddArray(gatherStringColumn(
+		                                      "contents", dataPoints.getContents(), relevantDataPoints));
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkIntArray>(
+		                                      "numberOfRetweets", dataPoints.getNumberOfRetweets(),
+		                                      relevantDataPoints));
+		dataSet->GetPointData()->AddArray(authors.gatherIds(
+		                                      "authorIds", dataPoints.getAuthorIds(), relevantDataPoints));
+		dataSet->GetFieldData()->AddArray(authors.getStrings());
 		break;
 	}
 
 	case Data::PRECIPITATION: {
-		vtkSmartPointer<vtkFloatArray> precipitationRates
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		precipitationRates->SetNumberOfComponents(1);
-		precipitationRates->SetNumberOfTuples(relevantDataPoints.size());
-		precipitationRates->SetName("precipitationRates");
-
-		vtkSmartPointer<vtkIntArray> precipitationTypes
-		    = vtkSmartPointer<vtkIntArray>::New();
-		precipitationTypes->SetNumberOfComponents(1);
-		precipitationTypes->SetNumberOfTuples(relevantDataPoints.size());
-		precipitationTypes->SetName("precipitationTypes");
-
-		int tupleNumber = 0;
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const PrecipitationDataPoint* dataPoint
-			    = dynamic_cast<const PrecipitationDataPoint*>((*iterator));
-
-			double precipitationRate[1] = {
-				(double) dataPoint->getPrecipitationRate()
-			};
-			precipitationRates->SetTuple(tupleNumber, precipitationRate);
-
-			double precipitationType[1] = {
-				(double) dataPoint->getPrecipitationType()
-			};
-			precipitationTypes->SetTuple(tupleNumber, precipitationType);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(precipitationRates);
-		dataSet->GetPointData()->AddArray(precipitationTypes);
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkFloatArray>(
+		                                      "precipitationRates", dataPoints.getPrecipitationRates(),
+		                                      relevantDataPoints));
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkIntArray>(
+		                                      "precipitationTypes", dataPoints.getPrecipitationTypes(),
+		                                      relevantDataPoints));
 		break;
 	}
 
 	case Data::TEMPERATURE: {
-		vtkSmartPointer<vtkFloatArray> temperatures
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		temperatures->SetNumberOfComponents(1);
-		temperatures->SetNumberOfTuples(relevantDataPoints.size());
-		temperatures->SetName("temperatures");
-
-		int tupleNumber = 0;
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const TemperatureDataPoint* dataPoint
-			    = dynamic_cast<const TemperatureDataPoint*>((*iterator));
-
-			double temperature[1] = {
-				(double) dataPoint->getTemperature()
-			};
-			temperatures->SetTuple(tupleNumber, temperature);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(temperatures);
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkFloatArray>(
+		                                      "temperatures", dataPoints.getTemperatures(),
+		                                      relevantDataPoints));
 		break;
 	}
 
 	case Data::WIND: {
-		vtkSmartPointer<vtkFloatArray> speeds
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		speeds->SetNumberOfComponents(1);
-		speeds->SetNumberOfTuples(relevantDataPoints.size());
-		speeds->SetName("speeds");
-
-		vtkSmartPointer<vtkFloatArray> directions
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		directions->SetNumberOfComponents(1);
-		directions->SetNumberOfTuples(relevantDataPoints.size());
-		directions->SetName("directions");
-
-		int tupleNumber = 0;
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const WindDataPoint* dataPoint
-			    = dynamic_cast<const WindDataPoint*>((*iterator));
-
-			double speed[1] = {
-				(double) dataPoint->getSpeed()
-			};
-			speeds->SetTuple(tupleNumber, speed);
-
-			double direction[1] = {
-				(double) dataPoint->getDirection()
-			};
-			directions->SetTuple(tupleNumber, direction);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(speeds);
-		dataSet->GetPointData()->AddArray(directions);
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkFloatArray>(
+		                                      "speeds", dataPoints.getSpeeds(), relevantDataPoints));
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkFloatArray>(
+		                                      "directions", dataPoints.getDirections(),
+		                                      relevantDataPoints));
 		break;
 	}
 
 	case Data::CLOUD_COVERAGE: {
-		vtkSmartPointer<vtkFloatArray> coverageValues
-		    = vtkSmartPointer<vtkFloatArray>::New();
-		coverageValues->SetNumberOfComponents(1);
-		coverageValues->SetNumberOfTuples(relevantDataPoints.size());
-		coverageValues->SetName("cloudCovers");
-
-		int tupleNumber = 0;
-		for (QList<DataPoint*>::iterator iterator = relevantDataPoints.begin();
-		        iterator != relevantDataPoints.end(); ++iterator) {
-			const CloudCoverageDataPoint* dataPoint
-			    = dynamic_cast<const CloudCoverageDataPoint*>((*iterator));
-
-			double coverage[1] = {
-				(double) dataPoint->getCloudCoverage()
-			};
-			coverageValues->SetTuple(tupleNumber, coverage);
-
-			tupleNumber++;
-		}
-
-		dataSet->GetPointData()->AddArray(coverageValues);
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkFloatArray>(
+		                                      "cloudCovers", dataPoints.getCloudCovers(),
+		                                      relevantDataPoints));
 		break;
 	}
 	}
 
-	// Finally, add the aforementioned common arrays if necessary
-	if (temporal) {
-		dataSet->GetPointData()->AddArray(timestamps);
+	// Finally, add the aforementioned common arrays. 32-bit integers are sufficient for the
+	// timestamps since UNIX timestamps are being used.
+	if (Data::isTemporal(dataType)) {
+		dataSet->GetPointData()->AddArray(gatherColumn<vtkIntArray>(
+		                                      "timestamps", dataPoints.getTimestamps(),
+		                                      relevantDataPoints));
 	}
 
 	dataSet->GetPointData()->AddArray(priorities);
@@ -1,13 +1,14 @@
 #ifndef KRONOS_POLYDATASETHELPER_HPP
 #define KRONOS_POLYDATASETHELPER_HPP
 
-#include <QList>
-#include <Reader/DataReader/DataPoints/DataPoint.hpp>
 #include <Reader/DataReader/PointDataSet.hpp>
+#include <Reader/DataReader/PointDataIndex.hpp>
 #include <Reader/DataReader/Data.hpp>
 #include <vtkPolyData.h>
 #include <vtkSmartPointer.h>
 
+#include <vector>
+
 /**
 * Offers static utility methods for creating vtkPolyData from data points.
 */
@@ -15,96 +16,50 @@ class PolyDataSetHelper {
 
 public:
 	/**
-	 * Convert a list of non-temporal data points into vtkPolyData.
-	 * @param dataPoints A list of non-temporal data points to be converted
+	 * Convert a set of non-temporal data points into vtkPolyData.
+	 * @param dataPoints A set of non-temporal data points to be converted
+	 * @param index The index built over the data points
 	 * @param zoomLevel The current zoom level
-	 * @param dataType The type of data points in the list
+	 * @param dataType The type of data points in the set
 	 * @return A vtkPolyData object containing all relevant data points
 	 */
 	static vtkSmartPointer<vtkPolyData> getPolyDataFromDataPoints(
-	    PointDataSet dataPoints,
+	    const PointDataSet& dataPoints,
+	    const PointDataIndex& index,
 	    int zoomLevel,
 	    Data::Type dataType
 	);
 
 	/**
-	 * Convert a list of temporal data points into vtkPolyData.
-	 * @param dataPoints A list of temporal data points to be converted
+	 * Convert a set of temporal data points into vtkPolyData.
+	 * @param dataPoints A set of temporal data points to be converted
+	 * @param index The index built over the data points
 	 * @param zoomLevel The current zoom level
-	 * @param dataType The type of data points in the list
-	 * @param timeResolution Amount of seconds a single time step contains
+	 * @param dataType The type of data points in the set
 	 * @param timeStep The current time step, which is the amount of time spans from the start time
-	 * with the length of one such time span specified by the time resolution
-	 * @param startTime Timestamp of the earliest data point in the list
+	 * with the length of one such time span specified by the time resolution the index was built
+	 * with
 	 * @return A vtkPolyData object containing all relevant data points
 	 */
 	static vtkSmartPointer<vtkPolyData> getPolyDataFromDataPoints(
-	    PointDataSet dataPoints,
+	    const PointDataSet& dataPoints,
+	    const PointDataIndex& index,
 	    int zoomLevel,
 	    Data::Type dataType,
-	    int timeResolution,
-	    int timeStep,
-	    int startTime
+	    int timeStep
 	);
 
 private:
-	/**
-	 * Internal method that can convert a list of either temporal or non-temporal data points into
-	 * vtkPolyData.
-	 * @param dataPoints A list of data points to be converted
-	 * @param zoomLevel The current zoom level
-	 * @param dataType The type of data points in the list
-	 * @param timeResolution Amount of seconds a single time step contains
-	 * @param timeStep The current time step
-	 * @param startTime Timestamp of the earliest data point in the list
-	 * @return A vtkPolyData object containing all relevant data points
-	 */
-	static vtkSmartPointer<vtkPolyData> getPolyDataFromDataPoints(
-	    PointDataSet dataPoints,
-	    int zoomLevel,
-	    Data::Type dataType,
-	    int timeResolution,
-	    int timeStep,
-	    int startTime,
-	    bool temporal
-	);
-
-	/**
-	 * Extract relevant data points from a list of non-temporal data points.
-	 * @param points A list of non-temporal data points
-	 * @param zoomLevel The current zoom level
-	 * @return A list of all data points relevant to the given zoom level
-	 */
-	static QList<DataPoint*> extractRelevantDataPoints(
-	    PointDataSet points,
-	    int zoomLevel
-	);
-
-	/**
-	 * Extract relevant data points from a list of temporal data points.
-	 * @param points A list of temporal data points
-	 * @param zoomLevel The current zoom level
-	 * @param timeResolution Amount of seconds a single time step contains
-	 * @param timeStep The current time step
-	 * @param startTime Timestamp of the earliest data point in the list
-	 * @return A list of all data points relevant to the given zoom level and time information
-	 */
-	static QList<DataPoint*> extractRelevantDataPoints(
-	    PointDataSet points,
-	    int zoomLevel,
-	    int timeResolution,
-	    int timeStep,
-	    int startTime
-	);
-
 	/**
 	 * Create a vtkPolyData object from a set of points.
-	 * @param points A list of data points to be put into the data set
+	 * @param dataPoints The set of data points the indices refer to
+	 * @param relevantDataPoints The indices of the data points to be put into the data set
 	 * @param dataType The type of data points in the list
 	 * @return A vtkPolyData object containing all points from the list
 	 */
 	static vtkSmartPointer<vtkPolyData> createPolyDataSet(
-	    QList<DataPoint*> relevantDataPoints,
+	    const PointDataSet& dataPoints,
+	    const std::vector<int>& relevantDataPoints,
 	    Data::Type dataType
 	);
 
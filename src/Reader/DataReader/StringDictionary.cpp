@@ -0,0 +1,39 @@
+#include <Reader/DataReader/StringDictionary.hpp>
+
+#include <utility>
+
+StringDictionary::StringDictionary() { }
+
+int StringDictionary::intern(const std::string& string) {
+	std::unordered_map<std::string, int>::iterator position = this->ids.find(string);
+	if (position != this->ids.end()) {
+		return position->second;
+	}
+
+	int id = this->strings.size();
+	this->strings.push_back(string);
+	this->ids.insert(std::make_pair(string, id));
+
+	return id;
+}
+
+const std::string& StringDictionary::getString(int id) const {
+	return this->strings[id];
+}
+
+const std::vector<std::string>& StringDictionary::getStrings() const {
+	return this->strings;
+}
+
+int StringDictionary::size() const {
+	return this->strings.size();
+}
+
+void StringDictionary::rebuildLookup() {
+	this->ids.clear();
+	this->ids.reserve(this->strings.size());
+
+	for (size_t i = 0; i < this->strings.size(); i++) {
+		this->ids.insert(std::make_pair(this->strings[i], (int) i));
+	}
+}
@@ -0,0 +1,68 @@
+#ifndef KRONOS_STRINGDICTIONARY_HPP
+#define KRONOS_STRINGDICTIONARY_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+* Interns strings by assigning each distinct string a small integer ID. Columns holding values
+* that repeat a lot, such as tweet authors or airline names, store these IDs instead of their own
+* copies of each string. IDs are assigned in order of first appearance, starting at zero.
+*/
+class StringDictionary {
+
+	friend class BinarySnapshot;
+
+public:
+	/**
+	 * Create a new, empty dictionary.
+	 */
+	StringDictionary();
+
+	/**
+	 * Get the ID of a string, adding the string to this dictionary if it is not known yet.
+	 * @param string The string to be interned
+	 * @return The ID of the string
+	 */
+	int intern(const std::string& string);
+
+	/**
+	 * Get the string belonging to an ID.
+	 * @param id An ID previously returned by `intern`
+	 * @return The string with the given ID
+	 */
+	const std::string& getString(int id) const;
+
+	/**
+	 * Get all strings of this dictionary, the position of each string being its ID.
+	 * @return All strings of this dictionary
+	 */
+	const std::vector<std::string>& getStrings() const;
+
+	/**
+	 * Get the amount of distinct strings in this dictionary.
+	 * @return The amount of distinct strings
+	 */
+	int size() const;
+
+private:
+	/**
+	 * Recreate the lookup of IDs by string from the list of strings, used after the list has been
+	 * replaced as a whole.
+	 */
+	void rebuildLookup();
+
+	/**
+	 * All distinct strings in order of their IDs
+	 */
+	std::vector<std::string> strings;
+
+	/**
+	 * The ID of each distinct string
+	 */
+	std::unordered_map<std::string, int> ids;
+
+};
+
+#endif
@@ -1,9 +1,11 @@
 #include <Reader/vtkKronosReader.h>
 
 #include <Reader/DataReader/JsonReaderFactory.hpp>
+#include <Reader/DataReader/BinarySnapshot.hpp>
 #include <Reader/DataReader/JsonReader.hpp>
 #include <Reader/DataReader/Data.hpp>
 #include <Utils/Config/Configuration.hpp>
+#include <Utils/Misc/MakeUnique.hpp>
 
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
@@ -18,7 +20,7 @@
 
 vtkStandardNewMacro(vtkKronosReader);
 
-vtkKronosReader::vtkKronosReader() : error(false), zoomLevel(0), cachingInThread(false) {
+vtkKronosReader::vtkKronosReader() : error(false), zoomLevel(0) {
 	// Initialize values that are read from the program configuration
 	try {
 		this->globeRadius = Configuration::getInstance().getDouble("globe.radius");
@@ -40,25 +42,83 @@ vtkKronosReader::~vtkKronosReader() {
 }
 
 void vtkKronosReader::abortCaching() {
-	if (this->jsonReader && this->cachingInThread) {
-		this->jsonReader->abortCaching();
-		this->cacheThread.join();
+	if (this->cachingScheduler) {
+		this->cachingScheduler->stop();
+	}
+
+	for (std::vector<std::thread>::iterator thread = this->cachingThreads.begin();
+	        thread != this->cachingThreads.end(); ++thread) {
+		thread->join();
+	}
+
+	this->cachingThreads.clear();
+	this->cachingScheduler.reset();
+}
+
+void vtkKronosReader::startCaching() {
+	int amountOfTimeSteps = 1;
+	if (this->jsonReader->hasTemporalData()) {
+		amountOfTimeSteps = this->jsonReader->getAmountOfTimeSteps();
+	}
+
+	this->cachingScheduler = makeUnique<CachingScheduler>(this->maximumPriority, amountOfTimeSteps);
+	this->cachingScheduler->setFocus(this->zoomLevel, 0);
+	this->jsonReader->setCachingEnabled(true);
+
+	// Zero uses every core since the slices are independent of each other
+	int amountOfThreads = 0;
+	if (Configuration::getInstance().hasKey("dataReader.cachingThreads")) {
+		amountOfThreads = Configuration::getInstance().getInteger("dataReader.cachingThreads");
+	}
+	if (amountOfThreads <= 0) {
+		amountOfThreads = std::thread::hardware_concurrency();
+	}
+	amountOfThreads = std::max(amountOfThreads, 1);
+
+	for (int i = 0; i < amountOfThreads; i++) {
+		this->cachingThreads.push_back(std::thread(&vtkKronosReader::cacheInBackground, this));
+	}
+}
+
+void vtkKronosReader::cacheInBackground() {
+	int zoomLevel;
+	int time;
+
+	while (this->cachingScheduler->next(zoomLevel, time)) {
+		// Caching any further would only displace data closer to what is currently displayed
+		if (!this->jsonReader->cacheVtkDataSet(zoomLevel, time)) {
+			this->cachingScheduler->stop();
+		}
 	}
 }
 
 void vtkKronosReader::SetFileName(std::string name, bool startCaching) {
+	// Caching threads still working on the previous file must not outlive its reader
+	this->abortCaching();
+	this->jsonReader.reset();
+
 	this->fileName = QString::fromStdString(name);
 
 	try {
-		this->jsonReader = JsonReaderFactory::createReader(this->fileName);
+		// Prefer a binary snapshot of the file, which loads much faster than the file itself
+		if (BinarySnapshot::isEnabled()) {
+			this->jsonReader = BinarySnapshot::load(this->fileName);
+		}
+
+		if (!this->jsonReader) {
+			this->jsonReader = JsonReaderFactory::createReader(this->fileName);
+
+			if (BinarySnapshot::isEnabled()) {
+				BinarySnapshot::save(*this->jsonReader, this->fileName);
+			}
+		}
 	} catch (const ReaderException& e) {
 		this->fail(e.what());
 		return;
 	}
 
 	if (startCaching) {
-		this->cacheThread = std::thread(&JsonReader::cacheAllData, this->jsonReader.get());
-		this->cachingInThread = true;
+		this->startCaching();
 	}
 }
 
@@ -133,6 +193,10 @@ int vtkKronosReader::RequestInformation(vtkInformation* request, vtkInformationV
 	if (this->jsonReader->hasTemporalData()) {
 		outInfo->Set(Data::VTK_TIME_RESOLUTION(), this->jsonReader->getTimeResolution());
 		request->Append(vtkExecutive::KEYS_TO_COPY(), Data::VTK_TIME_RESOLUTION());
+
+		// Offer all time steps at once to directly connected filters only, since filters in between
+		// may not be able to handle them
+		outInfo->Set(Data::VTK_START_TIME(), this->jsonReader->getStartTime());
 	}
 
 	return 1;
@@ -152,8 +216,21 @@ int vtkKronosReader::RequestData(vtkInformation*, vtkInformationVector**,
 	if (this->jsonReader != nullptr) {
 		vtkSmartPointer<vtkPolyData> polyData;
 
-		if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) &&
-		        this->jsonReader->hasTemporalData()) {
+		bool allTimeSteps = outInfo->Has(Data::VTK_ALL_TIME_STEPS())
+		                    && outInfo->Get(Data::VTK_ALL_TIME_STEPS()) != 0;
+
+		// The request only holds for this update, other consumers of the output port must not
+		// receive all time steps as well
+		outInfo->Remove(Data::VTK_ALL_TIME_STEPS());
+
+		if (allTimeSteps && this->jsonReader->hasTemporalData()) {
+			// The data points of all time steps are requested at once, each carrying its timestamp
+
+			polyData = this->jsonReader->getVtkDataSet(
+			               this->zoomLevel
+			           );
+		} else if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) &&
+		           this->jsonReader->hasTemporalData()) {
 			// The data request has time information attached that should be extracted and used
 
 			double requestedTimeValue = outInfo->Get(
@@ -165,16 +242,35 @@ int vtkKronosReader::RequestData(vtkInformation*, vtkInformationVector**,
 			               (int) requestedTimeValue
 			           );
 
-			polyData->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), requestedTimeValue);
+			if (this->cachingScheduler) {
+				this->cachingScheduler->setFocus(this->zoomLevel, (int) requestedTimeValue);
+			}
 		} else {
 			// There is no time information or the data is not time-sensitive
 
 			polyData = this->jsonReader->getVtkDataSet(
 			               this->zoomLevel
 			           );
+
+			if (this->cachingScheduler) {
+				this->cachingScheduler->setFocus(this->zoomLevel, 0);
+			}
 		}
 
-		output->DeepCopy(polyData);
+		// Share the data set's arrays instead of duplicating them for every time step and zoom
+		// level. The cache notices if a consumer modifies them and builds a fresh data set then.
+		output->ShallowCopy(polyData);
+
+		// Only the output is marked with the time step since the data set may be cached
+		if (allTimeSteps) {
+			output->GetInformation()->Remove(vtkDataObject::DATA_TIME_STEP());
+		} else if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) &&
+		           this->jsonReader->hasTemporalData()) {
+			output->GetInformation()->Set(
+			    vtkDataObject::DATA_TIME_STEP(),
+			    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+			);
+		}
 	}
 
 	return 1;
@@ -4,9 +4,11 @@
 #include <vtkPolyDataAlgorithm.h>
 #include <memory>
 #include <thread>
+#include <vector>
 #include <QString>
 
 #include <Reader/DataReader/JsonReader.hpp>
+#include <Reader/DataReader/CachingScheduler.hpp>
 #include <Utils/Math/Vector3.hpp>
 
 class vtkKronosReader : public vtkPolyDataAlgorithm {
@@ -22,7 +24,7 @@ public:
 	/**
 	 * Set the name of the file this reader should use.
 	 * @param name Path of the file that should be read
-	 * @param startCaching True if this reader should start caching data for future use in a separate thread, false otherwise
+	 * @param startCaching True if this reader should start caching data for future use in separate threads, false otherwise
 	 */
 	void SetFileName(std::string name, bool startCaching);
 
@@ -59,6 +61,17 @@ private:
 	 */
 	void recalculateZoomLevel();
 
+	/**
+	 * Start the pool of threads caching all data in the background.
+	 */
+	void startCaching();
+
+	/**
+	 * Main loop of a caching thread, caching the slices handed out by the scheduler until there
+	 * are none left or the cache is full.
+	 */
+	void cacheInBackground();
+
 	/**
 	 * Display an error message and remember that this reader does not hold valid data.
 	 * @param message The error message to be shown to the user
@@ -106,14 +119,15 @@ private:
 	std::unique_ptr<JsonReader> jsonReader;
 
 	/**
-	 * This thread will pre-cache data in the background once the reader has been created.
+	 * These threads will pre-cache data in the background once the reader has been created.
 	 */
-	std::thread cacheThread;
+	std::vector<std::thread> cachingThreads;
 
 	/**
-	 * Boolean flag denoting whether this reader has been caching data in the background.
+	 * Decides which data the caching threads cache next, starting with the data closest to the
+	 * zoom level and time step currently displayed. Only exists while caching is in progress.
 	 */
-	bool cachingInThread;
+	std::unique_ptr<CachingScheduler> cachingScheduler;
 
 };
 
@@ -0,0 +1,22 @@
+#include <Utils/Math/WindVectors.hpp>
+
+void WindVectors::toComponents(const float* bearings, float* eastward, float* northward,
+                               size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		WindVectors::toComponents(bearings[i], eastward[i], northward[i]);
+	}
+}
+
+void WindVectors::toBearings(const float* eastward, const float* northward, float* bearings,
+                             size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		bearings[i] = WindVectors::toBearing(eastward[i], northward[i]);
+	}
+}
+
+void WindVectors::blendBearings(const float* left, const float* right, float factor,
+                                float* output, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		output[i] = WindVectors::blendBearing(left[i], right[i], factor);
+	}
+}
@@ -0,0 +1,141 @@
+#ifndef KRONOS_WIND_VECTORS_HPP
+#define KRONOS_WIND_VECTORS_HPP
+
+#include <cmath>
+#include <cstddef>
+
+/**
+ * Blends and averages wind bearings in vector space. Bearings are given in degrees, clockwise
+ * from north, and cannot be blended as scalars since they wrap around: the mean of 350° and 10°
+ * is 0°, not 180°. Instead, each bearing is decomposed into the eastward (u) and northward (v)
+ * components of its unit vector, these are blended or accumulated and the result is recomposed
+ * into a bearing.
+ *
+ * The trigonometric functions are evaluated by branch-free polynomials so that the batch
+ * functions can be vectorized by the compiler. Their error is below a thousandth of a degree.
+ * Bearings whose components cancel each other out, e.g. when blending two opposite bearings
+ * halfway, have no direction and yield 0°.
+ */
+class WindVectors {
+
+public:
+	/**
+	 * Decompose bearings into the components of their unit vectors.
+	 * @param bearings The bearings in degrees
+	 * @param eastward The eastward component of each bearing is written here
+	 * @param northward The northward component of each bearing is written here
+	 * @param count The amount of bearings
+	 */
+	static void toComponents(const float* bearings, float* eastward, float* northward,
+	                         size_t count);
+
+	/**
+	 * Recompose bearings from their vector components, which do not need to be normalized.
+	 * @param eastward The eastward component of each vector
+	 * @param northward The northward component of each vector
+	 * @param bearings The bearing of each vector in degrees within [0, 360] is written here
+	 * @param count The amount of vectors
+	 */
+	static void toBearings(const float* eastward, const float* northward, float* bearings,
+	                       size_t count);
+
+	/**
+	 * Blend two rows of bearings pairwise.
+	 * @param left The bearings approached for a factor of 0
+	 * @param right The bearings approached for a factor of 1
+	 * @param factor The weight of the right bearings
+	 * @param output The blended bearings in degrees within [0, 360] are written here
+	 * @param count The amount of bearings in each row
+	 */
+	static void blendBearings(const float* left, const float* right, float factor, float* output,
+	                          size_t count);
+
+	/**
+	 * Decompose a single bearing into the components of its unit vector.
+	 * @param bearing The bearing in degrees
+	 * @param eastward The eastward component is written here
+	 * @param northward The northward component is written here
+	 */
+	static inline void toComponents(float bearing, float& eastward, float& northward);
+
+	/**
+	 * Recompose a single bearing from its vector components.
+	 * @param eastward The eastward component of the vector
+	 * @param northward The northward component of the vector
+	 * @return The bearing of the vector in degrees within [0, 360]
+	 */
+	static inline float toBearing(float eastward, float northward);
+
+	/**
+	 * Blend two bearings.
+	 * @param left The bearing approached for a factor of 0
+	 * @param right The bearing approached for a factor of 1
+	 * @param factor The weight of the right bearing
+	 * @return The blended bearing in degrees within [0, 360]
+	 */
+	static inline float blendBearing(float left, float right, float factor);
+
+private:
+	/**
+	 * Hidden since this class only offers static utility methods.
+	 */
+	WindVectors();
+	~WindVectors();
+
+};
+
+inline void WindVectors::toComponents(float bearing, float& eastward, float& northward) {
+	// Reduce the bearing to a multiple of 90° and a remainder within [-45°, 45°] in radians
+	float quarters = bearing * (1.f / 90.f);
+	int quadrant = (int) (quarters + (quarters >= 0 ? 0.5f : -0.5f));
+	float x = (bearing - quadrant * 90.f) * 0.017453292f;
+	float x2 = x * x;
+
+	// Taylor polynomials, which are accurate enough on the reduced range
+	float sine = x * (1.f + x2 * (-1.f / 6 + x2 * (1.f / 120 + x2 * (-1.f / 5040))));
+	float cosine = 1.f + x2 * (-0.5f + x2 * (1.f / 24 + x2 * (-1.f / 720 + x2 * (1.f / 40320))));
+
+	// Rotate the result back into the quadrant of the bearing. The selections are kept apart from
+	// any arithmetic so that they compile to blends instead of branches.
+	bool swap = (quadrant & 1) != 0;
+	float rotatedSine = swap ? cosine : sine;
+	float rotatedCosine = swap ? sine : cosine;
+
+	eastward = rotatedSine * (1 - (quadrant & 2));
+	northward = rotatedCosine * (1 - ((quadrant + 1) & 2));
+}
+
+inline float WindVectors::toBearing(float eastward, float northward) {
+	float absoluteEastward = std::fabs(eastward);
+	float absoluteNorthward = std::fabs(northward);
+	bool steep = absoluteEastward > absoluteNorthward;
+	float minimum = steep ? absoluteNorthward : absoluteEastward;
+	float maximum = steep ? absoluteEastward : absoluteNorthward;
+
+	// Arc tangent of the smaller over the larger component, a minimax polynomial on [0, 1]
+	float a = minimum / (maximum > 1e-30f ? maximum : 1e-30f);
+	float s = a * a;
+	float angle = a * (0.99997726f + s * (-0.33262347f + s * (0.19354346f + s * (-0.11643287f
+	                   + s * (0.05265332f + s * -0.01172120f)))));
+
+	// Unfold the angle into the full circle, measured clockwise from north. Only constants are
+	// selected so that the compiler emits blends instead of branches.
+	angle = (steep ? 1.5707964f : 0.f) + (steep ? -1.f : 1.f) * angle;
+	angle = (northward < 0 ? 3.1415927f : 0.f) + (northward < 0 ? -1.f : 1.f) * angle;
+	angle = std::copysign(angle, eastward);
+
+	// Tiny negative angles may round up to a full 360°, which is not worth a further selection
+	float bearing = angle * 57.29578f;
+	return bearing + (bearing < 0 ? 360.f : 0.f);
+}
+
+inline float WindVectors::blendBearing(float left, float right, float factor) {
+	float leftEastward, leftNorthward, rightEastward, rightNorthward;
+	WindVectors::toComponents(left, leftEastward, leftNorthward);
+	WindVectors::toComponents(right, rightEastward, rightNorthward);
+
+	return WindVectors::toBearing((1 - factor) * leftEastward + factor * rightEastward,
+	                              (1 - factor) * leftNorthward + factor * rightNorthward);
+}
+
+#endif
@@ -2,8 +2,17 @@
 
 #include <Utils/Math/Vector3.hpp>
 #include <math.h>
+#include <functional>
 
 double PointCoordinates::getDistanceTo(PointCoordinates other) {
 	return sqrt(pow(this->getX() - other.getX(), 2) + pow(this->getY() - other.getY(),
 	            2) + pow(this->getZ() - other.getZ(), 2));
-}
\ No newline at end of file
+}
+
+size_t PointCoordinatesHash::operator()(const PointCoordinates& coordinates) const {
+	std::hash<double> hash;
+	size_t seed = hash(coordinates.getX());
+	seed ^= hash(coordinates.getY()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	seed ^= hash(coordinates.getZ()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	return seed;
+}
@@ -3,6 +3,8 @@
 
 #include <Utils/Math/Vector3.hpp>
 
+#include <cstddef>
+
 /**
  * Holds three-dimensional coordinates of a point.
  */
@@ -55,4 +57,11 @@ public:
 	double getDistanceTo(PointCoordinates other);
 };
 
+/**
+ * Hashes point coordinates so that points can be identified in hash maps, e.g. across time steps.
+ */
+struct PointCoordinatesHash {
+	size_t operator()(const PointCoordinates& coordinates) const;
+};
+
 #endif
@@ -0,0 +1,45 @@
+#ifndef KRONOS_THREADS_HPP
+#define KRONOS_THREADS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/**
+ * Splits work on many items among threads, each processing a contiguous range of the items.
+ */
+class Threads {
+
+public:
+	/**
+	 * Decide how many threads are worth using for a given amount of items.
+	 * @param amountOfItems The amount of items to be processed
+	 * @param minimumItemsPerThread The smallest amount of items worth another thread
+	 * @return The amount of threads, at least one and at most one per hardware thread
+	 */
+	static int getAmountOfThreads(int64_t amountOfItems, int64_t minimumItemsPerThread) {
+		int amountOfThreads = std::max<int>(std::thread::hardware_concurrency(), 1);
+		return std::max<int>(std::min<int64_t>(amountOfThreads,
+		                                       amountOfItems / minimumItemsPerThread), 1);
+	}
+
+	/**
+	 * Run a function on several threads at once, passing each one its index.
+	 * @param amountOfThreads The amount of threads, including the calling one
+	 * @param function Called with the index of each thread
+	 */
+	template<typename Function>
+	static void run(int amountOfThreads, const Function& function) {
+		std::vector<std::thread> threads;
+		for (int t = 1; t < amountOfThreads; t++) {
+			threads.push_back(std::thread(function, t));
+		}
+		function(0);
+		for (size_t t = 0; t < threads.size(); t++) {
+			threads[t].join();
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <Filter/AbstractSelectionFilter/BlockSummaries.hpp>
+
+#include <limits>
+#include <vector>
+
+TEST(TestBlockSummaries, CoverSortedBlocks) {
+	// Three complete blocks of ascending values and an incomplete one
+	std::vector<float> values(3 * BlockSummaries::BLOCK_SIZE + 10);
+	for (size_t i = 0; i < values.size(); i++) {
+		values[i] = i;
+	}
+
+	BlockSummaries summaries;
+	summaries.summarize(values.data(), values.size());
+	EXPECT_EQ(
+	    values.size(),
+	    summaries.getValueCount()
+	);
+
+	double lowerLimit = BlockSummaries::BLOCK_SIZE;
+	double upperLimit = 2.5 * BlockSummaries::BLOCK_SIZE;
+	EXPECT_EQ(
+	    BlockSummaries::OUTSIDE,
+	    summaries.getCoverage(0, lowerLimit, upperLimit)
+	);
+	EXPECT_EQ(
+	    BlockSummaries::INSIDE,
+	    summaries.getCoverage(1, lowerLimit, upperLimit)
+	);
+	EXPECT_EQ(
+	    BlockSummaries::OVERLAPPING,
+	    summaries.getCoverage(2, lowerLimit, upperLimit)
+	);
+	EXPECT_EQ(
+	    BlockSummaries::OUTSIDE,
+	    summaries.getCoverage(3, lowerLimit, upperLimit)
+	);
+}
+
+TEST(TestBlockSummaries, NeverAcceptBlocksWithNaN) {
+	std::vector<double> values(BlockSummaries::BLOCK_SIZE, 1);
+	values[100] = std::numeric_limits<double>::quiet_NaN();
+
+	BlockSummaries summaries;
+	summaries.summarize(values.data(), values.size());
+
+	EXPECT_EQ(
+	    BlockSummaries::OVERLAPPING,
+	    summaries.getCoverage(0, 0, 2)
+	);
+	EXPECT_EQ(
+	    BlockSummaries::OUTSIDE,
+	    summaries.getCoverage(0, 2, 3)
+	);
+}
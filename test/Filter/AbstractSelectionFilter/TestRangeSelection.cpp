@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <Filter/AbstractSelectionFilter/RangeSelection.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST(TestRangeSelection, SelectWithinAllRanges) {
+	// Span several blocks and end with an incomplete one
+	size_t count = 3 * RangeSelection::BLOCK_SIZE + 17;
+
+	std::vector<double> times(count);
+	std::vector<float> altitudes(count);
+	std::vector<unsigned int> orbits(count);
+	std::vector<unsigned char> detections(count);
+	for (size_t i = 0; i < count; i++) {
+		times[i] = i * 0.5;
+		altitudes[i] = (i % 100) * 0.1f;
+		orbits[i] = i % 7;
+		detections[i] = i % 256;
+	}
+	altitudes[5] = std::numeric_limits<float>::quiet_NaN();
+
+	RangeSelection rangeSelection;
+	rangeSelection.addRange(times.data(), 100, 5000);
+	rangeSelection.addRange(altitudes.data(), 0.1, 5);
+	rangeSelection.addRange(orbits.data(), 1.5, 4.5);
+	rangeSelection.addRange(detections.data(), -10, 200);
+
+	std::vector<unsigned char> selection(count, 7);
+	rangeSelection.select(selection.data(), count);
+
+	size_t selectedPoints = 0;
+	for (size_t i = 0; i < count; i++) {
+		bool expected = times[i] >= 100 && times[i] <= 5000
+		                && altitudes[i] >= 0.1 && altitudes[i] <= 5
+		                && orbits[i] >= 2 && orbits[i] <= 4
+		                && detections[i] <= 200;
+		ASSERT_EQ(
+		    expected ? 1 : 0,
+		    selection[i]
+		) << "at point " << i;
+		selectedPoints += selection[i];
+	}
+	EXPECT_LT(
+	    0u,
+	    selectedPoints
+	);
+}
+
+TEST(TestRangeSelection, SelectNothingForEmptyRanges) {
+	std::vector<float> temperatures(100, 0.1f);
+	std::vector<unsigned char> selection(100);
+
+	// No float equals the double closest to 0.1
+	RangeSelection exactRange;
+	exactRange.addRange(temperatures.data(), 0.1, 0.1);
+	exactRange.select(selection.data(), selection.size());
+	EXPECT_EQ(
+	    0,
+	    selection[0]
+	);
+
+	RangeSelection invertedRange;
+	invertedRange.addRange(temperatures.data(), 1, -1);
+	invertedRange.select(selection.data(), selection.size());
+	EXPECT_EQ(
+	    0,
+	    selection[99]
+	);
+
+	// The float closest to 0.1 itself is selected
+	RangeSelection floatRange;
+	floatRange.addRange(temperatures.data(), 0.1f, 0.1f);
+	floatRange.select(selection.data(), selection.size());
+	EXPECT_EQ(
+	    1,
+	    selection[50]
+	);
+}
+
+TEST(TestRangeSelection, SkipSummarizedBlocks) {
+	size_t count = 5 * RangeSelection::BLOCK_SIZE + 300;
+
+	// Ascending times and coherent altitudes, as well as a block of missing altitudes
+	std::vector<double> times(count);
+	std::vector<float> altitudes(count);
+	for (size_t i = 0; i < count; i++) {
+		times[i] = i;
+		altitudes[i] = (i / 1000) % 10;
+	}
+	for (size_t i = 0; i < RangeSelection::BLOCK_SIZE; i++) {
+		altitudes[3 * RangeSelection::BLOCK_SIZE + i] = std::numeric_limits<float>::quiet_NaN();
+	}
+
+	BlockSummaries timeSummaries;
+	timeSummaries.summarize(times.data(), count);
+	BlockSummaries altitudeSummaries;
+	altitudeSummaries.summarize(altitudes.data(), count);
+
+	double lowerTime = 3000;
+	double upperTime = count - 100;
+	RangeSelection scan;
+	scan.addRange(times.data(), lowerTime, upperTime);
+	scan.addRange(altitudes.data(), 2, 7);
+	RangeSelection summarized;
+	summarized.addRange(times.data(), lowerTime, upperTime, &timeSummaries);
+	summarized.addRange(altitudes.data(), 2, 7, &altitudeSummaries);
+
+	std::vector<unsigned char> expected(count);
+	scan.select(expected.data(), count);
+	std::vector<unsigned char> selection(count);
+	summarized.select(selection.data(), count);
+
+	EXPECT_EQ(
+	    expected,
+	    selection
+	);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <Filter/DataDensityFilter/KMeansClustering.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * Find the cluster a point belongs to.
+ */
+static int findCluster(const KMeansClustering::Clusters& clusters, int point) {
+	for (size_t i = 0; i < clusters.members.size(); i++) {
+		for (size_t j = 0; j < clusters.members[i].size(); j++) {
+			if (clusters.members[i][j] == point) {
+				return i;
+			}
+		}
+	}
+	return -1;
+}
+
+TEST(TestKMeansClustering, SeparateGroups) {
+	std::vector<PointCoordinates> points;
+	points.push_back(PointCoordinates(0, 0, 0));
+	points.push_back(PointCoordinates(10, 10, 0));
+	points.push_back(PointCoordinates(0.2, 0, 0));
+	points.push_back(PointCoordinates(10.2, 10, 0));
+	points.push_back(PointCoordinates(0.1, 0.3, 0));
+
+	KMeansClustering::Clusters clusters = KMeansClustering::cluster(points, 2, false);
+
+	ASSERT_EQ(
+	    2,
+	    clusters.centroids.size()
+	);
+
+	int first = findCluster(clusters, 0);
+	int second = findCluster(clusters, 1);
+	ASSERT_NE(first, second);
+
+	std::vector<int> firstMembers;
+	firstMembers.push_back(0);
+	firstMembers.push_back(2);
+	firstMembers.push_back(4);
+
+	EXPECT_EQ(
+	    firstMembers,
+	    clusters.members[first]
+	);
+
+	EXPECT_NEAR(
+	    0.1,
+	    clusters.centroids[first].getX(),
+	    1e-6
+	);
+
+	EXPECT_NEAR(
+	    10.1,
+	    clusters.centroids[second].getX(),
+	    1e-6
+	);
+}
+
+TEST(TestKMeansClustering, ClusterAcrossDateLine) {
+	std::vector<PointCoordinates> points;
+	points.push_back(PointCoordinates(179.9, 10, 0));
+	points.push_back(PointCoordinates(0, 0, 0));
+	points.push_back(PointCoordinates(-179.9, 10, 0));
+	points.push_back(PointCoordinates(0.2, 0, 0));
+
+	KMeansClustering::Clusters clusters = KMeansClustering::cluster(points, 2, true);
+
+	ASSERT_EQ(
+	    2,
+	    clusters.centroids.size()
+	);
+
+	// Both points next to the date line are close to each other on the globe
+	int cluster = findCluster(clusters, 0);
+
+	EXPECT_EQ(
+	    cluster,
+	    findCluster(clusters, 2)
+	);
+
+	EXPECT_NEAR(
+	    180,
+	    std::abs(clusters.centroids[cluster].getX()),
+	    1e-3
+	);
+
+	EXPECT_NEAR(
+	    10,
+	    clusters.centroids[cluster].getY(),
+	    1e-3
+	);
+}
+
+TEST(TestKMeansClustering, LimitAmountOfClusters) {
+	std::vector<PointCoordinates> points;
+	points.push_back(PointCoordinates(1, 2, 3));
+	points.push_back(PointCoordinates(1, 2, 3));
+
+	KMeansClustering::Clusters clusters = KMeansClustering::cluster(points, 5, false);
+
+	ASSERT_EQ(
+	    1,
+	    clusters.centroids.size()
+	);
+
+	EXPECT_EQ(
+	    2,
+	    clusters.members[0].size()
+	);
+}
+
+TEST(TestKMeansClustering, LeaveOutNonFinitePoints) {
+	std::vector<PointCoordinates> points;
+	points.push_back(PointCoordinates(0, 0, 0));
+	points.push_back(PointCoordinates(std::numeric_limits<double>::quiet_NaN(), 0, 0));
+	points.push_back(PointCoordinates(10, 10, 0));
+	points.push_back(PointCoordinates(0, std::numeric_limits<double>::infinity(), 0));
+	points.push_back(PointCoordinates(0.2, 0, 0));
+
+	KMeansClustering::Clusters clusters = KMeansClustering::cluster(points, 2, false);
+
+	ASSERT_EQ(
+	    2,
+	    clusters.centroids.size()
+	);
+
+	EXPECT_EQ(
+	    -1,
+	    findCluster(clusters, 1)
+	);
+
+	EXPECT_EQ(
+	    -1,
+	    findCluster(clusters, 3)
+	);
+
+	EXPECT_EQ(
+	    findCluster(clusters, 0),
+	    findCluster(clusters, 4)
+	);
+
+	EXPECT_NE(
+	    findCluster(clusters, 0),
+	    findCluster(clusters, 2)
+	);
+}
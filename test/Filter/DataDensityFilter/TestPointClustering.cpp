@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <Filter/DataDensityFilter/PointClustering.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+TEST(TestPointClustering, AbsorbClosePoints) {
+	std::vector<PointCoordinates> points;
+	points.push_back(PointCoordinates(0, 0, 0));
+	points.push_back(PointCoordinates(5, 5, 0));
+	points.push_back(PointCoordinates(0.5, 0, 0));
+	points.push_back(PointCoordinates(5.5, 5, 0));
+	points.push_back(PointCoordinates(1.2, 0, 0));
+
+	std::vector<PointClustering::Cluster> clusters = PointClustering::absorbPoints(points, 1);
+
+	ASSERT_EQ(
+	    3,
+	    clusters.size()
+	);
+
+	EXPECT_EQ(
+	    0,
+	    clusters[0].centralPoint
+	);
+
+	EXPECT_EQ(
+	    std::vector<int>(1, 2),
+	    clusters[0].subordinatePoints
+	);
+
+	EXPECT_EQ(
+	    std::vector<int>(1, 3),
+	    clusters[1].subordinatePoints
+	);
+
+	// The last point is too far away from the first one even though it is close to the third one
+	EXPECT_EQ(
+	    4,
+	    clusters[2].centralPoint
+	);
+}
+
+TEST(TestPointClustering, EqualExhaustiveSearch) {
+	std::srand(42);
+
+	std::vector<PointCoordinates> points;
+	for (int i = 0; i < 500; i++) {
+		points.push_back(PointCoordinates(std::rand() % 1000 / 10.0, std::rand() % 1000 / 10.0,
+		                                  std::rand() % 10 / 10.0));
+	}
+
+	double absorptionDistance = 7.5;
+
+	// Compare against comparing every unabsorbed point with every other one
+	std::vector<bool> absorbed(points.size(), false);
+	std::vector<PointClustering::Cluster> expectedClusters;
+
+	for (size_t i = 0; i < points.size(); i++) {
+		if (absorbed[i]) {
+			continue;
+		}
+
+		PointClustering::Cluster cluster;
+		cluster.centralPoint = i;
+		absorbed[i] = true;
+
+		for (size_t j = 0; j < points.size(); j++) {
+			if (!absorbed[j] && points[i].getDistanceTo(points[j]) < absorptionDistance) {
+				cluster.subordinatePoints.push_back(j);
+				absorbed[j] = true;
+			}
+		}
+
+		expectedClusters.push_back(cluster);
+	}
+
+	std::vector<PointClustering::Cluster> clusters = PointClustering::absorbPoints(points,
+	        absorptionDistance);
+
+	ASSERT_EQ(
+	    expectedClusters.size(),
+	    clusters.size()
+	);
+
+	for (size_t i = 0; i < clusters.size(); i++) {
+		EXPECT_EQ(
+		    expectedClusters[i].centralPoint,
+		    clusters[i].centralPoint
+		);
+
+		EXPECT_EQ(
+		    expectedClusters[i].subordinatePoints,
+		    clusters[i].subordinatePoints
+		);
+	}
+}
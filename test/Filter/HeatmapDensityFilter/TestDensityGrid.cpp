@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <Filter/HeatmapDensityFilter/DensityGrid.hpp>
+
+#include <cmath>
+#include <vector>
+
+TEST(TestDensityGrid, CountNearestNodes) {
+	DensityGrid grid(0, 0, 1, 2, 3, 2);
+
+	double coordinates[] = {
+		0.1, 0.2, 0,
+		0.4, 0.9, 0,
+		1.6, 1.2, 0,
+		2, 2, 0,
+		7, -3, 0,
+		NAN, 1, 0
+	};
+	grid.count(coordinates, 6, 3);
+
+	EXPECT_EQ(
+	    2,
+	    grid.getDensity(0, 0)
+	);
+
+	EXPECT_EQ(
+	    2,
+	    grid.getDensity(2, 1)
+	);
+
+	// Points outside of the grid are counted at its border, invalid ones are ignored
+	EXPECT_EQ(
+	    1,
+	    grid.getDensity(2, 0)
+	);
+
+	int total = 0;
+	for (size_t i = 0; i < grid.getDensities().size(); i++) {
+		total += grid.getDensities()[i];
+	}
+
+	EXPECT_EQ(
+	    5,
+	    total
+	);
+}
+
+TEST(TestDensityGrid, CountInParallel) {
+	int amountOfPoints = 1 << 20;
+	std::vector<float> coordinates(amountOfPoints * 2);
+	for (int i = 0; i < amountOfPoints; i++) {
+		coordinates[i * 2] = i % 4;
+		coordinates[i * 2 + 1] = (i / 4) % 2;
+	}
+
+	DensityGrid grid(0, 0, 1, 1, 4, 2);
+	grid.count(coordinates.data(), amountOfPoints, 2);
+
+	for (int row = 0; row < 2; row++) {
+		for (int column = 0; column < 4; column++) {
+			EXPECT_EQ(
+			    amountOfPoints / 8,
+			    grid.getDensity(column, row)
+			);
+		}
+	}
+}
+
+TEST(TestDensityGrid, SmoothAcrossDateLine) {
+	// Nine columns from -180 to 180, of which the first and the last one lie on the same meridian
+	DensityGrid grid(-180, -90, 45, 45, 9, 5);
+
+	double coordinates[] = {
+		180, 0,
+		-180, 0
+	};
+	grid.count(coordinates, 2, 2);
+
+	std::vector<float> densities = grid.getSmoothedDensities(45, 0, true);
+
+	// Both points are spread evenly to both sides of the date line
+	EXPECT_NEAR(
+	    densities[2 * 9 + 1],
+	    densities[2 * 9 + 7],
+	    1e-6
+	);
+
+	EXPECT_GT(densities[2 * 9 + 1], 0);
+
+	EXPECT_FLOAT_EQ(
+	    densities[2 * 9 + 0],
+	    densities[2 * 9 + 8]
+	);
+
+	// Without vertical smoothing, the points stay on the equator
+	float total = 0;
+	for (int column = 0; column < 8; column++) {
+		total += densities[2 * 9 + column];
+	}
+
+	EXPECT_NEAR(
+	    2,
+	    total,
+	    1e-5
+	);
+
+	EXPECT_EQ(
+	    0,
+	    densities[1 * 9 + 4]
+	);
+}
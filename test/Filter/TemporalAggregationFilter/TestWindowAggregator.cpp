@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <Filter/TemporalAggregationFilter/WindowAggregator.hpp>
+
+#include <vtkPoints.h>
+#include <vtkPointData.h>
+#include <vtkFloatArray.h>
+
+#include <limits>
+
+/**
+ * Create the data of a time step with two points.
+ */
+static vtkSmartPointer<vtkPolyData> createTimeStep(float firstTemperature,
+        float secondTemperature) {
+	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+	points->InsertNextPoint(0, 0, 0);
+	points->InsertNextPoint(1, 0, 0);
+
+	vtkSmartPointer<vtkFloatArray> temperatures = vtkSmartPointer<vtkFloatArray>::New();
+	temperatures->SetName("temperatures");
+	temperatures->InsertNextValue(firstTemperature);
+	temperatures->InsertNextValue(secondTemperature);
+
+	vtkSmartPointer<vtkPolyData> dataSet = vtkSmartPointer<vtkPolyData>::New();
+	dataSet->SetPoints(points);
+	dataSet->GetPointData()->AddArray(temperatures);
+	return dataSet;
+}
+
+TEST(TestWindowAggregator, SlideMeanWindow) {
+	WindowAggregator aggregator;
+	aggregator.setDataSetAttributes(Data::TEMPERATURE, 1);
+	aggregator.setStatistic(WindowAggregator::MEAN, 50, true);
+
+	float temperatures[] = { 10, 14, 9, 21 };
+	for (int t = 0; t < 3; t++) {
+		ASSERT_TRUE(aggregator.addTimeStep(t, createTimeStep(temperatures[t], -temperatures[t])));
+	}
+
+	// Moving the window by one time step only needs the new one
+	aggregator.retainTimeSteps(1, 3);
+	EXPECT_EQ(
+	    3,
+	    aggregator.getMissingTimeStep(1, 3)
+	);
+	aggregator.addTimeStep(3, createTimeStep(temperatures[3], -temperatures[3]));
+
+	vtkSmartPointer<vtkPolyData> output = aggregator.getPolyData();
+	vtkFloatArray* averages = vtkFloatArray::SafeDownCast(output->GetPointData()->GetArray(
+	                              "Average Temperatures"));
+	ASSERT_TRUE(averages);
+
+	EXPECT_EQ(
+	    2,
+	    averages->GetNumberOfTuples()
+	);
+	EXPECT_FLOAT_EQ(
+	    (14 + 9 + 21) / 3.0,
+	    averages->GetValue(0)
+	);
+	EXPECT_FLOAT_EQ(
+	    -(14 + 9 + 21) / 3.0,
+	    averages->GetValue(1)
+	);
+}
+
+TEST(TestWindowAggregator, CalculateStatistics) {
+	float temperatures[] = { 10, 14, 9, 21, 3 };
+
+	WindowAggregator::Statistic statistics[] = {
+		WindowAggregator::MINIMUM, WindowAggregator::MAXIMUM, WindowAggregator::STANDARD_DEVIATION,
+		WindowAggregator::PERCENTILE
+	};
+	const char* arrayNames[] = {
+		"Minimum Temperatures", "Maximum Temperatures", "Temperature Standard Deviations",
+		"Temperature Percentiles"
+	};
+
+	// The statistics of the last four time steps after having slid past the first one
+	double expectedValues[] = { 3, 21, 6.6096520, 11.5 };
+
+	for (int s = 0; s < 4; s++) {
+		WindowAggregator aggregator;
+		aggregator.setDataSetAttributes(Data::TEMPERATURE, 1);
+		aggregator.setStatistic(statistics[s], 50, true);
+
+		for (int t = 0; t < 5; t++) {
+			aggregator.retainTimeSteps(t - 3, t);
+			aggregator.addTimeStep(t, createTimeStep(temperatures[t], 0));
+		}
+
+		vtkSmartPointer<vtkPolyData> output = aggregator.getPolyData();
+		vtkFloatArray* values = vtkFloatArray::SafeDownCast(output->GetPointData()->GetArray(
+		                            arrayNames[s]));
+		ASSERT_TRUE(values);
+
+		EXPECT_NEAR(
+		    expectedValues[s],
+		    values->GetValue(0),
+		    1e-5
+		);
+		EXPECT_NEAR(
+		    0,
+		    values->GetValue(1),
+		    1e-5
+		);
+	}
+}
+
+TEST(TestWindowAggregator, SkipMissingValues) {
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	float temperatures[] = { 10, nan, 9, 21, 3 };
+
+	WindowAggregator::Statistic statistics[] = {
+		WindowAggregator::MEAN, WindowAggregator::MINIMUM, WindowAggregator::PERCENTILE
+	};
+	const char* arrayNames[] = {
+		"Average Temperatures", "Minimum Temperatures", "Temperature Percentiles"
+	};
+
+	// The statistics of a window of three time steps with and without the missing value
+	double expectedValues[] = { 9.5, 9, 9.5 };
+	double expectedSlidValues[] = { 11, 3, 9 };
+
+	for (int s = 0; s < 3; s++) {
+		WindowAggregator aggregator;
+		aggregator.setDataSetAttributes(Data::TEMPERATURE, 1);
+		aggregator.setStatistic(statistics[s], 50, true);
+
+		for (int t = 0; t < 5; t++) {
+			aggregator.retainTimeSteps(t - 2, t);
+			aggregator.addTimeStep(t, createTimeStep(temperatures[t], nan));
+
+			if (t != 2 && t != 4) {
+				continue;
+			}
+
+			vtkSmartPointer<vtkPolyData> output = aggregator.getPolyData();
+			vtkFloatArray* values = vtkFloatArray::SafeDownCast(output->GetPointData()->GetArray(
+			                            arrayNames[s]));
+			ASSERT_TRUE(values);
+
+			// The point without any values is left out
+			EXPECT_EQ(
+			    1,
+			    values->GetNumberOfTuples()
+			);
+			EXPECT_NEAR(
+			    t == 2 ? expectedValues[s] : expectedSlidValues[s],
+			    values->GetValue(0),
+			    1e-5
+			);
+		}
+	}
+}
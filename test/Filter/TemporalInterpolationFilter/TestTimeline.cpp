@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <Filter/TemporalInterpolationFilter/Timeline.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TEST(TestTimeline, FillGaps) {
+	Timeline timeline(std::vector<Timeline::Interpolation>(1, Timeline::LINEAR),
+	                  std::vector<Timeline::Interpolation>(1, Timeline::NEAREST));
+
+	PointCoordinates first(1, 0, 0);
+	PointCoordinates second(0, 0, 0);
+
+	// The first point is missing in the second and third time step, the second point only occurs
+	// in the third one
+	timeline.addTimeStep(std::vector<PointCoordinates>(1, first),
+	                     std::vector<std::vector<float>>(1, std::vector<float>(1, 1)),
+	                     std::vector<std::vector<int>>(1, std::vector<int>(1, 10)));
+	timeline.addTimeStep(std::vector<PointCoordinates>(),
+	                     std::vector<std::vector<float>>(1),
+	                     std::vector<std::vector<int>>(1));
+	timeline.addTimeStep(std::vector<PointCoordinates>(1, second),
+	                     std::vector<std::vector<float>>(1, std::vector<float>(1, 5)),
+	                     std::vector<std::vector<int>>(1, std::vector<int>(1, 50)));
+	timeline.addTimeStep(std::vector<PointCoordinates>(1, first),
+	                     std::vector<std::vector<float>>(1, std::vector<float>(1, 4)),
+	                     std::vector<std::vector<int>>(1, std::vector<int>(1, 40)));
+	timeline.fill();
+
+	ASSERT_EQ(
+	    2,
+	    timeline.getAmountOfPoints()
+	);
+
+	// Points are sorted by their coordinates
+	EXPECT_EQ(
+	    second,
+	    timeline.getCoordinates()[0]
+	);
+
+	std::vector<float> firstValues;
+	std::vector<int> firstIntegers;
+	std::vector<float> secondValues;
+	for (int t = 0; t < timeline.getAmountOfTimeSteps(); t++) {
+		firstValues.push_back(timeline.getFloatValues(0, t)[1]);
+		firstIntegers.push_back(timeline.getIntegerValues(0, t)[1]);
+		secondValues.push_back(timeline.getFloatValues(0, t)[0]);
+	}
+
+	EXPECT_EQ(
+	    std::vector<float>({ 1, 2, 3, 4 }),
+	    firstValues
+	);
+
+	EXPECT_EQ(
+	    std::vector<int>({ 10, 10, 40, 40 }),
+	    firstIntegers
+	);
+
+	EXPECT_EQ(
+	    std::vector<float>({ 5, 5, 5, 5 }),
+	    secondValues
+	);
+}
+
+TEST(TestTimeline, KeepLastDuplicate) {
+	Timeline timeline(std::vector<Timeline::Interpolation>(1, Timeline::LINEAR),
+	                  std::vector<Timeline::Interpolation>());
+
+	std::vector<PointCoordinates> coordinates(2, PointCoordinates(3, 4, 0));
+	std::vector<float> values;
+	values.push_back(1);
+	values.push_back(2);
+
+	timeline.addTimeStep(coordinates, std::vector<std::vector<float>>(1, values),
+	                     std::vector<std::vector<int>>());
+	timeline.fill();
+
+	ASSERT_EQ(
+	    1,
+	    timeline.getAmountOfPoints()
+	);
+
+	EXPECT_EQ(
+	    2,
+	    timeline.getFloatValues(0, 0)[0]
+	);
+}
+
+TEST(TestTimeline, FillBearingGap) {
+	Timeline timeline(std::vector<Timeline::Interpolation>(1, Timeline::BEARING),
+	                  std::vector<Timeline::Interpolation>());
+
+	// The bearing turns from 350° to 10° through north, not through south
+	std::vector<PointCoordinates> coordinates(1, PointCoordinates(0, 0, 0));
+	timeline.addTimeStep(coordinates, std::vector<std::vector<float>>(1, std::vector<float>(1, 350)),
+	                     std::vector<std::vector<int>>());
+	timeline.addTimeStep(std::vector<PointCoordinates>(), std::vector<std::vector<float>>(1),
+	                     std::vector<std::vector<int>>());
+	timeline.addTimeStep(coordinates, std::vector<std::vector<float>>(1, std::vector<float>(1, 10)),
+	                     std::vector<std::vector<int>>());
+	timeline.fill();
+
+	float bearing = timeline.getFloatValues(0, 1)[0];
+	EXPECT_NEAR(
+	    0,
+	    std::min(bearing, 360 - bearing),
+	    0.001
+	);
+}
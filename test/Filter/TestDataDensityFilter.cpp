@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <Filter/DataDensityFilter.h>
+
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+
+TEST(TestDataDensityFilter, AverageClusterValues) {
+	// Three points close to each other and one point far away from them
+	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+	points->InsertNextPoint(0, 0, 0);
+	points->InsertNextPoint(0.1, 0, 0);
+	points->InsertNextPoint(0.2, 0, 0);
+	points->InsertNextPoint(10, 0, 0);
+
+	vtkSmartPointer<vtkCellArray> vertices = vtkSmartPointer<vtkCellArray>::New();
+	vertices->InsertNextCell(4);
+	for (int i = 0; i < 4; i++) {
+		vertices->InsertCellPoint(i);
+	}
+
+	vtkSmartPointer<vtkFloatArray> values = vtkSmartPointer<vtkFloatArray>::New();
+	values->SetName("values");
+	values->InsertNextValue(1);
+	values->InsertNextValue(2);
+	values->InsertNextValue(6);
+	values->InsertNextValue(5);
+
+	vtkSmartPointer<vtkPolyData> inputDataSet = vtkSmartPointer<vtkPolyData>::New();
+	inputDataSet->SetPoints(points);
+	inputDataSet->SetVerts(vertices);
+	inputDataSet->GetPointData()->AddArray(values);
+
+	// Absorb points closer than half a unit to a central point
+	vtkSmartPointer<DataDensityFilter> filter = vtkSmartPointer<DataDensityFilter>::New();
+	filter->SetInputData(inputDataSet);
+	filter->setKMeansEnabled(false);
+	filter->setDataPercentage(0.05);
+	filter->Update();
+
+	vtkPolyData* outputDataSet = vtkPolyData::SafeDownCast(filter->GetOutputDataObject(0));
+	ASSERT_TRUE(outputDataSet);
+
+	EXPECT_EQ(
+	    2,
+	    outputDataSet->GetNumberOfPoints()
+	);
+
+	vtkFloatArray* averages = vtkFloatArray::SafeDownCast(
+	                              outputDataSet->GetPointData()->GetArray("values"));
+	ASSERT_TRUE(averages);
+
+	// Each point of a cluster has the same weight
+	EXPECT_FLOAT_EQ(
+	    3,
+	    averages->GetValue(0)
+	);
+
+	EXPECT_FLOAT_EQ(
+	    5,
+	    averages->GetValue(1)
+	);
+}
@@ -4,6 +4,7 @@
 #include <Reader/vtkKronosReader.h>
 #include <Utils/Math/Vector3.hpp>
 
+#include <vtkImageData.h>
 #include <vtkIntArray.h>
 #include <vtkInformation.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
@@ -56,3 +57,41 @@ TEST(TestDensityHeatmapFilter, TestTwitterData) {
 		}
 	}
 }
+
+TEST(TestDensityHeatmapFilter, TestImageOutput) {
+	// Read some test data
+	vtkSmartPointer<vtkKronosReader> kronosReader = vtkSmartPointer<vtkKronosReader>::New();
+	kronosReader->SetFileName("res/test-data/temporal-interpolation-test/twitter-test-data.kJson",
+	                          false);
+
+	// Set up the filter to output an image
+	vtkSmartPointer<HeatmapDensityFilter> filter = HeatmapDensityFilter::New();
+	filter->SetInputConnection(kronosReader->GetOutputPort());
+	filter->GetInputInformation()->Set(Data::VTK_DATA_TYPE(), Data::TWEETS);
+	filter->GetInputInformation()->Set(Data::VTK_TIME_RESOLUTION(), 1);
+	filter->setHorizontalHeatmapResolution(1);
+	filter->setVerticalHeatmapResolution(1);
+	filter->setImageOutputEnabled(true);
+	filter->GetOutputInformation(0)->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), 1);
+	filter->Update();
+
+	vtkSmartPointer<vtkImageData> image = vtkImageData::SafeDownCast(
+	        filter->GetOutputDataObject(0));
+	ASSERT_TRUE(image);
+
+	int dimensions[3];
+	image->GetDimensions(dimensions);
+	EXPECT_EQ(2, dimensions[0]);
+	EXPECT_EQ(2, dimensions[1]);
+	EXPECT_EQ(1, dimensions[2]);
+
+	vtkSmartPointer<vtkIntArray> densityArray = vtkIntArray::SafeDownCast(
+	            image->GetPointData()->GetArray("density"));
+	ASSERT_TRUE(densityArray);
+
+	// The image stores its pixels row by row
+	QList<int> densityValues = QList<int>() << 2 << 3 << 2 << 1;
+	for (int i = 0; i < 4; i++) {
+		EXPECT_EQ(densityValues[i], densityArray->GetTuple1(i));
+	}
+}
@@ -10,13 +10,12 @@
 #include <Filter/PrecipitationTypeFilter.h>
 #include <Reader/DataReader/JsonReader.hpp>
 #include <Reader/DataReader/JsonReaderFactory.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
 #include <Reader/DataReader/Data.hpp>
 
 #include <QList>
 
 void testDataSet(vtkSmartPointer<vtkUnstructuredGrid> dataSet, int expectedPointAmount,
-                 QList<PrecipitationDataPoint::PrecipitationType> disallowedPrecipitationTypes) {
+                 QList<Data::PrecipitationType> disallowedPrecipitationTypes) {
 	// Check the data set and its amount of points
 	ASSERT_TRUE(dataSet);
 	EXPECT_EQ(expectedPointAmount, dataSet->GetNumberOfPoints());
@@ -31,7 +30,7 @@ void testDataSet(vtkSmartPointer<vtkUnstructuredGrid> dataSet, int expectedPoint
 
 	// Ensure that no point has a precipitation type that is in the list of disallowed types
 	for (int i = 0; i < expectedPointAmount; i++) {
-		QList<PrecipitationDataPoint::PrecipitationType>::iterator type;
+		QList<Data::PrecipitationType>::iterator type;
 		for (type = disallowedPrecipitationTypes.begin(); type != disallowedPrecipitationTypes.end();
 		        ++type) {
 			EXPECT_NE(*type, precipitationTypeArray->GetTuple1(i));
@@ -58,46 +57,46 @@ TEST(TestPrecipitationTypeFilter, TestFilter) {
 	// Test the filter's output without excluding any precipitation type
 	vtkSmartPointer<vtkUnstructuredGrid> outputDataSet = vtkSmartPointer<vtkUnstructuredGrid>::New();
 	outputDataSet->ShallowCopy(filter->GetOutput());
-	testDataSet(outputDataSet, totalNumberOfPoints, QList<PrecipitationDataPoint::PrecipitationType>());
+	testDataSet(outputDataSet, totalNumberOfPoints, QList<Data::PrecipitationType>());
 
 	// Exclude data points without precipitation type information
 	filter->enableUndefined(0);
 	filter->Update();
 	outputDataSet->ShallowCopy(filter->GetOutput());
 	testDataSet(outputDataSet, totalNumberOfPoints - (80 * 1),
-	            QList<PrecipitationDataPoint::PrecipitationType>() << PrecipitationDataPoint::NONE);
+	            QList<Data::PrecipitationType>() << Data::NONE);
 
 	// Additionally, exclude data points with the precipitation type rain
 	filter->enableRain(0);
 	filter->Update();
 	outputDataSet->ShallowCopy(filter->GetOutput());
 	testDataSet(outputDataSet, totalNumberOfPoints - (80 * 2),
-	            QList<PrecipitationDataPoint::PrecipitationType>() << PrecipitationDataPoint::NONE <<
-	            PrecipitationDataPoint::RAIN);
+	            QList<Data::PrecipitationType>() << Data::NONE <<
+	            Data::RAIN);
 
 	// Additionally, exclude data points with the precipitation type snow
 	filter->enableSnow(0);
 	filter->Update();
 	outputDataSet->ShallowCopy(filter->GetOutput());
 	testDataSet(outputDataSet, totalNumberOfPoints - (80 * 3),
-	            QList<PrecipitationDataPoint::PrecipitationType>() << PrecipitationDataPoint::NONE <<
-	            PrecipitationDataPoint::RAIN << PrecipitationDataPoint::SNOW);
+	            QList<Data::PrecipitationType>() << Data::NONE <<
+	            Data::RAIN << Data::SNOW);
 
 	// Additionally, exclude data points with the precipitation type sleet
 	filter->enableSleet(0);
 	filter->Update();
 	outputDataSet->ShallowCopy(filter->GetOutput());
 	testDataSet(outputDataSet, totalNumberOfPoints - (80 * 4),
-	            QList<PrecipitationDataPoint::PrecipitationType>() << PrecipitationDataPoint::NONE <<
-	            PrecipitationDataPoint::RAIN << PrecipitationDataPoint::SNOW << PrecipitationDataPoint::SLEET);
+	            QList<Data::PrecipitationType>() << Data::NONE <<
+	            Data::RAIN << Data::SNOW << Data::SLEET);
 
 	// Additionally, exclude data points with the precipitation type hail, therefore eliminating all data points
 	filter->enableHail(0);
 	filter->Update();
 	outputDataSet->ShallowCopy(filter->GetOutput());
-	testDataSet(outputDataSet, 0, QList<PrecipitationDataPoint::PrecipitationType>() <<
-	            PrecipitationDataPoint::NONE << PrecipitationDataPoint::RAIN << PrecipitationDataPoint::SNOW <<
-	            PrecipitationDataPoint::SLEET << PrecipitationDataPoint::HAIL);
+	testDataSet(outputDataSet, 0, QList<Data::PrecipitationType>() <<
+	            Data::NONE << Data::RAIN << Data::SNOW <<
+	            Data::SLEET << Data::HAIL);
 
 	// Finally, enable everything again, which should give us back all points we started with in the first place
 	filter->enableUndefined(1);
@@ -107,5 +106,5 @@ TEST(TestPrecipitationTypeFilter, TestFilter) {
 	filter->enableHail(1);
 	filter->Update();
 	outputDataSet->ShallowCopy(filter->GetOutput());
-	testDataSet(outputDataSet, totalNumberOfPoints, QList<PrecipitationDataPoint::PrecipitationType>());
+	testDataSet(outputDataSet, totalNumberOfPoints, QList<Data::PrecipitationType>());
 }
@@ -3,11 +3,15 @@
 #include <Filter/TemporalAggregationFilter.h>
 #include <Reader/DataReader/JsonReader.hpp>
 #include <Reader/DataReader/JsonReaderFactory.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
 #include <Reader/DataReader/Data.hpp>
+#include <Reader/vtkKronosReader.h>
 
 #include <vtkFloatArray.h>
 #include <vtkInformation.h>
+#include <vtkPointData.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkTransform.h>
+#include <vtkTransformFilter.h>
 
 TEST(TestTemporalAggregationFilter, TestTemperatureData) {
 	// Read some test data
@@ -115,8 +119,97 @@ TEST(TestTemporalAggregationFilter, TestWindData) {
 	EXPECT_FLOAT_EQ(0.782, *windSpeedsArray->GetTuple(0));
 	EXPECT_FLOAT_EQ(0.7766667, *windSpeedsArray->GetTuple(1));
 
-	// Secondly, test the wind directions
+	// Secondly, test the wind directions, which are averaged as vectors
 	EXPECT_EQ(2, windDirectionsArray->GetNumberOfTuples());
-	EXPECT_FLOAT_EQ(244, *windDirectionsArray->GetTuple(0));
-	EXPECT_FLOAT_EQ(28, *windDirectionsArray->GetTuple(1));
-}
\ No newline at end of file
+	EXPECT_NEAR(248.00297, *windDirectionsArray->GetTuple(0), 0.001);
+	EXPECT_NEAR(27.801916, *windDirectionsArray->GetTuple(1), 0.001);
+}
+
+TEST(TestTemporalAggregationFilter, TestPrecipitationDataInOneRequest) {
+	// Read some test data, letting the filter request all time steps from the reader at once
+	vtkSmartPointer<vtkKronosReader> kronosReader = vtkSmartPointer<vtkKronosReader>::New();
+	kronosReader->SetFileName("res/test-data/temporal-aggregation-test/precipitation-test-data.kJson",
+	                          false);
+
+	// Set up the filter and its input
+	vtkSmartPointer<TemporalAggregationFilter> filter = TemporalAggregationFilter::New();
+	filter->SetInputConnection(kronosReader->GetOutputPort());
+	filter->Update();
+
+	// Run the filter on the input data
+	vtkSmartPointer<vtkPolyData> outputDataSet = vtkSmartPointer<vtkPolyData>::New();
+	outputDataSet->ShallowCopy(filter->GetPolyDataOutput());
+
+	ASSERT_TRUE(outputDataSet);
+
+	// Extract the filter's output
+	vtkSmartPointer<vtkDataArray> abstractPrecipitationArray = outputDataSet->GetPointData()
+	        ->GetArray("Accumulated Precipitation Amounts");
+	vtkSmartPointer<vtkFloatArray> precipitationArray = vtkFloatArray::SafeDownCast(
+	            abstractPrecipitationArray);
+	ASSERT_TRUE(precipitationArray);
+
+	// Test the data that the filter has produced, each rate lasting until the next one is known
+	EXPECT_EQ(2, precipitationArray->GetNumberOfTuples());
+	EXPECT_FLOAT_EQ(26.67, *precipitationArray->GetTuple(0));
+	EXPECT_FLOAT_EQ(27.36, *precipitationArray->GetTuple(1));
+}
+
+TEST(TestTemporalAggregationFilter, TestSingleTimeStepAfterOneRequest) {
+	vtkSmartPointer<vtkKronosReader> kronosReader = vtkSmartPointer<vtkKronosReader>::New();
+	kronosReader->SetFileName("res/test-data/temporal-aggregation-test/precipitation-test-data.kJson",
+	                          false);
+
+	// Let the filter request all time steps from the reader at once
+	vtkSmartPointer<TemporalAggregationFilter> filter = TemporalAggregationFilter::New();
+	filter->SetInputConnection(kronosReader->GetOutputPort());
+	filter->Update();
+
+	// Connect another consumer to the same reader, which asks for a single time step only
+	vtkSmartPointer<vtkTransform> transform = vtkSmartPointer<vtkTransform>::New();
+	vtkSmartPointer<vtkTransformFilter> consumer = vtkSmartPointer<vtkTransformFilter>::New();
+	consumer->SetTransform(transform);
+	consumer->SetInputConnection(kronosReader->GetOutputPort());
+	consumer->GetOutputInformation(0)->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), 2);
+	consumer->Update();
+
+	vtkSmartPointer<vtkPointSet> outputDataSet = consumer->GetOutput();
+	ASSERT_TRUE(outputDataSet);
+
+	// Only the two data points of the requested time step are passed on
+	EXPECT_EQ(
+	    2,
+	    outputDataSet->GetNumberOfPoints()
+	);
+}
+
+TEST(TestTemporalAggregationFilter, TestOneRequestAfterSingleTimeStep) {
+	vtkSmartPointer<vtkKronosReader> kronosReader = vtkSmartPointer<vtkKronosReader>::New();
+	kronosReader->SetFileName("res/test-data/temporal-aggregation-test/precipitation-test-data.kJson",
+	                          false);
+
+	// Let the reader produce a single time step first, as it does when shown on its own
+	kronosReader->GetOutputInformation(0)->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(),
+	        2);
+	kronosReader->Update();
+	ASSERT_TRUE(kronosReader->GetOutputDataObject(0)->GetInformation()->Has(
+	                vtkDataObject::DATA_TIME_STEP()));
+
+	vtkSmartPointer<TemporalAggregationFilter> filter = TemporalAggregationFilter::New();
+	filter->SetInputConnection(kronosReader->GetOutputPort());
+	filter->Update();
+
+	// The reader has been run again to provide all time steps at once
+	EXPECT_FALSE(kronosReader->GetOutputDataObject(0)->GetInformation()->Has(
+	                 vtkDataObject::DATA_TIME_STEP()));
+
+	vtkSmartPointer<vtkDataArray> abstractPrecipitationArray = filter->GetPolyDataOutput()
+	        ->GetPointData()->GetArray("Accumulated Precipitation Amounts");
+	vtkSmartPointer<vtkFloatArray> precipitationArray = vtkFloatArray::SafeDownCast(
+	            abstractPrecipitationArray);
+	ASSERT_TRUE(precipitationArray);
+
+	EXPECT_EQ(2, precipitationArray->GetNumberOfTuples());
+	EXPECT_FLOAT_EQ(26.67, *precipitationArray->GetTuple(0));
+	EXPECT_FLOAT_EQ(27.36, *precipitationArray->GetTuple(1));
+}
@@ -2,7 +2,7 @@
 
 #include <Filter/TemporalInterpolationFilter.h>
 #include <Filter/HeatmapDensityFilter.h>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
+#include <Reader/DataReader/Data.hpp>
 #include <Reader/vtkKronosReader.h>
 #include <Utils/Math/Vector3.hpp>
 
@@ -28,13 +28,13 @@ TEST(TestTemporalInterpolationFilter, TestPrecipitationData) {
 
 	// Test integral values
 	QList<float> precipitationRatesOfFirstPoint = QList<float>() << 4.45 << 7.86 << 3.72 << 4.76;
-	QList<int> precipitationTypesOfFirstPoint = QList<int>() << PrecipitationDataPoint::RAIN <<
-	        PrecipitationDataPoint::SNOW << PrecipitationDataPoint::SLEET << PrecipitationDataPoint::SNOW;
+	QList<int> precipitationTypesOfFirstPoint = QList<int>() << Data::RAIN <<
+	        Data::SNOW << Data::SLEET << Data::SNOW;
 
 	QList<float> precipitationRatesOfSecondPoint = QList<float>() << 6.49 << 6.1133332 << 5.7366667 <<
 	        5.36;
-	QList<int> precipitationTypesOfSecondPoint = QList<int>() << PrecipitationDataPoint::NONE <<
-	        PrecipitationDataPoint::NONE << PrecipitationDataPoint::HAIL << PrecipitationDataPoint::HAIL;
+	QList<int> precipitationTypesOfSecondPoint = QList<int>() << Data::NONE <<
+	        Data::NONE << Data::HAIL << Data::HAIL;
 
 	for (int t = 0; t < precipitationRatesOfFirstPoint.size() - 1; t++) {
 		filter->GetOutputInformation(0)->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), t);
@@ -82,10 +82,10 @@ TEST(TestTemporalInterpolationFilter, TestPrecipitationData) {
 	ASSERT_TRUE(precipitationTypeArray);
 
 	EXPECT_FLOAT_EQ(6.1549997, precipitationRateArray->GetTuple1(0));
-	EXPECT_FLOAT_EQ(PrecipitationDataPoint::SNOW, precipitationTypeArray->GetTuple1(0));
+	EXPECT_FLOAT_EQ(Data::SNOW, precipitationTypeArray->GetTuple1(0));
 
 	EXPECT_FLOAT_EQ(6.3016663, precipitationRateArray->GetTuple1(1));
-	EXPECT_FLOAT_EQ(PrecipitationDataPoint::NONE, precipitationTypeArray->GetTuple1(1));
+	EXPECT_FLOAT_EQ(Data::NONE, precipitationTypeArray->GetTuple1(1));
 }
 
 TEST(TestTemporalInterpolationFilter, TestTemperatureData) {
@@ -204,6 +204,10 @@ TEST(TestTemporalInterpolationFilter, TestWindData) {
 	vtkSmartPointer<vtkFloatArray> windBearingArray = vtkFloatArray::SafeDownCast(
 	            outputDataSet->GetPointData()->GetArray("directions"));
 	ASSERT_TRUE(windBearingArray);
+
+	// Bearings are blended as vectors
+	EXPECT_NEAR(63, windBearingArray->GetTuple1(0), 0.001);
+	EXPECT_NEAR(323, windBearingArray->GetTuple1(1), 0.001);
 }
 
 TEST(TestTemporalInterpolationFilter, TestCloudCoverageData) {
@@ -301,3 +305,36 @@ TEST(TestTemporalInterpolationFilter, TestTwitterDensityData) {
 	EXPECT_FLOAT_EQ(3.5, densityArray->GetTuple1(2));
 	EXPECT_FLOAT_EQ(3, densityArray->GetTuple1(3));
 }
+
+TEST(TestTemporalInterpolationFilter, KeepEarlierOutputs) {
+	vtkSmartPointer<vtkKronosReader> kronosReader = vtkSmartPointer<vtkKronosReader>::New();
+	kronosReader->SetFileName("res/test-data/temporal-interpolation-test/precipitation-test-data.kJson",
+	                          false);
+
+	vtkSmartPointer<TemporalInterpolationFilter> filter = TemporalInterpolationFilter::New();
+	filter->SetInputConnection(kronosReader->GetOutputPort());
+	filter->GetInputInformation()->Set(Data::VTK_DATA_TYPE(), Data::TEMPERATURE);
+	filter->GetInputInformation()->Set(Data::VTK_TIME_RESOLUTION(), 1);
+
+	// Keep the output of the first time step, as a cache of rendered frames does
+	filter->GetOutputInformation(0)->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), 0);
+	filter->Update();
+	vtkSmartPointer<vtkPolyData> firstOutput = vtkSmartPointer<vtkPolyData>::New();
+	firstOutput->ShallowCopy(filter->GetPolyDataOutput());
+
+	filter->GetOutputInformation(0)->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), 1);
+	filter->Update();
+	vtkSmartPointer<vtkPolyData> secondOutput = vtkSmartPointer<vtkPolyData>::New();
+	secondOutput->ShallowCopy(filter->GetPolyDataOutput());
+
+	vtkSmartPointer<vtkFloatArray> firstRates = vtkFloatArray::SafeDownCast(
+	            firstOutput->GetPointData()->GetArray("precipitationRates"));
+	ASSERT_TRUE(firstRates);
+	vtkSmartPointer<vtkFloatArray> secondRates = vtkFloatArray::SafeDownCast(
+	            secondOutput->GetPointData()->GetArray("precipitationRates"));
+	ASSERT_TRUE(secondRates);
+
+	// The kept output still holds the values of its own time step
+	EXPECT_FLOAT_EQ(4.45, firstRates->GetTuple1(0));
+	EXPECT_FLOAT_EQ(7.86, secondRates->GetTuple1(0));
+}
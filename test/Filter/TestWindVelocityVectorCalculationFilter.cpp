@@ -6,7 +6,6 @@
 #include <Reader/vtkKronosReader.h>
 #include <Reader/DataReader/JsonReader.hpp>
 #include <Reader/DataReader/JsonReaderFactory.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
 #include <Reader/DataReader/Data.hpp>
 
 #include <vtkFloatArray.h>
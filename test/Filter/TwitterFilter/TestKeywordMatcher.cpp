@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <Filter/TwitterFilter/KeywordMatcher.hpp>
+
+TEST(TestKeywordMatcher, FindContainedKeywords) {
+	KeywordMatcher matcher;
+	matcher.setKeywords(QStringList() << "#Kronos" << "she" << "hers" << "Ärger", false);
+
+	EXPECT_TRUE(matcher.isContainedIn("Visualizing tweets with #kronos"));
+	EXPECT_TRUE(matcher.isContainedIn("USHERS"));
+	EXPECT_TRUE(matcher.isContainedIn("Viel ärger heute"));
+	EXPECT_TRUE(matcher.isContainedIn("VIEL ÄRGER HEUTE"));
+	EXPECT_FALSE(matcher.isContainedIn("#kron os"));
+	EXPECT_FALSE(matcher.isContainedIn("Viel Arger heute"));
+	EXPECT_FALSE(matcher.isContainedIn(""));
+}
+
+TEST(TestKeywordMatcher, IgnoreSpaces) {
+	KeywordMatcher matcher;
+	matcher.setKeywords(QStringList() << "JohnDoe", true);
+
+	EXPECT_TRUE(matcher.isContainedIn("The real John Doe"));
+	EXPECT_TRUE(matcher.isEqualTo("john doe"));
+	EXPECT_FALSE(matcher.isEqualTo("The real John Doe"));
+}
+
+TEST(TestKeywordMatcher, MatchEmptyKeywords) {
+	KeywordMatcher matcher;
+	EXPECT_TRUE(matcher.isEmpty());
+
+	matcher.setKeywords(QStringList() << "a" << "", false);
+	EXPECT_FALSE(matcher.isEmpty());
+	EXPECT_TRUE(matcher.isContainedIn("xyz"));
+	EXPECT_TRUE(matcher.isEqualTo(""));
+	EXPECT_FALSE(matcher.isEqualTo("xyz"));
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <Reader/DataReader/BinarySnapshot.hpp>
+#include <Reader/DataReader/JsonReaderFactory.hpp>
+#include <Reader/DataReader/JsonReader.hpp>
+
+#include <Utils/Config/Configuration.hpp>
+
+#include <vtkSmartPointer.h>
+#include <vtkPointData.h>
+#include <vtkStringArray.h>
+
+TEST(TestBinarySnapshot, LoadSavedSnapshot) {
+	std::unique_ptr<JsonReader> jsonReader =
+	    JsonReaderFactory::createReader("res/test-data/tweets.json");
+	ASSERT_TRUE(BinarySnapshot::save(*jsonReader, "res/test-data/tweets.json"));
+
+	std::unique_ptr<JsonReader> snapshotReader = BinarySnapshot::load("res/test-data/tweets.json");
+	ASSERT_TRUE(snapshotReader != nullptr);
+
+	EXPECT_EQ(
+	    jsonReader->getDataType(),
+	    snapshotReader->getDataType()
+	);
+
+	EXPECT_EQ(
+	    jsonReader->getAmountOfTimeSteps(),
+	    snapshotReader->getAmountOfTimeSteps()
+	);
+
+	int maximumPriority = Configuration::getInstance().getInteger("dataReader.maximumPriority");
+	vtkSmartPointer<vtkPolyData> polyData = snapshotReader->getVtkDataSet(maximumPriority);
+
+	EXPECT_EQ(
+	    3,
+	    polyData->GetNumberOfPoints()
+	);
+
+	vtkSmartPointer<vtkStringArray> authorsArray = vtkStringArray::SafeDownCast(
+	            polyData->GetPointData()->GetAbstractArray("authors")
+	        );
+	ASSERT_TRUE(authorsArray);
+
+	EXPECT_EQ(
+	    "elonmusk",
+	    authorsArray->GetValue(1)
+	);
+
+	// The time index is restored along with the data points
+	EXPECT_EQ(
+	    1,
+	    snapshotReader->getVtkDataSet(maximumPriority, 86)->GetNumberOfPoints()
+	);
+}
+
+TEST(TestBinarySnapshot, IgnoreMissingSnapshot) {
+	EXPECT_TRUE(BinarySnapshot::load("res/test-data/cities.json") == nullptr);
+}
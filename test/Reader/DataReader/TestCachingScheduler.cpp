@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <Reader/DataReader/CachingScheduler.hpp>
+
+#include <cstdlib>
+#include <set>
+#include <utility>
+
+TEST(TestCachingScheduler, HandOutSlicesAroundFocus) {
+	CachingScheduler scheduler(10, 100);
+	scheduler.setFocus(4, 50);
+
+	int zoomLevel;
+	int time;
+
+	// The focus itself comes first
+	ASSERT_TRUE(scheduler.next(zoomLevel, time));
+	EXPECT_EQ(
+	    4,
+	    zoomLevel
+	);
+	EXPECT_EQ(
+	    50,
+	    time
+	);
+
+	// Followed by its direct neighbours
+	for (int i = 0; i < 4; i++) {
+		ASSERT_TRUE(scheduler.next(zoomLevel, time));
+		EXPECT_EQ(
+		    1,
+		    std::abs(zoomLevel - 4) + std::abs(time - 50)
+		);
+	}
+}
+
+TEST(TestCachingScheduler, HandOutEachSliceOnce) {
+	CachingScheduler scheduler(3, 20);
+	scheduler.setFocus(1, 10);
+
+	std::set<std::pair<int, int>> slices;
+	int zoomLevel;
+	int time;
+
+	while (scheduler.next(zoomLevel, time)) {
+		EXPECT_TRUE(slices.insert(std::make_pair(zoomLevel, time)).second);
+
+		// Moving the focus must neither repeat nor skip slices
+		if (slices.size() == 30) {
+			scheduler.setFocus(0, 0);
+		}
+	}
+
+	EXPECT_EQ(
+	    (size_t) 80,
+	    slices.size()
+	);
+}
+
+TEST(TestCachingScheduler, StopHandingOutSlices) {
+	CachingScheduler scheduler(10, 1);
+
+	int zoomLevel;
+	int time;
+
+	EXPECT_TRUE(scheduler.next(zoomLevel, time));
+	scheduler.stop();
+	EXPECT_FALSE(scheduler.next(zoomLevel, time));
+}
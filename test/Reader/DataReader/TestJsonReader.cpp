@@ -5,15 +5,14 @@
 
 #include <Reader/DataReader/JsonReaderFactory.hpp>
 #include <Reader/DataReader/JsonReader.hpp>
-#include <Reader/DataReader/DataPoints/DataPoint.hpp>
-#include <Reader/DataReader/DataPoints/NonTemporalDataPoints/CityDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/TweetDataPoint.hpp>
-#include <Reader/DataReader/DataPoints/TemporalDataPoints/PrecipitationDataPoint.hpp>
+#include <Reader/DataReader/PointDataSet.hpp>
+#include <Reader/DataReader/Data.hpp>
 
 #include <Utils/Config/Configuration.hpp>
 
 #include <vtkSmartPointer.h>
 #include <vtkPointData.h>
+#include <vtkFieldData.h>
 #include <vtkStringArray.h>
 #include <vtkAbstractArray.h>
 #include <vtkDataArray.h>
@@ -24,71 +23,178 @@
 TEST(TestJsonReader, ReadCityData) {
 	std::unique_ptr<JsonReader> cityReader =
 	    JsonReaderFactory::createReader("res/test-data/cities.json");
+	const PointDataSet& dataPoints = cityReader->pointDataSet;
+
 	EXPECT_EQ(
 	    4,
-	    cityReader->pointDataSet.getDataPoints().size()
+	    dataPoints.size()
 	);
 
-	const CityDataPoint* firstDataPoint = dynamic_cast<const CityDataPoint*>(
-	        cityReader->pointDataSet.getDataPoints().at(1)
-	                                      );
-
 	EXPECT_EQ(
 	    "Los Angeles",
-	    firstDataPoint->getName().toStdString()
+	    dataPoints.getNames()[1]
 	);
 
-	EXPECT_EQ(
+	EXPECT_FLOAT_EQ(
 	    34.052223,
-	    firstDataPoint->getCoordinate().lat()
+	    dataPoints.getLatitudes()[1]
 	);
 
-	EXPECT_EQ(
+	EXPECT_FLOAT_EQ(
 	    -118.242775,
-	    firstDataPoint->getCoordinate().lon()
+	    dataPoints.getLongitudes()[1]
+	);
+
+	// Points keep the order of the file with children following their parent
+	EXPECT_EQ(
+	    "San Francisco",
+	    dataPoints.getNames()[2]
+	);
+
+	EXPECT_EQ(
+	    1,
+	    dataPoints.getPriorities()[2]
 	);
 }
 
 TEST(TestJsonReader, ReadTwitterData) {
 	std::unique_ptr<JsonReader> twitterReader =
 	    JsonReaderFactory::createReader("res/test-data/tweets.json");
+	const PointDataSet& dataPoints = twitterReader->pointDataSet;
+
 	EXPECT_EQ(
 	    3,
-	    twitterReader->pointDataSet.getDataPoints().size()
+	    dataPoints.size()
 	);
 
-	const TweetDataPoint* testDataPoint = dynamic_cast<const TweetDataPoint*>(
-	        twitterReader->pointDataSet.getDataPoints().at(1)
-	                                      );
-
 	EXPECT_EQ(
 	    "elonmusk",
-	    testDataPoint->getAuthor().toStdString()
+	    dataPoints.getAuthorDictionary().getString(dataPoints.getAuthorIds()[1])
+	);
+
+	// Only the authors themselves are interned
+	EXPECT_EQ(
+	    3,
+	    dataPoints.getAuthorDictionary().size()
 	);
 
 	EXPECT_EQ(
 	    "Is this working?",
-	    testDataPoint->getContent().toStdString()
+	    dataPoints.getContents()[1]
 	);
 
 	EXPECT_EQ(
 	    3,
-	    testDataPoint->getNumberOfRetweets()
+	    dataPoints.getNumberOfRetweets()[1]
 	);
 
 	EXPECT_EQ(
 	    1439280065,
-	    testDataPoint->getTimestamp()
+	    dataPoints.getTimestamps()[1]
 	);
 
-	EXPECT_EQ(
+	EXPECT_FLOAT_EQ(
 	    34.052223,
-	    testDataPoint->getCoordinate().lat()
+	    dataPoints.getLatitudes()[1]
 	);
 
-	EXPECT_EQ(
+	EXPECT_FLOAT_EQ(
 	    -118.242775,
-	    testDataPoint->getCoordinate().lon()
+	    dataPoints.getLongitudes()[1]
+	);
+
+	// Columns of other data types stay empty
+	EXPECT_TRUE(dataPoints.getNames().empty());
+	EXPECT_TRUE(dataPoints.getTemperatures().empty());
+}
+
+TEST(TestJsonReader, StreamingEqualsDocumentIngestion) {
+	std::unique_ptr<JsonReader> streamingReader =
+	    JsonReaderFactory::createReader("res/test-data/tweets.json", true);
+	std::unique_ptr<JsonReader> documentReader =
+	    JsonReaderFactory::createReader("res/test-data/tweets.json", false);
+
+	const PointDataSet& streamedPoints = streamingReader->pointDataSet;
+	const PointDataSet& documentPoints = documentReader->pointDataSet;
+
+	ASSERT_EQ(
+	    documentPoints.size(),
+	    streamedPoints.size()
+	);
+
+	// Both readers should hold the same points in the same order
+	EXPECT_EQ(
+	    documentPoints.getPriorities(),
+	    streamedPoints.getPriorities()
+	);
+
+	EXPECT_EQ(
+	    documentPoints.getTimestamps(),
+	    streamedPoints.getTimestamps()
+	);
+
+	// The IDs of interned strings depend on the order the points were completed in
+	for (int i = 0; i < documentPoints.size(); i++) {
+		EXPECT_EQ(
+		    documentPoints.getAuthorDictionary().getString(documentPoints.getAuthorIds()[i]),
+		    streamedPoints.getAuthorDictionary().getString(streamedPoints.getAuthorIds()[i])
+		);
+	}
+
+	EXPECT_EQ(
+	    documentPoints.getLatitudes(),
+	    streamedPoints.getLatitudes()
+	);
+
+	EXPECT_EQ(
+	    documentReader->getAmountOfTimeSteps(),
+	    streamingReader->getAmountOfTimeSteps()
+	);
+}
+
+TEST(TestJsonReader, ExtractTimeStepSlices) {
+	std::unique_ptr<JsonReader> jsonReader =
+	    JsonReaderFactory::createReader("res/test-data/tweets.json");
+	jsonReader->setCachingEnabled(false);
+
+	int maximumPriority = Configuration::getInstance().getInteger("dataReader.maximumPriority");
+
+	// The reply by nytimes is the only tweet in time step 86 and has a priority of 1
+	vtkSmartPointer<vtkPolyData> polyData = jsonReader->getVtkDataSet(maximumPriority, 86);
+
+	EXPECT_EQ(
+	    1,
+	    polyData->GetNumberOfPoints()
+	);
+
+	vtkSmartPointer<vtkStringArray> authorsArray = vtkStringArray::SafeDownCast(
+	            polyData->GetPointData()->GetAbstractArray("authors")
+	        );
+	ASSERT_TRUE(authorsArray);
+
+	EXPECT_EQ(
+	    "nytimes",
+	    authorsArray->GetValue(0)
+	);
+
+	EXPECT_EQ(
+	    0,
+	    jsonReader->getVtkDataSet(0, 86)->GetNumberOfPoints()
+	);
+
+	EXPECT_EQ(
+	    0,
+	    jsonReader->getVtkDataSet(maximumPriority, 85)->GetNumberOfPoints()
+	);
+
+	EXPECT_EQ(
+	    1,
+	    jsonReader->getVtkDataSet(0, 170)->GetNumberOfPoints()
+	);
+
+	EXPECT_EQ(
+	    0,
+	    jsonReader->getVtkDataSet(maximumPriority, 171)->GetNumberOfPoints()
 	);
 }
 
@@ -387,6 +493,39 @@ TEST(TestJsonReader, WriteTweetsToVtkPolyData) {
 	);
 }
 
+TEST(TestJsonReader, WriteInternedAuthorsToVtkPolyData) {
+	std::unique_ptr<JsonReader> jsonReader =
+	    JsonReaderFactory::createReader("res/test-data/tweets.json");
+	vtkSmartPointer<vtkPolyData> polyData = jsonReader->getVtkDataSet(
+	        Configuration::getInstance().getInteger("dataReader.maximumPriority")
+	                                        );
+
+	vtkSmartPointer<vtkIntArray> authorIdsArray = vtkIntArray::SafeDownCast(
+	            polyData->GetPointData()->GetAbstractArray("authorIds")
+	        );
+	ASSERT_TRUE(authorIdsArray);
+	vtkSmartPointer<vtkStringArray> authorDictionary = vtkStringArray::SafeDownCast(
+	            polyData->GetFieldData()->GetAbstractArray("authorDictionary")
+	        );
+	ASSERT_TRUE(authorDictionary);
+
+	EXPECT_EQ(
+	    3,
+	    authorIdsArray->GetNumberOfTuples()
+	);
+
+	// The dictionary only holds the authors present in the data set
+	EXPECT_EQ(
+	    3,
+	    authorDictionary->GetNumberOfValues()
+	);
+
+	EXPECT_EQ(
+	    "elonmusk",
+	    authorDictionary->GetValue(authorIdsArray->GetValue(1))
+	);
+}
+
 TEST(TestJsonReader, WritePrecipitationToVtkPolyData) {
 	std::unique_ptr<JsonReader> jsonReader =
 	    JsonReaderFactory::createReader("res/test-data/precipitation.json");
@@ -422,7 +561,7 @@ TEST(TestJsonReader, WritePrecipitationToVtkPolyData) {
 	ASSERT_TRUE(precipitationTypeArray);
 
 	EXPECT_FLOAT_EQ(
-	    PrecipitationDataPoint::SNOW,
+	    Data::SNOW,
 	    precipitationTypeArray->GetValue(0)
 	);
 
@@ -47,4 +47,29 @@ TEST(TestJsonReaderFactory, ReadInvalidFiles) {
 	    JsonReaderFactory::createReader("res/test-data/invalid.json"),
 	    JsonReaderParseException
 	);
-}
\ No newline at end of file
+}
+
+TEST(TestJsonReaderFactory, ReadInvalidFilesWithoutStreaming) {
+	EXPECT_THROW(
+	    JsonReaderFactory::createReader("res/test-data/non-existant.json", false),
+	    JsonReaderFileOpenException
+	);
+
+	EXPECT_THROW(
+	    JsonReaderFactory::createReader("res/test-data/invalid.json", false),
+	    JsonReaderParseException
+	);
+}
+
+TEST(TestJsonReaderFactory, ReadFilesWithInvalidChildren) {
+	// Only the most deeply nested data point is missing its name
+	EXPECT_THROW(
+	    JsonReaderFactory::createReader("res/test-data/invalid-child.json"),
+	    JsonReaderParseException
+	);
+
+	EXPECT_THROW(
+	    JsonReaderFactory::createReader("res/test-data/invalid-child.json", false),
+	    JsonReaderParseException
+	);
+}
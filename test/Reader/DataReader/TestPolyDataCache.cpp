@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <Reader/DataReader/PolyDataCache.hpp>
+
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+
+static vtkSmartPointer<vtkPolyData> createTestDataSet() {
+	vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+	for (int i = 0; i < 1000; i++) {
+		points->InsertNextPoint(i, i, 0);
+	}
+
+	vtkSmartPointer<vtkPolyData> dataSet = vtkSmartPointer<vtkPolyData>::New();
+	dataSet->SetPoints(points);
+	return dataSet;
+}
+
+TEST(TestPolyDataCache, EvictLeastRecentlyUsed) {
+	vtkSmartPointer<vtkPolyData> dataSet = createTestDataSet();
+	size_t dataSetSize = (size_t) dataSet->GetActualMemorySize() * 1024;
+
+	// The cache has room for exactly two slices
+	PolyDataCache cache(2 * dataSetSize);
+
+	EXPECT_TRUE(cache.put(0, 0, true, createTestDataSet()));
+	EXPECT_TRUE(cache.put(0, 1, true, createTestDataSet()));
+
+	// Using the first slice makes the second one the least recently used
+	EXPECT_TRUE(cache.get(0, 0, true));
+	EXPECT_FALSE(cache.put(0, 2, true, createTestDataSet()));
+
+	EXPECT_TRUE(cache.contains(0, 0, true));
+	EXPECT_FALSE(cache.contains(0, 1, true));
+	EXPECT_TRUE(cache.contains(0, 2, true));
+
+	EXPECT_EQ(
+	    2 * dataSetSize,
+	    cache.getSize()
+	);
+
+	// Temporal and non-temporal slices do not share keys
+	EXPECT_FALSE(cache.get(0, 0, false));
+
+	cache.setBudget(dataSetSize);
+
+	EXPECT_EQ(
+	    dataSetSize,
+	    cache.getSize()
+	);
+	EXPECT_TRUE(cache.contains(0, 2, true));
+
+	cache.clear();
+
+	EXPECT_EQ(
+	    (size_t) 0,
+	    cache.getSize()
+	);
+}
+
+TEST(TestPolyDataCache, RejectDataSetsLargerThanBudget) {
+	PolyDataCache cache(0);
+
+	EXPECT_FALSE(cache.put(3, 0, false, createTestDataSet()));
+	EXPECT_FALSE(cache.contains(3, 0, false));
+}
+
+TEST(TestPolyDataCache, DropModifiedDataSets) {
+	vtkSmartPointer<vtkPolyData> dataSet = createTestDataSet();
+	PolyDataCache cache(1024 * 1024 * 1024);
+
+	cache.put(0, 0, false, dataSet);
+	EXPECT_EQ(
+	    dataSet,
+	    cache.get(0, 0, false)
+	);
+
+	// A consumer writing to the shared points must not affect later retrievals
+	dataSet->GetPoints()->SetPoint(0, 1, 2, 3);
+	dataSet->GetPoints()->Modified();
+
+	EXPECT_FALSE(cache.get(0, 0, false));
+	EXPECT_FALSE(cache.contains(0, 0, false));
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <Reader/DataReader/StringDictionary.hpp>
+
+TEST(TestStringDictionary, InternStrings) {
+	StringDictionary dictionary;
+
+	EXPECT_EQ(
+	    0,
+	    dictionary.intern("BarackObama")
+	);
+
+	EXPECT_EQ(
+	    1,
+	    dictionary.intern("elonmusk")
+	);
+
+	// Known strings keep their ID
+	EXPECT_EQ(
+	    0,
+	    dictionary.intern("BarackObama")
+	);
+
+	EXPECT_EQ(
+	    2,
+	    dictionary.size()
+	);
+
+	EXPECT_EQ(
+	    "elonmusk",
+	    dictionary.getString(1)
+	);
+}
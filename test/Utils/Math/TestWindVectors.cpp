@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <Utils/Math/WindVectors.hpp>
+
+#include <vector>
+
+TEST(TestWindVectors, BlendAcrossNorth) {
+	EXPECT_NEAR(0, WindVectors::blendBearing(350, 10, 0.5), 0.001);
+	EXPECT_NEAR(354.96163, WindVectors::blendBearing(350, 10, 0.25), 0.001);
+	EXPECT_NEAR(180, WindVectors::blendBearing(170, 190, 0.5), 0.001);
+}
+
+TEST(TestWindVectors, RecomposeBearings) {
+	std::vector<float> bearings({ 0, 45, 90, 135, 180, 225, 270, 315, 359.5f, -90, 450 });
+	std::vector<float> eastward(bearings.size());
+	std::vector<float> northward(bearings.size());
+	std::vector<float> recomposed(bearings.size());
+
+	WindVectors::toComponents(bearings.data(), eastward.data(), northward.data(), bearings.size());
+	WindVectors::toBearings(eastward.data(), northward.data(), recomposed.data(), bearings.size());
+
+	EXPECT_NEAR(1, eastward[2], 1e-5);
+	EXPECT_NEAR(-1, northward[4], 1e-5);
+
+	std::vector<float> expected({ 0, 45, 90, 135, 180, 225, 270, 315, 359.5f, 270, 90 });
+	for (size_t i = 0; i < bearings.size(); i++) {
+		EXPECT_NEAR(expected[i], recomposed[i], 0.001);
+	}
+}